@@ -79,6 +79,9 @@ public class DLSS : ModuleRules
 			}
 			);
 
+		// header only IUpscalerDynamicResolutionBounds
+		PrivateIncludePathModuleNames.Add("UpscalerDynamicResolution");
+
 		DynamicallyLoadedModuleNames.AddRange(SupportedDynamicallyLoadedNGXRHIModules(Target));
 	}
 }
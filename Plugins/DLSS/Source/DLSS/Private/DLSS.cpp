@@ -15,6 +15,7 @@
 
 #include "DLSSUpscaler.h"
 #include "DLSSDenoiser.h"
+#include "IUpscalerDynamicResolutionBounds.h"
 
 #include "NGXRHI.h"
 
@@ -28,6 +29,7 @@
 #include "SceneViewExtension.h"
 #include "SceneView.h"
 #include "Misc/MessageDialog.h"
+#include "Features/IModularFeatures.h"
 
 
 #define LOCTEXT_NAMESPACE "FDLSSModule"
@@ -132,6 +134,60 @@ public:
 	}
 };
 
+// Does nothing itself, the DLSSMoviePipelineSupport plugin adds it to the view families it sets up so the upscaler can tell them apart.
+// Never active on its own, so it is not gathered into any other view family.
+class FDLSSMoviePipelineViewExtension final : public FSceneViewExtensionBase
+{
+public:
+	FDLSSMoviePipelineViewExtension(const FAutoRegister& AutoRegister): FSceneViewExtensionBase(AutoRegister)
+	{
+		FSceneViewExtensionIsActiveFunctor IsActiveFunctor;
+
+		IsActiveFunctor.IsActiveFunction = [](const ISceneViewExtension* SceneViewExtension, const FSceneViewExtensionContext& Context)
+		{
+			return false;
+		};
+
+		IsActiveThisFrameFunctions.Add(IsActiveFunctor);
+	}
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) {}
+};
+
+// Keeps the shared dynamic resolution controller within the range of resolution fractions DLSS supports
+class FDLSSDynamicResolutionBounds final : public IUpscalerDynamicResolutionBounds
+{
+public:
+	FDLSSDynamicResolutionBounds(const FDLSSUpscaler* InUpscaler)
+		: Upscaler(InUpscaler)
+	{ }
+
+	virtual const TCHAR* GetDebugName() const override
+	{
+		return TEXT("DLSS");
+	}
+
+	virtual bool IsActive() const override
+	{
+		return Upscaler->IsDLSSActive();
+	}
+
+	virtual float GetMinResolutionFraction() const override
+	{
+		return FDLSSUpscaler::GetMinUpsampleResolutionFraction();
+	}
+
+	virtual float GetMaxResolutionFraction() const override
+	{
+		return FDLSSUpscaler::GetMaxUpsampleResolutionFraction();
+	}
+
+private:
+	const FDLSSUpscaler* Upscaler;
+};
+
 void FDLSSModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -404,6 +460,12 @@ void FDLSSModule::StartupModule()
 			DLSSUpscalerViewExtension = FSceneViewExtensions::NewExtension<FDLSSUpscalerViewExtension>();
 		}
 
+		// and the marker for the movie pipeline's view families
+		{
+			DLSSMoviePipelineViewExtension = FSceneViewExtensions::NewExtension<FDLSSMoviePipelineViewExtension>();
+			DLSSUpscaler->MoviePipelineViewExtension = StaticCastSharedPtr<ISceneViewExtension>(DLSSMoviePipelineViewExtension);
+		}
+
 		// set the denoiser
 		{
 			static const auto CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Reflections.Denoiser"));
@@ -422,6 +484,12 @@ void FDLSSModule::StartupModule()
 			checkf(GCustomResourcePool == nullptr, TEXT("GCustomResourcePool is already in use. Please check that only one upscaling plugin is active."));
 			GCustomResourcePool = DLSSUpscaler.Get();
 		}
+
+		// let the shared dynamic resolution controller know about the DLSS resolution range
+		{
+			DLSSDynamicResolutionBounds.Reset(new FDLSSDynamicResolutionBounds(DLSSUpscaler.Get()));
+			IModularFeatures::Get().RegisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), DLSSDynamicResolutionBounds.Get());
+		}
 	}
 	
 	// setup DLSS image quality and performance automation hooks
@@ -446,6 +514,14 @@ void FDLSSModule::ShutdownModule()
 		// reset the view extension
 		{
 			DLSSUpscalerViewExtension = nullptr;
+			DLSSMoviePipelineViewExtension = nullptr;
+		}
+
+		// reset the dynamic resolution bounds
+		if (DLSSDynamicResolutionBounds)
+		{
+			IModularFeatures::Get().UnregisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), DLSSDynamicResolutionBounds.Get());
+			DLSSDynamicResolutionBounds.Reset();
 		}
 
 		// reset the resource pool
@@ -518,6 +594,11 @@ TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> FDLSSModule::GetDLSSUpscal
 	return StaticCastSharedPtr<ISceneViewExtension>(DLSSUpscalerViewExtension);
 }
 
+TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> FDLSSModule::GetDLSSMoviePipelineViewExtension() const
+{
+	return StaticCastSharedPtr<ISceneViewExtension>(DLSSMoviePipelineViewExtension);
+}
+
 #undef LOCTEXT_NAMESPACE
 
 IMPLEMENT_MODULE(FDLSSModule, DLSS)
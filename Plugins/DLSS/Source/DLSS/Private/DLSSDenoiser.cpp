@@ -41,18 +41,143 @@ static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverride(
 	ECVF_RenderThreadSafe
 );
 
-bool FDLSSDenoiser::SkipDenoiser(const FViewInfo& View) const
+// Per signal policy on top of r.NGX.DLSS.BuiltInDenoiserOverride, only takes effect while DLSS-RR consumes the noisy signals
+#define DLSS_DENOISER_SIGNAL_OVERRIDE_HELP \
+	TEXT("-1: same as r.NGX.DLSS.BuiltInDenoiserOverride\n") \
+	TEXT(" 0: skip the built-in denoiser and pass the noisy signal through to DLSS-RR\n") \
+	TEXT(" 1: use the built-in denoiser\n")
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideShadows(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.Shadows"),
+	-1,
+	TEXT("Change what happens to the built-in shadow visibility mask and polychromatic penumbra denoising (default = -1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideReflections(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.Reflections"),
+	-1,
+	TEXT("Change what happens to the built-in reflection and water reflection denoising (default = -1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideAmbientOcclusion(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.AmbientOcclusion"),
+	-1,
+	TEXT("Change what happens to the built-in ambient occlusion denoising (default = -1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideIndirect(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.Indirect"),
+	-1,
+	TEXT("Change what happens to the built-in combined diffuse and specular indirect denoising (default = -1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideDiffuseIndirect(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.DiffuseIndirect"),
+	1,
+	TEXT("Change what happens to the built-in ray traced and screen space diffuse indirect denoising (default = 1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+static TAutoConsoleVariable<int32> CVarNGXDLSSBuiltInDenoiserOverrideSkyLight(
+	TEXT("r.NGX.DLSS.BuiltInDenoiserOverride.SkyLight"),
+	-1,
+	TEXT("Change what happens to the built-in sky light and reflected sky light denoising (default = -1)\n")
+	DLSS_DENOISER_SIGNAL_OVERRIDE_HELP,
+	ECVF_RenderThreadSafe
+);
+
+#undef DLSS_DENOISER_SIGNAL_OVERRIDE_HELP
+
+// GPU time spent in the wrapped denoiser, i.e. what skipping the signal would save
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserShadowVisibilityMasks, TEXT("DLSS Denoiser: Shadow Visibility Masks"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserPolychromaticPenumbraHarmonics, TEXT("DLSS Denoiser: Polychromatic Penumbra Harmonics"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserReflections, TEXT("DLSS Denoiser: Reflections"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserWaterReflections, TEXT("DLSS Denoiser: Water Reflections"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserAmbientOcclusion, TEXT("DLSS Denoiser: Ambient Occlusion"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserDiffuseIndirect, TEXT("DLSS Denoiser: Diffuse Indirect"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserIndirect, TEXT("DLSS Denoiser: Indirect"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserScreenSpaceDiffuseIndirect, TEXT("DLSS Denoiser: Screen Space Diffuse Indirect"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserDiffuseIndirectHarmonic, TEXT("DLSS Denoiser: Diffuse Indirect Harmonic"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserSkyLight, TEXT("DLSS Denoiser: Sky Light"));
+DECLARE_GPU_STAT_NAMED(DLSSDenoiserReflectedSkyLight, TEXT("DLSS Denoiser: Reflected Sky Light"));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped shadow visibility masks"), STAT_DLSSDenoiserSkippedShadowVisibilityMasks, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped polychromatic penumbra harmonics"), STAT_DLSSDenoiserSkippedPolychromaticPenumbraHarmonics, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped reflections"), STAT_DLSSDenoiserSkippedReflections, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped water reflections"), STAT_DLSSDenoiserSkippedWaterReflections, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped ambient occlusion"), STAT_DLSSDenoiserSkippedAmbientOcclusion, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped diffuse indirect"), STAT_DLSSDenoiserSkippedDiffuseIndirect, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped indirect"), STAT_DLSSDenoiserSkippedIndirect, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped screen space diffuse indirect"), STAT_DLSSDenoiserSkippedScreenSpaceDiffuseIndirect, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped sky light"), STAT_DLSSDenoiserSkippedSkyLight, STATGROUP_DLSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS Denoiser: Skipped reflected sky light"), STAT_DLSSDenoiserSkippedReflectedSkyLight, STATGROUP_DLSS);
+
+static int32 GetBuiltInDenoiserOverride(EDLSSDenoiserSignal Signal)
+{
+	int32 SignalOverride = -1;
+	switch (Signal)
+	{
+	case EDLSSDenoiserSignal::ShadowVisibilityMasks:
+	case EDLSSDenoiserSignal::PolychromaticPenumbraHarmonics:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideShadows.GetValueOnRenderThread();
+		break;
+	case EDLSSDenoiserSignal::Reflections:
+	case EDLSSDenoiserSignal::WaterReflections:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideReflections.GetValueOnRenderThread();
+		break;
+	case EDLSSDenoiserSignal::AmbientOcclusion:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideAmbientOcclusion.GetValueOnRenderThread();
+		break;
+	case EDLSSDenoiserSignal::Indirect:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideIndirect.GetValueOnRenderThread();
+		break;
+	case EDLSSDenoiserSignal::DiffuseIndirect:
+	case EDLSSDenoiserSignal::ScreenSpaceDiffuseIndirect:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideDiffuseIndirect.GetValueOnRenderThread();
+		break;
+	case EDLSSDenoiserSignal::SkyLight:
+	case EDLSSDenoiserSignal::ReflectedSkyLight:
+		SignalOverride = CVarNGXDLSSBuiltInDenoiserOverrideSkyLight.GetValueOnRenderThread();
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+
+	return SignalOverride >= 0 ? SignalOverride : CVarNGXDLSSBuiltInDenoiserOverride.GetValueOnRenderThread();
+}
+
+bool FDLSSDenoiser::SkipDenoiser(const FViewInfo& View, EDLSSDenoiserSignal Signal) const
 {
 	static const auto CVarDLSSDenoiserMode = IConsoleManager::Get().FindConsoleVariable(TEXT("r.NGX.DLSS.DenoiserMode"));
 	const bool bIsDLSSDenoising = CVarDLSSDenoiserMode && CVarDLSSDenoiserMode->GetInt() != 0;
-	const int32 BuiltInDenoiserOverride = CVarNGXDLSSBuiltInDenoiserOverride.GetValueOnRenderThread();
-	return IsDLSSActive(View) && bIsDLSSDenoising && BuiltInDenoiserOverride != 1;
+	return bIsDLSSDenoising && IsDLSSActive(View) && GetBuiltInDenoiserOverride(Signal) != 1;
 }
 bool FDLSSDenoiser::IsDLSSActive(const FViewInfo& View) const
 {
 	return Upscaler->IsDLSSActive() && View.Family && FDLSSSceneViewFamilyUpscaler::IsDLSSTemporalUpscaler(View.Family->GetTemporalUpscalerInterface());
 }
 
+// DLSS-RR reads the noisy diffuse indirect lighting, hand it through in the layout the denoiser would have written
+static FSSDSignalTextures MakeDiffuseIndirectPassThrough(FRDGBuilder& GraphBuilder, const IScreenSpaceDenoiser::FDiffuseIndirectInputs& Inputs)
+{
+	const FRDGSystemTextures& SystemTextures = FRDGSystemTextures::Get(GraphBuilder);
+
+	FSSDSignalTextures Outputs;
+	Outputs.Textures[0] = Inputs.Color;
+	Outputs.Textures[1] = Inputs.AmbientOcclusionMask ? Inputs.AmbientOcclusionMask : SystemTextures.White;
+	return Outputs;
+}
+
 FDLSSDenoiser::FDLSSDenoiser(const IScreenSpaceDenoiser* InWrappedDenoiser, const FDLSSUpscaler* InUpscaler)
 	: WrappedDenoiser(InWrappedDenoiser)
 	, Upscaler(InUpscaler)
@@ -82,8 +207,9 @@ IScreenSpaceDenoiser::EShadowRequirements FDLSSDenoiser::GetShadowRequirements(c
 
 void FDLSSDenoiser::DenoiseShadowVisibilityMasks(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const TStaticArray<FShadowVisibilityParameters, IScreenSpaceDenoiser::kMaxBatchSize>& InputParameters, const int32 InputParameterCount, TStaticArray<FShadowVisibilityOutputs, IScreenSpaceDenoiser::kMaxBatchSize>& Outputs) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::ShadowVisibilityMasks))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedShadowVisibilityMasks);
 		for (int32 Shadow = 0; Shadow < InputParameterCount; ++Shadow)
 		{
 			Outputs[Shadow].Mask = InputParameters[Shadow].InputTextures.Mask;
@@ -91,15 +217,16 @@ void FDLSSDenoiser::DenoiseShadowVisibilityMasks(FRDGBuilder& GraphBuilder, cons
 	}
 	else
 	{
-
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserShadowVisibilityMasks);
 		WrappedDenoiser->DenoiseShadowVisibilityMasks(GraphBuilder, View, PreviousViewInfos, SceneTextures, InputParameters, InputParameterCount, Outputs);
 	}
 }
 
 IScreenSpaceDenoiser::FPolychromaticPenumbraOutputs FDLSSDenoiser::DenoisePolychromaticPenumbraHarmonics(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FPolychromaticPenumbraHarmonics& Inputs) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::PolychromaticPenumbraHarmonics))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedPolychromaticPenumbraHarmonics);
 		IScreenSpaceDenoiser::FPolychromaticPenumbraOutputs Outputs;
 		Outputs.Diffuse = Inputs.Diffuse.Harmonics[0];
 		Outputs.Specular = Inputs.Specular.Harmonics[0];
@@ -107,21 +234,27 @@ IScreenSpaceDenoiser::FPolychromaticPenumbraOutputs FDLSSDenoiser::DenoisePolych
 	}
 	else
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserPolychromaticPenumbraHarmonics);
 		return WrappedDenoiser->DenoisePolychromaticPenumbraHarmonics(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs);
 	}
 }
 
 IScreenSpaceDenoiser::FReflectionsOutputs FDLSSDenoiser::DenoiseReflections(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FReflectionsInputs& Inputs, const FReflectionsRayTracingConfig Config) const
 { 
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::Reflections))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedReflections);
 		FReflectionsOutputs Outputs;
 		Outputs.Color = Inputs.Color;
 		return Outputs;
 	}
 	else
 	{
-		FReflectionsOutputs Outputs = WrappedDenoiser->DenoiseReflections(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+		FReflectionsOutputs Outputs;
+		{
+			RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserReflections);
+			Outputs = WrappedDenoiser->DenoiseReflections(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+		}
 		const bool bApplyTemporalAA = IsDLSSActive(View) && CVarNGXDLSSReflectionsTemporalAA.GetValueOnRenderThread() && View.ViewState && IsTemporalAccumulationBasedMethod(View.AntiAliasingMethod);
 		if(bApplyTemporalAA)
 		{
@@ -149,15 +282,20 @@ IScreenSpaceDenoiser::FReflectionsOutputs FDLSSDenoiser::DenoiseReflections(FRDG
 
 IScreenSpaceDenoiser::FReflectionsOutputs FDLSSDenoiser::DenoiseWaterReflections(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FReflectionsInputs& Inputs, const FReflectionsRayTracingConfig Config) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::WaterReflections))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedWaterReflections);
 		FReflectionsOutputs Outputs;
 		Outputs.Color = Inputs.Color;
 		return Outputs;
 	}
 	else
 	{
-		FReflectionsOutputs Outputs = WrappedDenoiser->DenoiseWaterReflections(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+		FReflectionsOutputs Outputs;
+		{
+			RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserWaterReflections);
+			Outputs = WrappedDenoiser->DenoiseWaterReflections(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+		}
 		const bool bApplyTemporalAA = IsDLSSActive(View) && CVarNGXDLSSWaterReflectionsTemporalAA.GetValueOnRenderThread() && View.ViewState && IsTemporalAccumulationBasedMethod(View.AntiAliasingMethod);
 		if (bApplyTemporalAA)
 		{
@@ -186,28 +324,40 @@ IScreenSpaceDenoiser::FReflectionsOutputs FDLSSDenoiser::DenoiseWaterReflections
 
 IScreenSpaceDenoiser::FAmbientOcclusionOutputs FDLSSDenoiser::DenoiseAmbientOcclusion(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FAmbientOcclusionInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::AmbientOcclusion))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedAmbientOcclusion);
 		FAmbientOcclusionOutputs Outputs;
 		Outputs.AmbientOcclusionMask = Inputs.Mask;
 		return Outputs;
 	}
 	else
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserAmbientOcclusion);
 		return WrappedDenoiser->DenoiseAmbientOcclusion(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
 	}
 }
 
 FSSDSignalTextures FDLSSDenoiser::DenoiseDiffuseIndirect(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FDiffuseIndirectInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	return WrappedDenoiser->DenoiseDiffuseIndirect(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::DiffuseIndirect))
+	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedDiffuseIndirect);
+		return MakeDiffuseIndirectPassThrough(GraphBuilder, Inputs);
+	}
+	else
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserDiffuseIndirect);
+		return WrappedDenoiser->DenoiseDiffuseIndirect(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+	}
 }
 
 #if defined(ENGINE_HAS_DENOISE_INDIRECT) && ENGINE_HAS_DENOISE_INDIRECT
 FSSDSignalTextures FDLSSDenoiser::DenoiseIndirect(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FIndirectInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::Indirect))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedIndirect);
 		FSSDSignalTextures Outputs;
 
 		const FRDGSystemTextures& SystemTextures = FRDGSystemTextures::Get(GraphBuilder);
@@ -220,6 +370,7 @@ FSSDSignalTextures FDLSSDenoiser::DenoiseIndirect(FRDGBuilder& GraphBuilder, con
 	}
 	else
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserIndirect);
 		return WrappedDenoiser->DenoiseIndirect(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
 	}
 }
@@ -227,18 +378,30 @@ FSSDSignalTextures FDLSSDenoiser::DenoiseIndirect(FRDGBuilder& GraphBuilder, con
 
 FSSDSignalTextures FDLSSDenoiser::DenoiseScreenSpaceDiffuseIndirect(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FDiffuseIndirectInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	return WrappedDenoiser->DenoiseScreenSpaceDiffuseIndirect(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::ScreenSpaceDiffuseIndirect))
+	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedScreenSpaceDiffuseIndirect);
+		return MakeDiffuseIndirectPassThrough(GraphBuilder, Inputs);
+	}
+	else
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserScreenSpaceDiffuseIndirect);
+		return WrappedDenoiser->DenoiseScreenSpaceDiffuseIndirect(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
+	}
 }
 
 FSSDSignalTextures FDLSSDenoiser::DenoiseDiffuseIndirectHarmonic(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FDiffuseIndirectHarmonic& Inputs, const HybridIndirectLighting::FCommonParameters& CommonDiffuseParameters) const
 {
+	// no pass through for the spherical harmonic encoding, only measured
+	RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserDiffuseIndirectHarmonic);
 	return WrappedDenoiser->DenoiseDiffuseIndirectHarmonic(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, CommonDiffuseParameters);
 }
 
 IScreenSpaceDenoiser::FDiffuseIndirectOutputs FDLSSDenoiser::DenoiseSkyLight(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FDiffuseIndirectInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::SkyLight))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedSkyLight);
 		FDiffuseIndirectOutputs Outputs;
 		Outputs.AmbientOcclusionMask = Inputs.AmbientOcclusionMask;
 		Outputs.Color = Inputs.Color;
@@ -246,6 +409,7 @@ IScreenSpaceDenoiser::FDiffuseIndirectOutputs FDLSSDenoiser::DenoiseSkyLight(FRD
 	}
 	else
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserSkyLight);
 		return WrappedDenoiser->DenoiseSkyLight(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
 	}
 }
@@ -253,8 +417,9 @@ IScreenSpaceDenoiser::FDiffuseIndirectOutputs FDLSSDenoiser::DenoiseSkyLight(FRD
 #if (ENGINE_MAJOR_VERSION == 5) && (ENGINE_MINOR_VERSION < 4)
 IScreenSpaceDenoiser::FDiffuseIndirectOutputs FDLSSDenoiser::DenoiseReflectedSkyLight(FRDGBuilder& GraphBuilder, const FViewInfo& View, FPreviousViewInfo* PreviousViewInfos, const FSceneTextureParameters& SceneTextures, const FDiffuseIndirectInputs& Inputs, const FAmbientOcclusionRayTracingConfig Config) const
 {
-	if (SkipDenoiser(View))
+	if (SkipDenoiser(View, EDLSSDenoiserSignal::ReflectedSkyLight))
 	{
+		INC_DWORD_STAT(STAT_DLSSDenoiserSkippedReflectedSkyLight);
 		FDiffuseIndirectOutputs Outputs;
 		Outputs.AmbientOcclusionMask = Inputs.AmbientOcclusionMask;
 		Outputs.Color = Inputs.Color;
@@ -262,6 +427,7 @@ IScreenSpaceDenoiser::FDiffuseIndirectOutputs FDLSSDenoiser::DenoiseReflectedSky
 	}
 	else
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, DLSSDenoiserReflectedSkyLight);
 		return WrappedDenoiser->DenoiseReflectedSkyLight(GraphBuilder, View, PreviousViewInfos, SceneTextures, Inputs, Config);
 	}
 }
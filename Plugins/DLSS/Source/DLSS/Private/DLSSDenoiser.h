@@ -16,6 +16,22 @@
 #include "ScreenSpaceDenoise.h"
 class FDLSSUpscaler;
 
+// Signals the wrapped denoiser can be asked to denoise, each with its own r.NGX.DLSS.BuiltInDenoiserOverride.<Signal> policy
+enum class EDLSSDenoiserSignal : uint8
+{
+	ShadowVisibilityMasks,
+	PolychromaticPenumbraHarmonics,
+	Reflections,
+	WaterReflections,
+	AmbientOcclusion,
+	DiffuseIndirect,
+	Indirect,
+	ScreenSpaceDiffuseIndirect,
+	SkyLight,
+	ReflectedSkyLight,
+	Num
+};
+
 // wrapper for the default denoiser to add TAA after some passes
 class DLSS_API FDLSSDenoiser final : public IScreenSpaceDenoiser
 {
@@ -47,7 +63,8 @@ public:
 	const IScreenSpaceDenoiser* GetWrappedDenoiser() const;
 private:
 
-	bool SkipDenoiser(const FViewInfo& View) const;
+	// True when DLSS-RR consumes the noisy signal directly and the per signal policy allows bypassing the wrapped denoiser
+	bool SkipDenoiser(const FViewInfo& View, EDLSSDenoiserSignal Signal) const;
 	bool IsDLSSActive(const FViewInfo& View) const;
 	const IScreenSpaceDenoiser* WrappedDenoiser;
 	const FDLSSUpscaler* Upscaler;
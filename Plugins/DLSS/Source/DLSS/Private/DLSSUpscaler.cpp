@@ -18,6 +18,7 @@
 #include "GBufferResolvePass.h"
 #include "VelocityCombinePass.h"
 
+#include "Containers/LockFreeList.h"
 #include "DynamicResolutionState.h"
 #include "Engine/GameViewportClient.h"
 #include "LegacyScreenPercentageDriver.h"
@@ -122,6 +123,8 @@ static TAutoConsoleVariable<bool> CVarNGXEnableAlphaUpscaling(
 
 DECLARE_GPU_STAT(DLSS)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS: Upscaler interface allocations"), STAT_DLSSUpscalerAllocations, STATGROUP_DLSS);
+
 static const float kDLSSResolutionFractionError = 0.01f;
 
 BEGIN_SHADER_PARAMETER_STRUCT(FDLSSShaderParameters, )
@@ -515,6 +518,29 @@ ITemporalUpscaler* FDLSSSceneViewFamilyUpscaler::Fork_GameThread(const class FSc
 	return new FDLSSSceneViewFamilyUpscaler(Upscaler, DLSSQualityMode);
 }
 
+// Created on the game thread, deleted by the renderer once the view family has been rendered
+static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> GDLSSSceneViewFamilyUpscalerFreeList;
+
+void* FDLSSSceneViewFamilyUpscaler::operator new(size_t Size)
+{
+	check(Size == sizeof(FDLSSSceneViewFamilyUpscaler));
+	void* Ptr = GDLSSSceneViewFamilyUpscalerFreeList.Pop();
+	if (!Ptr)
+	{
+		INC_DWORD_STAT(STAT_DLSSUpscalerAllocations);
+		Ptr = FMemory::Malloc(sizeof(FDLSSSceneViewFamilyUpscaler), alignof(FDLSSSceneViewFamilyUpscaler));
+	}
+	return Ptr;
+}
+
+void FDLSSSceneViewFamilyUpscaler::operator delete(void* Ptr)
+{
+	if (Ptr)
+	{
+		GDLSSSceneViewFamilyUpscalerFreeList.Push(Ptr);
+	}
+}
+
 ITemporalUpscaler::FOutputs FDLSSSceneViewFamilyUpscaler::AddPasses(
 	FRDGBuilder& GraphBuilder,
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
@@ -629,9 +655,9 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
 	// TODO: check if this camera cut logic is sufficient
-	const bool bCameraCut = View.bCameraCut || !InputCustomHistoryInterface.IsValid();
+	bool bCameraCut = View.bCameraCut || !InputCustomHistoryInterface.IsValid();
 #else
-	const bool bCameraCut = !InputHistory.IsValid() || View.bCameraCut || !OutputHistory;
+	bool bCameraCut = !InputHistory.IsValid() || View.bCameraCut || !OutputHistory;
 #endif
 	const FIntPoint OutputExtent = Inputs.GetOutputExtent();
 
@@ -696,6 +722,29 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 	}
 	FDLSSStateRef DLSSState = (InputDLSSHistory && InputDLSSHistory->DLSSState) ? InputDLSSHistory->DLSSState : MakeShared<FDLSSState, ESPMode::ThreadSafe>();
 
+	// During a movie render each view state of the movie pipeline's view families keeps its own feature, the movie pipeline gives every tile its own view state
+	const uint64 PassesStartCycles = FPlatformTime::Cycles64();
+	const bool bMoviePipelineView = Upscaler->bMoviePipelineActive && View.State && View.Family && Upscaler->IsMoviePipelineViewFamily(*View.Family);
+	const uint32 MoviePipelineViewKey = bMoviePipelineView ? View.State->GetViewKey() : 0;
+	if (bMoviePipelineView)
+	{
+		FScopeLock Lock(&Upscaler->MoviePipelineMutex);
+		if (FDLSSStateRef* TileState = Upscaler->MoviePipelineStates.Find(MoviePipelineViewKey))
+		{
+			DLSSState = *TileState;
+			bCameraCut = View.bCameraCut;
+			Upscaler->MoviePipelineStats.NumFeaturesReused++;
+		}
+		else
+		{
+			DLSSState = Upscaler->MoviePipelineStates.Add(MoviePipelineViewKey, MakeShared<FDLSSState, ESPMode::ThreadSafe>());
+			Upscaler->MoviePipelineStats.NumFeaturesCreated++;
+			Upscaler->MoviePipelineStats.NumTiles = Upscaler->MoviePipelineStates.Num();
+			bCameraCut = true;
+		}
+		Upscaler->MoviePipelineStats.NumHistoryResets += bCameraCut ? 1 : 0;
+	}
+
 	{
 		FDLSSShaderParameters* PassParameters = GraphBuilder.AllocParameters<FDLSSShaderParameters>();
 
@@ -880,6 +929,12 @@ FDLSSOutputs FDLSSSceneViewFamilyUpscaler::AddDLSSPass(
 		}
 	}
 #endif
+
+	if (bMoviePipelineView)
+	{
+		FScopeLock Lock(&Upscaler->MoviePipelineMutex);
+		Upscaler->MoviePipelineStats.UpscalerPassesMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PassesStartCycles);
+	}
 	return Outputs;
 }
 
@@ -908,6 +963,36 @@ void FDLSSUpscaler::Tick(FRHICommandListImmediate& RHICmdList)
 	});
 }
 
+void FDLSSUpscaler::SetMoviePipelineActive(bool bActive)
+{
+	check(IsInGameThread());
+	FDLSSUpscaler* Upscaler = this;
+	ENQUEUE_RENDER_COMMAND(DLSSSetMoviePipelineActive)([Upscaler, bActive](FRHICommandListImmediate& RHICmdList)
+	{
+		FScopeLock Lock(&Upscaler->MoviePipelineMutex);
+		if (!Upscaler->bMoviePipelineActive && bActive)
+		{
+			Upscaler->MoviePipelineStats = FDLSSMoviePipelineStats();
+		}
+		else if (!bActive)
+		{
+			Upscaler->MoviePipelineStates.Empty();
+		}
+		Upscaler->bMoviePipelineActive = bActive;
+	});
+}
+
+bool FDLSSUpscaler::IsMoviePipelineViewFamily(const FSceneViewFamily& ViewFamily) const
+{
+	return MoviePipelineViewExtension.IsValid() && ViewFamily.ViewExtensions.Contains(MoviePipelineViewExtension.ToSharedRef());
+}
+
+FDLSSMoviePipelineStats FDLSSUpscaler::GetMoviePipelineStats() const
+{
+	FScopeLock Lock(&MoviePipelineMutex);
+	return MoviePipelineStats;
+}
+
 bool FDLSSUpscaler::IsQualityModeSupported(EDLSSQualityMode InQualityMode) const
 {
 	return ResolutionSettings[ToNGXQuality(InQualityMode)].bIsSupported;
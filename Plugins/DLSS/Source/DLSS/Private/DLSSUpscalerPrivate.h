@@ -28,6 +28,8 @@ using ITemporalUpscaler = UE::Renderer::Private::ITemporalUpscaler;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogDLSS, Verbose, All);
 
+DECLARE_STATS_GROUP(TEXT("DLSS"), STATGROUP_DLSS, STATCAT_Advanced);
+
 class FDLSSUpscaler;
 struct FTemporalAAHistory;
 
@@ -124,6 +126,10 @@ public:
 
 	static bool IsDLSSTemporalUpscaler(const ITemporalUpscaler* TemporalUpscaler);
 
+	// One of these is created per view family every frame, recycle the memory instead of going to the allocator each time
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
+
 private:
 	const FDLSSUpscaler* Upscaler;
 	const EDLSSQualityMode DLSSQualityMode;
@@ -15,9 +15,11 @@
 
 class FDLSSUpscaler;
 class FDLSSDenoiser;
+class FDLSSDynamicResolutionBounds;
 class ISceneViewExtension;
 class FDLSSUpscalerViewExtension;
 class FNGXAutomationViewExtension;
+class FDLSSMoviePipelineViewExtension;
 class NGXRHI;
 
 
@@ -51,6 +53,8 @@ class IDLSSModuleInterface : public IModuleInterface
 		virtual float GetResolutionFractionForQuality(int32 Quality) const = 0;
 		virtual FDLSSUpscaler* GetDLSSUpscaler() const = 0;
 		virtual TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> GetDLSSUpscalerViewExtension() const = 0;
+		// Add to the view families the movie render pipeline sets up, only their views get a DLSS feature per view state during a movie render
+		virtual TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> GetDLSSMoviePipelineViewExtension() const = 0;
 };
 
 class FDLSSModule final: public IDLSSModuleInterface
@@ -70,14 +74,17 @@ public:
 	virtual FDLSSUpscaler* GetDLSSUpscaler() const override;
 
 	virtual TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> GetDLSSUpscalerViewExtension() const override;
+	virtual TSharedPtr< ISceneViewExtension, ESPMode::ThreadSafe> GetDLSSMoviePipelineViewExtension() const override;
 
 private:
 
 	TUniquePtr<FDLSSUpscaler> DLSSUpscaler;
 	TUniquePtr<FDLSSDenoiser> DLSSDenoiser;
+	TUniquePtr<FDLSSDynamicResolutionBounds> DLSSDynamicResolutionBounds;
 	TUniquePtr<NGXRHI> NGXRHIExtensions;
 	TSharedPtr< FDLSSUpscalerViewExtension, ESPMode::ThreadSafe> DLSSUpscalerViewExtension;
 	TSharedPtr< FNGXAutomationViewExtension, ESPMode::ThreadSafe> NGXAutomationViewExtension;
+	TSharedPtr< FDLSSMoviePipelineViewExtension, ESPMode::ThreadSafe> DLSSMoviePipelineViewExtension;
 	ENGXSupport NGXSupport = ENGXSupport::NotSupported;
 	EDLSSSupport DLSSSRSupport = EDLSSSupport::NotSupported;
 	EDLSSSupport DLSSRRSupport = EDLSSSupport::NotSupported;
@@ -15,7 +15,9 @@
 #include "CustomResourcePool.h"
 
 struct FDLSSOptimalSettings;
+struct FDLSSState;
 class FSceneViewFamily;
+class ISceneViewExtension;
 class NGXRHI;
 
 enum class EDLSSQualityMode
@@ -31,6 +33,16 @@ enum class EDLSSQualityMode
 	NumValues = 6
 };
 
+// Where DLSS spent its time during a movie render, the DLSSMoviePipelineSupport plugin writes it to the output metadata
+struct FDLSSMoviePipelineStats
+{
+	uint32 NumTiles = 0;
+	uint32 NumFeaturesCreated = 0;
+	uint32 NumFeaturesReused = 0;
+	uint32 NumHistoryResets = 0;
+	double UpscalerPassesMs = 0.0;
+};
+
 class DLSS_API FDLSSUpscaler final : public ICustomResourcePool
 {
 
@@ -77,10 +89,16 @@ public:
 		return MaxDynamicResolutionFraction;
 	}
 
+	// While a movie render is active each view state, and so each movie render tile, keeps its own persistent DLSS feature and history.
+	// Call on the game thread before the view family is rendered, false ends the movie render and releases the features.
+	void SetMoviePipelineActive(bool bActive);
+	FDLSSMoviePipelineStats GetMoviePipelineStats() const;
+
 private:
 	FDLSSUpscaler(NGXRHI* InNGXRHIExtensions);
 
 	bool EnableDLSSInPlayInEditorViewports() const;
+	bool IsMoviePipelineViewFamily(const FSceneViewFamily& ViewFamily) const;
 
 	// The FDLSSUpscaler(NGXRHI*) will update those once
 	static NGXRHI* NGXRHIExtensions;
@@ -91,6 +109,14 @@ private:
 	static TArray<FDLSSOptimalSettings> ResolutionSettings;
 	float PreviousResolutionFraction;
 
+	// Movie render state, the flag is only accessed on the render thread, the rest under MoviePipelineMutex. The features are keyed by view state.
+	bool bMoviePipelineActive = false;
+	mutable FCriticalSection MoviePipelineMutex;
+	mutable TMap<uint32, TSharedPtr<FDLSSState, ESPMode::ThreadSafe>> MoviePipelineStates;
+	mutable FDLSSMoviePipelineStats MoviePipelineStats;
+	// The movie pipeline adds this to the view families it renders, FDLSSModule sets it once after creating the upscaler
+	TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> MoviePipelineViewExtension;
+
 	friend class FDLSSUpscalerViewExtension;
 	friend class FDLSSSceneViewFamilyUpscaler;
 };
@@ -13,6 +13,7 @@
 
 #include "DLSS.h"
 #include "DLSSLibrary.h"
+#include "DLSSUpscaler.h"
 #include "MovieRenderPipelineDataTypes.h"
 #include "SceneView.h"
 
@@ -54,7 +55,7 @@ void UMoviePipelineDLSSSetting::SetupViewFamily(FSceneViewFamily& ViewFamily)
 		{
 			// set screen percentage
 			static IConsoleVariable* CVarScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
-			if (CVarScreenPercentage != nullptr)
+			if (CVarScreenPercentage != nullptr && CVarScreenPercentage->GetFloat() != OptimalScreenPercentage)
 			{
 				EConsoleVariableFlags Priority = static_cast<EConsoleVariableFlags>(CVarScreenPercentage->GetFlags() & ECVF_SetByMask);
 				CVarScreenPercentage->Set(OptimalScreenPercentage, Priority);
@@ -67,11 +68,44 @@ void UMoviePipelineDLSSSetting::SetupViewFamily(FSceneViewFamily& ViewFamily)
 			{
 				ViewFamily.ViewExtensions.Add(DLSSViewExt.ToSharedRef());
 			}
+
+			// Each tile renders with its own view state, the upscaler keeps a DLSS feature per view state of the view families marked here while this is set
+			FDLSSUpscaler* DLSSUpscaler = DLSSModule->GetDLSSUpscaler();
+			if (DLSSUpscaler && !bMoviePipelineActive)
+			{
+				bMoviePipelineActive = true;
+				DLSSUpscaler->SetMoviePipelineActive(true);
+			}
+
+			TSharedPtr<ISceneViewExtension> DLSSMoviePipelineViewExt = DLSSModule->GetDLSSMoviePipelineViewExtension();
+			if (DLSSMoviePipelineViewExt.IsValid() && !ViewFamily.ViewExtensions.Contains(DLSSMoviePipelineViewExt))
+			{
+				ViewFamily.ViewExtensions.Add(DLSSMoviePipelineViewExt.ToSharedRef());
+			}
 		}
 	}
 	UDLSSLibrary::EnableDLSS(bIsSupported);
 }
 
+void UMoviePipelineDLSSSetting::SetupForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	Super::SetupForPipelineImpl(InPipeline);
+
+	bMoviePipelineActive = false;
+}
+
+void UMoviePipelineDLSSSetting::TeardownForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	IDLSSModuleInterface* DLSSModule = &FModuleManager::LoadModuleChecked<IDLSSModuleInterface>("DLSS");
+	if (FDLSSUpscaler* DLSSUpscaler = DLSSModule->GetDLSSUpscaler())
+	{
+		DLSSUpscaler->SetMoviePipelineActive(false);
+	}
+	bMoviePipelineActive = false;
+
+	Super::TeardownForPipelineImpl(InPipeline);
+}
+
 void UMoviePipelineDLSSSetting::GetFormatArguments(FMoviePipelineFormatArgs& InOutFormatArgs) const
 {
 	Super::GetFormatArguments(InOutFormatArgs);
@@ -82,6 +116,18 @@ void UMoviePipelineDLSSSetting::GetFormatArguments(FMoviePipelineFormatArgs& InO
 	{
 		InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssQuality"), StaticEnum<EMoviePipelineDLSSQuality>()->GetDisplayNameTextByIndex((int64)DLSSQuality).ToString());
 		InOutFormatArgs.FilenameArguments.Add(TEXT("dlss_quality"), StaticEnum<EMoviePipelineDLSSQuality>()->GetDisplayNameTextByIndex((int64)DLSSQuality).ToString());
+
+		// Render time breakdown so far, lets tiled renders be compared against FSR3 (amd/fidelityFxFSR3*)
+		IDLSSModuleInterface* DLSSModule = &FModuleManager::LoadModuleChecked<IDLSSModuleInterface>("DLSS");
+		if (const FDLSSUpscaler* DLSSUpscaler = DLSSModule->GetDLSSUpscaler())
+		{
+			const FDLSSMoviePipelineStats Stats = DLSSUpscaler->GetMoviePipelineStats();
+			InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssTiles"), FString::FromInt(Stats.NumTiles));
+			InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssFeaturesCreated"), FString::FromInt(Stats.NumFeaturesCreated));
+			InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssFeaturesReused"), FString::FromInt(Stats.NumFeaturesReused));
+			InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssHistoryResets"), FString::FromInt(Stats.NumHistoryResets));
+			InOutFormatArgs.FileMetadata.Add(TEXT("unreal/dlssUpscalerPassesMs"), FString::SanitizeFloat(Stats.UpscalerPassesMs));
+		}
 	}
 	else
 	{
@@ -50,4 +50,12 @@ public:
 	/** DLSS/DLAA quality setting */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DLSS/DLAA settings", DisplayName = "DLSS Quality")
 	EMoviePipelineDLSSQuality DLSSQuality;
+
+protected:
+	virtual void SetupForPipelineImpl(UMoviePipeline* InPipeline) override;
+	virtual void TeardownForPipelineImpl(UMoviePipeline* InPipeline) override;
+
+private:
+	// Whether the upscaler has been told that a movie render is running
+	bool bMoviePipelineActive = false;
 };
\ No newline at end of file
@@ -61,6 +61,9 @@ public class FFXFSR3TemporalUpscaling : ModuleRules
 			}
         );
 
+		// Header only IUpscalerDynamicResolutionBounds
+		PrivateIncludePathModuleNames.Add("UpscalerDynamicResolution");
+
 		PrecompileForTargets = PrecompileTargetsType.Any;
 	}
 }
@@ -251,6 +251,16 @@ const FFXFSR3ShaderMapSwapState FFXFSR3ShaderMapSwapState::Default = { nullptr,
 //------------------------------------------------------------------------------------------------------
 static TMap<class FGlobalShaderMap*, FFXFSR3ShaderMapSwapState> SSRShaderMapSwapState;
 
+#if !WITH_EDITOR
+//------------------------------------------------------------------------------------------------------
+// The last global shader map, SSR section content & swap state that SetSSRShader applied, so the swap state bookkeeping
+// can be skipped until one of them changes.
+//------------------------------------------------------------------------------------------------------
+static FGlobalShaderMap* SSRLastGlobalMap = nullptr;
+static const FGlobalShaderMapContent* SSRLastContent = nullptr;
+static bool bSSRLastShouldBeSwapped = false;
+#endif
+
 //------------------------------------------------------------------------------------------------------
 // The FFXFSR3ShaderMapContent structure allows access to the internals of FShaderMapContent so that FSR3 can swap the Default & Denoised variants of ScreenSpaceReflections.
 //------------------------------------------------------------------------------------------------------
@@ -1372,6 +1382,10 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 #endif
 	{
 		ITemporalUpscaler::FOutputs Outputs;
+		const uint64 PassesStartCycles = FPlatformTime::Cycles64();
+		// During a movie render each view state of the movie pipeline's view families keeps its own context, the movie pipeline gives every tile its own view state
+		const bool bMoviePipelineView = bMoviePipelineActive && View.State && View.Family && IsMoviePipelineViewFamily(*View.Family);
+		const uint32 MoviePipelineViewKey = bMoviePipelineView ? View.State->GetViewKey() : 0;
 
 		RDG_GPU_STAT_SCOPE(GraphBuilder, FidelityFXSuperResolution3Pass);
 		RDG_EVENT_SCOPE(GraphBuilder, "FidelityFXSuperResolution3Pass");
@@ -1779,7 +1793,26 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 			// We want to reuse FSR3 states rather than recreating them wherever possible as they allocate significant memory for their internal resources.
 			// The current custom history is the ideal, but the recently released states can be reused with a simple reset too when the engine cuts the history.
 			// This reduces the memory churn imposed by camera cuts.
-			if (HasValidContext)
+			if (bMoviePipelineView)
+			{
+				// Movie render tiles only ever use their own context, the available states may hold another tile's history
+				FScopeLock Lock(&Mutex);
+				HasValidContext = false;
+				bHistoryValid = false;
+				if (FSR3StateRef* TileState = MoviePipelineStates.Find(MoviePipelineViewKey))
+				{
+					ffxCreateContextDescUpscale const& CurrentParams = (*TileState)->Params;
+					if ((CurrentParams.maxRenderSize.width >= Params.maxRenderSize.width) && (CurrentParams.maxRenderSize.height >= Params.maxRenderSize.height) && (CurrentParams.maxUpscaleSize.width == Params.maxUpscaleSize.width) && (CurrentParams.maxUpscaleSize.height == Params.maxUpscaleSize.height) && (Params.flags == CurrentParams.flags))
+					{
+						FSR3State = *TileState;
+						HasValidContext = true;
+						bHistoryValid = View.ViewState && !View.bCameraCut;
+						MoviePipelineStats.NumContextsReused++;
+					}
+				}
+				MoviePipelineStats.NumHistoryResets += bHistoryValid ? 0 : 1;
+			}
+			else if (HasValidContext)
 			{
 				ffxCreateContextDescUpscale const& CurrentParams = CustomHistory->GetState()->Params;
 				if ((CustomHistory->GetState()->LastUsedFrame == GFrameCounterRenderThread) || (CurrentParams.maxRenderSize.width < Params.maxRenderSize.width) || (CurrentParams.maxRenderSize.height < Params.maxRenderSize.height) || (CurrentParams.maxUpscaleSize.width != Params.maxUpscaleSize.width) || (CurrentParams.maxUpscaleSize.height != Params.maxUpscaleSize.height) || (Params.flags != CurrentParams.flags))
@@ -1792,7 +1825,7 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 				}
 			}
 			
-			if (!HasValidContext)
+			if (!HasValidContext && !bMoviePipelineView)
 			{
 				FScopeLock Lock(&Mutex);
 				TSet<FSR3StateRef> DisposeStates;
@@ -1828,6 +1861,13 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 			{
 				// For a new context, allocate the necessary scratch memory for the chosen backend
 				FSR3State = new FFXFSR3State(ApiAccessor);
+
+				if (bMoviePipelineView)
+				{
+					FScopeLock Lock(&Mutex);
+					MoviePipelineStates.Add(MoviePipelineViewKey, FSR3State);
+					MoviePipelineStats.NumTiles = MoviePipelineStates.Num();
+				}
 			}
 
 			FSR3State->LastUsedFrame = GFrameCounterRenderThread;
@@ -1880,12 +1920,20 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 			//------------------------------------------------------
 			if (!HasValidContext)
 			{
+				const uint64 CreateStartCycles = FPlatformTime::Cycles64();
 				FfxErrorCode ErrorCode = ApiAccessor->ffxCreateContext(&FSR3State->Fsr3, &Params.header);
 				check(ErrorCode == FFX_OK);
 				if (ErrorCode == FFX_OK)
 				{
 					FMemory::Memcpy(FSR3State->Params, Params);
 				}
+
+				if (bMoviePipelineView)
+				{
+					FScopeLock Lock(&Mutex);
+					MoviePipelineStats.NumContextsCreated++;
+					MoviePipelineStats.ContextCreationMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - CreateStartCycles);
+				}
 			}
 		}
 
@@ -2112,6 +2160,12 @@ IFFXFSR3TemporalUpscaler::FOutputs FFXFSR3TemporalUpscaler::AddPasses(
 
 		DeferredCleanup(GFrameCounterRenderThread);
 
+		if (bMoviePipelineView)
+		{
+			FScopeLock Lock(&Mutex);
+			MoviePipelineStats.UpscalerPassesMs += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - PassesStartCycles);
+		}
+
 		return Outputs;
 	}
 #if UE_VERSION_OLDER_THAN(5, 3, 0)
@@ -2185,6 +2239,14 @@ void FFXFSR3TemporalUpscaler::SetSSRShader(FGlobalShaderMap* GlobalMap)
 		// Accessing SSRShaderMapSwapState is not thread-safe
 		check(IsInGameThread());
 
+#if !WITH_EDITOR
+		// The section content is compared too, a reloaded shader map section must be swapped again
+		if (GlobalMap == SSRLastGlobalMap && Section->GetContent() == SSRLastContent && bShouldBeSwapped == bSSRLastShouldBeSwapped)
+		{
+			return;
+		}
+#endif
+
 		FFXFSR3ShaderMapSwapState& ShaderMapSwapState = SSRShaderMapSwapState.FindOrAdd(GlobalMap, FFXFSR3ShaderMapSwapState::Default);
 		if (ShaderMapSwapState.Content != Section->GetContent())
 		{
@@ -2235,6 +2297,12 @@ void FFXFSR3TemporalUpscaler::SetSSRShader(FGlobalShaderMap* GlobalMap)
 
 			ShaderMapSwapState.bSwapped = bShouldBeSwapped;
 		}
+
+#if !WITH_EDITOR
+		SSRLastGlobalMap = GlobalMap;
+		SSRLastContent = Section->GetContent();
+		bSSRLastShouldBeSwapped = bShouldBeSwapped;
+#endif
 	}
 }
 
@@ -2303,6 +2371,46 @@ void FFXFSR3TemporalUpscaler::UpdateDynamicResolutionState()
 	GEngine->GetDynamicResolutionCurrentStateInfos(DynamicResolutionStateInfos);
 }
 
+//-------------------------------------------------------------------------------------
+// The movie render pipeline renders all tiles and spatial samples of a frame back to back, which would otherwise
+// thrash the FSR3 contexts. Instead each tile's view state keeps its own context, and with it its history across temporal samples.
+//-------------------------------------------------------------------------------------
+void FFXFSR3TemporalUpscaler::SetMoviePipelineActive(bool bActive)
+{
+	check(IsInGameThread());
+	FFXFSR3TemporalUpscaler* Upscaler = this;
+	ENQUEUE_RENDER_COMMAND(FFXFSR3SetMoviePipelineActive)([Upscaler, bActive](FRHICommandListImmediate& RHICmdList)
+	{
+		FScopeLock Lock(&Upscaler->Mutex);
+		if (!Upscaler->bMoviePipelineActive && bActive)
+		{
+			Upscaler->MoviePipelineStats = FFXFSR3MoviePipelineStats();
+		}
+		else if (!bActive)
+		{
+			Upscaler->MoviePipelineStates.Empty();
+		}
+		Upscaler->bMoviePipelineActive = bActive;
+	});
+}
+
+void FFXFSR3TemporalUpscaler::SetMoviePipelineViewExtension(TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> ViewExtension)
+{
+	check(IsInGameThread());
+	MoviePipelineViewExtension = ViewExtension;
+}
+
+bool FFXFSR3TemporalUpscaler::IsMoviePipelineViewFamily(const FSceneViewFamily& ViewFamily) const
+{
+	return MoviePipelineViewExtension.IsValid() && ViewFamily.ViewExtensions.Contains(MoviePipelineViewExtension.ToSharedRef());
+}
+
+FFXFSR3MoviePipelineStats FFXFSR3TemporalUpscaler::GetMoviePipelineStats() const
+{
+	FScopeLock Lock(&Mutex);
+	return MoviePipelineStats;
+}
+
 //-------------------------------------------------------------------------------------
 // In the Editor it is necessary to disable the view extension via the upscaler API so it doesn't cause conflicts.
 //-------------------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include "ScreenSpaceDenoise.h"
 #include "Containers/LockFreeList.h"
 #include "FFXFSR3TemporalUpscalerHistory.h"
+#include "FFXFSR3TemporalUpscaling.h"
 #include "FFXSharedBackend.h"
 
 #if UE_VERSION_AT_LEAST(5, 3, 0)
@@ -47,6 +48,8 @@ using FFXFSR3View = FViewInfo;
 
 struct FPostProcessingInputs;
 
+DECLARE_STATS_GROUP(TEXT("FSR3"), STATGROUP_FSR3, STATCAT_Advanced);
+
 //-------------------------------------------------------------------------------------
 // The core upscaler implementation for FSR3.
 // Implements IScreenSpaceDenoiser in order to access the reflection texture data.
@@ -104,6 +107,10 @@ public:
 
 	void UpdateDynamicResolutionState();
 
+	void SetMoviePipelineActive(bool bActive);
+	FFXFSR3MoviePipelineStats GetMoviePipelineStats() const;
+	void SetMoviePipelineViewExtension(TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> ViewExtension);
+
 #if WITH_EDITOR
 	bool IsEnabledInEditor() const;
 	void SetEnabledInEditor(bool bEnabled);
@@ -215,11 +222,18 @@ public:
 
 private:
 	void DeferredCleanup(uint64 FrameNum) const;
+	bool IsMoviePipelineViewFamily(const FSceneViewFamily& ViewFamily) const;
 
 	mutable FPostProcessingInputs PostInputs;
 	FDynamicResolutionStateInfos DynamicResolutionStateInfos;
 	mutable FCriticalSection Mutex;
 	mutable TSet<FSR3StateRef> AvailableStates;
+	// Movie render state, the flag is only accessed on the render thread, the rest under Mutex. The contexts are keyed by view state.
+	bool bMoviePipelineActive = false;
+	mutable TMap<uint32, FSR3StateRef> MoviePipelineStates;
+	mutable FFXFSR3MoviePipelineStats MoviePipelineStats;
+	// The movie pipeline adds this to the view families it renders, set once after creation
+	TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> MoviePipelineViewExtension;
 	mutable EFFXBackendAPI Api;
 	mutable class IFFXSharedBackend* ApiAccessor;
 	mutable class FRDGBuilder* CurrentGraphBuilder;
@@ -39,6 +39,13 @@
 #include "PostProcess/SceneRenderTargets.h"
 
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("FSR3: Upscaler interface allocations"), STAT_FSR3UpscalerAllocations, STATGROUP_FSR3);
+
+//------------------------------------------------------------------------------------------------------
+// Proxies are created on the game thread and deleted by the renderer once the view family is done with them.
+//------------------------------------------------------------------------------------------------------
+static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> FFXFSR3TemporalUpscalerProxyFreeList;
+
 //------------------------------------------------------------------------------------------------------
 // FFXFSR3TemporalUpscalerProxy implementation.
 //------------------------------------------------------------------------------------------------------
@@ -51,6 +58,26 @@ FFXFSR3TemporalUpscalerProxy::~FFXFSR3TemporalUpscalerProxy()
 {
 }
 
+void* FFXFSR3TemporalUpscalerProxy::operator new(size_t Size)
+{
+	check(Size == sizeof(FFXFSR3TemporalUpscalerProxy));
+	void* Ptr = FFXFSR3TemporalUpscalerProxyFreeList.Pop();
+	if (!Ptr)
+	{
+		INC_DWORD_STAT(STAT_FSR3UpscalerAllocations);
+		Ptr = FMemory::Malloc(sizeof(FFXFSR3TemporalUpscalerProxy), alignof(FFXFSR3TemporalUpscalerProxy));
+	}
+	return Ptr;
+}
+
+void FFXFSR3TemporalUpscalerProxy::operator delete(void* Ptr)
+{
+	if (Ptr)
+	{
+		FFXFSR3TemporalUpscalerProxyFreeList.Push(Ptr);
+	}
+}
+
 const TCHAR* FFXFSR3TemporalUpscalerProxy::GetDebugName() const
 {
 	return TemporalUpscaler->GetDebugName();
@@ -52,6 +52,10 @@ public:
 
 	IFFXFSR3TemporalUpscaler* Fork_GameThread(const class FSceneViewFamily& InViewFamily) const override;
 
+	// A proxy is handed to every view family each frame, recycle their memory rather than going through the allocator.
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
+
 	float GetMinUpsampleResolutionFraction() const override;
 	float GetMaxUpsampleResolutionFraction() const override;
 
@@ -23,8 +23,11 @@
 #include "FFXFSR3TemporalUpscaler.h"
 #include "FFXFSR3ViewExtension.h"
 #include "LogFFXFSR3.h"
+#include "FFXFSR3Settings.h"
+#include "IUpscalerDynamicResolutionBounds.h"
 
 #include "CoreMinimal.h"
+#include "Features/IModularFeatures.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/ConfigCacheIni.h"
 #if UE_VERSION_AT_LEAST(5, 1, 0)
@@ -45,6 +48,67 @@ DEFINE_LOG_CATEGORY(LogFSR3);
 
 static bool GFFXFSR3TemporalUpscalingModuleInit = false;
 
+//-------------------------------------------------------------------------------------
+// Keeps the shared dynamic resolution controller within the range of resolution fractions FSR3 supports.
+//-------------------------------------------------------------------------------------
+class FFXFSR3DynamicResolutionBounds final : public IUpscalerDynamicResolutionBounds
+{
+public:
+	FFXFSR3DynamicResolutionBounds(const FFXFSR3TemporalUpscalingModule* InModule)
+	: Module(InModule)
+	{
+	}
+
+	const TCHAR* GetDebugName() const override
+	{
+		return TEXT("FSR3");
+	}
+
+	bool IsActive() const override
+	{
+		const FFXFSR3TemporalUpscaler* Upscaler = Module->GetFSR3Upscaler();
+		return Upscaler && Upscaler->IsApiSupported() && CVarEnableFSR3.GetValueOnAnyThread();
+	}
+
+	float GetMinResolutionFraction() const override
+	{
+		return Module->GetFSR3Upscaler()->GetMinUpsampleResolutionFraction();
+	}
+
+	float GetMaxResolutionFraction() const override
+	{
+		return Module->GetFSR3Upscaler()->GetMaxUpsampleResolutionFraction();
+	}
+
+private:
+	const FFXFSR3TemporalUpscalingModule* Module;
+};
+
+static TUniquePtr<FFXFSR3DynamicResolutionBounds> GFFXFSR3DynamicResolutionBounds;
+
+//-------------------------------------------------------------------------------------
+// Does nothing itself, the FSR3MovieRenderPipeline plugin adds it to the view families it sets up so the upscaler can tell them apart.
+// Never active on its own, so it is not gathered into any other view family.
+//-------------------------------------------------------------------------------------
+class FFXFSR3MoviePipelineViewExtension final : public FSceneViewExtensionBase
+{
+public:
+	FFXFSR3MoviePipelineViewExtension(const FAutoRegister& AutoRegister)
+	: FSceneViewExtensionBase(AutoRegister)
+	{
+	}
+
+	void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+
+protected:
+	bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override
+	{
+		return false;
+	}
+};
+
 void FFXFSR3TemporalUpscalingModule::StartupModule()
 {
 	FString PluginFSR3ShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("FSR3"))->GetBaseDir(), TEXT("Source/fidelityfx-sdk/sdk/include/FidelityFX/gpu"));
@@ -58,6 +122,11 @@ void FFXFSR3TemporalUpscalingModule::StartupModule()
 
 void FFXFSR3TemporalUpscalingModule::ShutdownModule()
 {
+	if (GFFXFSR3DynamicResolutionBounds)
+	{
+		IModularFeatures::Get().UnregisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), GFFXFSR3DynamicResolutionBounds.Get());
+		GFFXFSR3DynamicResolutionBounds.Reset();
+	}
 	GFFXFSR3TemporalUpscalingModuleInit = false;
 	UE_LOG(LogFSR3, Log, TEXT("FSR3 Temporal Upscaling Module Shutdown"));
 }
@@ -75,6 +144,15 @@ void FFXFSR3TemporalUpscalingModule::SetTemporalUpscaler(TSharedPtr<FFXFSR3Tempo
 void FFXFSR3TemporalUpscalingModule::OnPostEngineInit()
 {
 	ViewExtension = FSceneViewExtensions::NewExtension<FFXFSR3ViewExtension>();
+
+	MoviePipelineViewExtension = FSceneViewExtensions::NewExtension<FFXFSR3MoviePipelineViewExtension>();
+	if (TemporalUpscaler.IsValid())
+	{
+		TemporalUpscaler->SetMoviePipelineViewExtension(MoviePipelineViewExtension);
+	}
+
+	GFFXFSR3DynamicResolutionBounds = MakeUnique<FFXFSR3DynamicResolutionBounds>(this);
+	IModularFeatures::Get().RegisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), GFFXFSR3DynamicResolutionBounds.Get());
 }
 
 FFXFSR3TemporalUpscaler* FFXFSR3TemporalUpscalingModule::GetFSR3Upscaler() const
@@ -109,4 +187,19 @@ void FFXFSR3TemporalUpscalingModule::SetEnabledInEditor(bool bEnabled)
 #endif
 }
 
+void FFXFSR3TemporalUpscalingModule::SetMoviePipelineActive(bool bActive)
+{
+	TemporalUpscaler->SetMoviePipelineActive(bActive);
+}
+
+FFXFSR3MoviePipelineStats FFXFSR3TemporalUpscalingModule::GetMoviePipelineStats() const
+{
+	return TemporalUpscaler->GetMoviePipelineStats();
+}
+
+TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> FFXFSR3TemporalUpscalingModule::GetMoviePipelineViewExtension() const
+{
+	return MoviePipelineViewExtension;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -32,28 +32,54 @@
 #include "Engine/StaticMesh.h"
 #include "LandscapeProxy.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/Engine.h"
 
-static void ForceLandscapeHISMMobility(FSceneViewFamily& InViewFamily, ALandscapeProxy* Landscape)
+DECLARE_DWORD_COUNTER_STAT(TEXT("FSR3: Landscape grass components examined"), STAT_FSR3LandscapeGrassComponentsExamined, STATGROUP_FSR3);
+
+bool FFXFSR3ViewExtension::MaterialModifiesMeshPosition(const UMaterial* Material, ERHIFeatureLevel::Type FeatureLevel)
 {
+	check(IsInGameThread());
+	// The material resource, and so the answer, differs per feature level, e.g. with the editor's preview platform.
+	const TPair<TObjectKey<UMaterial>, ERHIFeatureLevel::Type> Key(Material, FeatureLevel);
+	if (bool* Cached = MaterialModifiesMeshPositionCache.Find(Key))
+	{
+		return *Cached;
+	}
+
+	// Only remember the answer once the material resource exists, otherwise ask again next time the component is visited.
+	bool bModifiesMeshPosition = false;
+	if (const FMaterialResource* MaterialResource = Material->GetMaterialResource(FeatureLevel))
+	{
+		bModifiesMeshPosition = MaterialResource->MaterialModifiesMeshPosition_GameThread();
+		MaterialModifiesMeshPositionCache.Add(Key, bModifiesMeshPosition);
+	}
+	return bModifiesMeshPosition;
+}
+
+uint32 FFXFSR3ViewExtension::ForceLandscapeProxyHISMMobility(FSceneViewFamily& InViewFamily, ALandscapeProxy* Landscape, int32 Mode)
+{
+	uint32 NumExamined = 0;
 	for (FCachedLandscapeFoliage::TGrassSet::TIterator Iter(Landscape->FoliageCache.CachedGrassComps); Iter; ++Iter)
 	{
+		NumExamined++;
 		ULandscapeComponent* Component = (*Iter).Key.BasedOn.Get();
 		if (Component)
 		{
 			UHierarchicalInstancedStaticMeshComponent* Used = (*Iter).Foliage.Get();
 			if (Used && Used->Mobility == EComponentMobility::Static)
 			{
-				if (CVarFSR3ForceLandscapeHISMMobility.GetValueOnGameThread() == 2)
+				if (Mode == 2)
 				{
-					TArray<FStaticMaterial> const& Materials = Used->GetStaticMesh()->GetStaticMaterials();
-					for (auto MaterialInfo : Materials)
+					UStaticMesh* StaticMesh = Used->GetStaticMesh();
+					if (StaticMesh)
 					{
-						const UMaterial* Material = MaterialInfo.MaterialInterface->GetMaterial_Concurrent();
-						if (const FMaterialResource* MaterialResource = Material->GetMaterialResource(InViewFamily.GetFeatureLevel()))
+						TArray<FStaticMaterial> const& Materials = StaticMesh->GetStaticMaterials();
+						for (auto const& MaterialInfo : Materials)
 						{
-							check(IsInGameThread());
-							bool bAlwaysHasVelocity = MaterialResource->MaterialModifiesMeshPosition_GameThread();
-							if (bAlwaysHasVelocity)
+							const UMaterial* Material = MaterialInfo.MaterialInterface ? MaterialInfo.MaterialInterface->GetMaterial_Concurrent() : nullptr;
+							if (Material && MaterialModifiesMeshPosition(Material, InViewFamily.GetFeatureLevel()))
 							{
 								Used->Mobility = EComponentMobility::Stationary;
 								break;
@@ -68,6 +94,126 @@ static void ForceLandscapeHISMMobility(FSceneViewFamily& InViewFamily, ALandscap
 			}
 		}
 	}
+	return NumExamined;
+}
+
+void FFXFSR3ViewExtension::ForceLandscapeHISMMobility(FSceneViewFamily& InViewFamily)
+{
+	int32 Mode = CVarFSR3ForceLandscapeHISMMobility.GetValueOnGameThread();
+	if (Mode != LandscapeHISMMode)
+	{
+		// Switching between 'All Instances' and 'Instances with World-Position-Offset' needs every proxy revisited.
+		LandscapeHISMMode = Mode;
+		for (FLandscapeGrassState& State : LandscapeProxies)
+		{
+			State.NumGrassComps = INDEX_NONE;
+		}
+	}
+
+	if (bLandscapeProxiesDirty)
+	{
+		// Only done once to pick up proxies loaded before this extension existed, the level and actor events keep the list current afterwards.
+		bLandscapeProxiesDirty = false;
+		LandscapeProxies.Reset();
+		for (ALandscapeProxy* Landscape : TObjectRange<ALandscapeProxy>(RF_ClassDefaultObject | RF_ArchetypeObject, true, EInternalObjectFlags::Garbage))
+		{
+			AddLandscapeProxy(Landscape);
+		}
+	}
+
+	// Grass components are created and recycled by the landscape as the camera moves, so only walk a proxy when its grass set has changed size.
+	// One proxy per frame is always revisited to catch a component being replaced without the count changing.
+	uint32 NumExamined = 0;
+	LandscapeRevalidateIndex = LandscapeProxies.Num() ? (LandscapeRevalidateIndex + 1) % LandscapeProxies.Num() : 0;
+	for (int32 Index = LandscapeProxies.Num() - 1; Index >= 0; Index--)
+	{
+		FLandscapeGrassState& State = LandscapeProxies[Index];
+		ALandscapeProxy* Landscape = State.Proxy.Get();
+		if (!Landscape)
+		{
+			LandscapeProxies.RemoveAtSwap(Index);
+			continue;
+		}
+
+		int32 NumGrassComps = Landscape->FoliageCache.CachedGrassComps.Num();
+		if (NumGrassComps != State.NumGrassComps || Index == LandscapeRevalidateIndex)
+		{
+			State.NumGrassComps = NumGrassComps;
+			NumExamined += ForceLandscapeProxyHISMMobility(InViewFamily, Landscape, Mode);
+		}
+	}
+	SET_DWORD_STAT(STAT_FSR3LandscapeGrassComponentsExamined, NumExamined);
+}
+
+void FFXFSR3ViewExtension::AddLandscapeProxy(ALandscapeProxy* Landscape)
+{
+	if (Landscape && !Landscape->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		for (FLandscapeGrassState const& State : LandscapeProxies)
+		{
+			if (State.Proxy.Get() == Landscape)
+			{
+				return;
+			}
+		}
+		FLandscapeGrassState State;
+		State.Proxy = Landscape;
+		State.NumGrassComps = INDEX_NONE;
+		LandscapeProxies.Add(State);
+	}
+}
+
+void FFXFSR3ViewExtension::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (Level && !bLandscapeProxiesDirty)
+	{
+		for (AActor* Actor : Level->Actors)
+		{
+			AddLandscapeProxy(Cast<ALandscapeProxy>(Actor));
+		}
+	}
+}
+
+void FFXFSR3ViewExtension::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	// A null level means the whole world is going away, so start over from a full sweep.
+	if (!Level)
+	{
+		bLandscapeProxiesDirty = true;
+		return;
+	}
+
+	LandscapeProxies.RemoveAllSwap([Level](FLandscapeGrassState const& State)
+	{
+		ALandscapeProxy* Landscape = State.Proxy.Get();
+		return !Landscape || Landscape->GetLevel() == Level;
+	});
+}
+
+void FFXFSR3ViewExtension::OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params)
+{
+	if (Params.World && !bLandscapeProxiesDirty)
+	{
+		for (ULevel* Level : Params.World->GetLevels())
+		{
+			OnLevelAddedToWorld(Level, Params.World);
+		}
+	}
+}
+
+void FFXFSR3ViewExtension::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	// The world's materials may be unloaded along with it, so don't let the cache outlive it.
+	MaterialModifiesMeshPositionCache.Empty();
+	bLandscapeProxiesDirty = true;
+}
+
+void FFXFSR3ViewExtension::OnLevelActorAdded(AActor* Actor)
+{
+	if (!bLandscapeProxiesDirty)
+	{
+		AddLandscapeProxy(Cast<ALandscapeProxy>(Actor));
+	}
 }
 
 FFXFSR3ViewExtension::FFXFSR3ViewExtension(const FAutoRegister& AutoRegister) : FSceneViewExtensionBase(AutoRegister)
@@ -90,6 +236,18 @@ FFXFSR3ViewExtension::FFXFSR3ViewExtension(const FAutoRegister& AutoRegister) :
 	SeparateTranslucency = CVarSeparateTranslucency ? CVarSeparateTranslucency->GetInt() : 0;
 	SSRExperimentalDenoiser = CVarSSRExperimentalDenoiser ? CVarSSRExperimentalDenoiser->GetInt() : 0;
 
+	LandscapeRevalidateIndex = 0;
+	LandscapeHISMMode = 0;
+	bLandscapeProxiesDirty = true;
+	LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddRaw(this, &FFXFSR3ViewExtension::OnLevelAddedToWorld);
+	LevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddRaw(this, &FFXFSR3ViewExtension::OnLevelRemovedFromWorld);
+	WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddRaw(this, &FFXFSR3ViewExtension::OnWorldInitializedActors);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FFXFSR3ViewExtension::OnWorldCleanup);
+	if (GEngine)
+	{
+		LevelActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(this, &FFXFSR3ViewExtension::OnLevelActorAdded);
+	}
+
 	IFFXFSR3TemporalUpscalingModule& FSR3ModuleInterface = FModuleManager::GetModuleChecked<IFFXFSR3TemporalUpscalingModule>(TEXT("FFXFSR3TemporalUpscaling"));
 	if (FSR3ModuleInterface.GetTemporalUpscaler() == nullptr)
 	{
@@ -99,6 +257,18 @@ FFXFSR3ViewExtension::FFXFSR3ViewExtension(const FAutoRegister& AutoRegister) :
 	}
 }
 
+FFXFSR3ViewExtension::~FFXFSR3ViewExtension()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedFromWorldHandle);
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(LevelActorAddedHandle);
+	}
+}
+
 void FFXFSR3ViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
 {
 	if (InViewFamily.GetFeatureLevel() >= ERHIFeatureLevel::SM6)
@@ -198,10 +368,7 @@ void FFXFSR3ViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
 			{
 				// Landscape Hierarchical Instanced Static Mesh components are usually foliage and thus might use WPO.
 				// To make it generate motion vectors it can't be Static which is hard-coded into the Engine.
-				for (ALandscapeProxy* Landscape : TObjectRange<ALandscapeProxy>(RF_ClassDefaultObject | RF_ArchetypeObject, true, EInternalObjectFlags::Garbage))
-				{
-					ForceLandscapeHISMMobility(InViewFamily, Landscape);
-				}
+				ForceLandscapeHISMMobility(InViewFamily);
 			}
 		}
 
@@ -305,17 +472,18 @@ void FFXFSR3ViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 		FFXFSR3TemporalUpscaler* Upscaler = FSR3ModuleInterface.GetFSR3Upscaler();
 		bool IsTemporalUpscalingRequested = false;
 		bool bIsGameView = !WITH_EDITOR;
+		// All views in the family share the feature level and so the global shader map, only update the SSR shaders once.
+		if (Upscaler)
+		{
+			FGlobalShaderMap* GlobalMap = GetGlobalShaderMap(InViewFamily.GetFeatureLevel());
+			Upscaler->SetSSRShader(GlobalMap);
+		}
+
 		for (int i = 0; i < InViewFamily.Views.Num(); i++)
 		{
 			const FSceneView* InView = InViewFamily.Views[i];
 			if (ensure(InView))
 			{
-				if (Upscaler)
-				{
-					FGlobalShaderMap* GlobalMap = GetGlobalShaderMap(InViewFamily.GetFeatureLevel());
-					Upscaler->SetSSRShader(GlobalMap);
-				}
-
 				bIsGameView |= InView->bIsGameView;
 
 				// Don't run FSR3 if Temporal Upscaling is unused.
@@ -27,6 +27,7 @@
 
 class FFXFSR3TemporalUpscaler;
 class FFXFSR3ViewExtension;
+class ISceneViewExtension;
 #if UE_VERSION_AT_LEAST(5, 3, 0)
 #include "TemporalUpscaler.h"
 using IFFXFSR3TemporalUpscaler = UE::Renderer::Private::ITemporalUpscaler;
@@ -35,6 +36,19 @@ using IFFXFSR3TemporalUpscaler = UE::Renderer::Private::ITemporalUpscaler;
 using IFFXFSR3TemporalUpscaler = ITemporalUpscaler;
 #endif
 
+//-------------------------------------------------------------------------------------
+// Where FSR3 spent its time during a movie render, the FSR3MovieRenderPipeline plugin writes it to the output metadata.
+//-------------------------------------------------------------------------------------
+struct FFXFSR3MoviePipelineStats
+{
+	uint32 NumTiles = 0;
+	uint32 NumContextsCreated = 0;
+	uint32 NumContextsReused = 0;
+	uint32 NumHistoryResets = 0;
+	double ContextCreationMs = 0.0;
+	double UpscalerPassesMs = 0.0;
+};
+
 //-------------------------------------------------------------------------------------
 // In order for the FSR3 plugin to support the movie render pipeline some functions have to be exposed.
 // This allows the separate FSR3MovieRenderPipeline to behave consistently with the main FSR3 plugin.
@@ -47,6 +61,15 @@ public:
 	virtual float GetResolutionFraction(uint32 Mode) const = 0;
 	virtual bool IsPlatformSupported(EShaderPlatform Platform) const = 0;
 	virtual void SetEnabledInEditor(bool bEnabled) = 0;
+
+	// While a movie render is active each view state, and so each movie render tile, keeps its own persistent context and history.
+	// Call on the game thread before the view family is rendered, false ends the movie render and releases the contexts.
+	virtual void SetMoviePipelineActive(bool bActive) = 0;
+	virtual FFXFSR3MoviePipelineStats GetMoviePipelineStats() const = 0;
+
+	// Marks a view family as rendered by the movie pipeline, add it to ViewFamily.ViewExtensions in SetupViewFamily.
+	// Only views of marked families get the per view state contexts, editor and PIE viewports rendering at the same time keep the regular ones.
+	virtual TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> GetMoviePipelineViewExtension() const = 0;
 };
 
 class FFXFSR3TemporalUpscalingModule final : public IFFXFSR3TemporalUpscalingModule
@@ -67,8 +90,12 @@ public:
 	float GetResolutionFraction(uint32 Mode) const;
 	bool IsPlatformSupported(EShaderPlatform Platform) const;
 	void SetEnabledInEditor(bool bEnabled);
+	void SetMoviePipelineActive(bool bActive);
+	FFXFSR3MoviePipelineStats GetMoviePipelineStats() const;
+	TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> GetMoviePipelineViewExtension() const;
 
 private:
 	TSharedPtr<FFXFSR3TemporalUpscaler, ESPMode::ThreadSafe> TemporalUpscaler;
 	TSharedPtr<FFXFSR3ViewExtension, ESPMode::ThreadSafe> ViewExtension;
+	TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> MoviePipelineViewExtension;
 };
\ No newline at end of file
@@ -23,6 +23,8 @@
 
 #include "SceneViewExtension.h"
 #include "FFXShared.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/World.h"
 
 #if UE_VERSION_AT_LEAST(5, 1, 0)
 typedef FRDGBuilder FRenderGraphType;
@@ -30,10 +32,16 @@ typedef FRDGBuilder FRenderGraphType;
 typedef FRHICommandListImmediate FRenderGraphType;
 #endif
 
+class ALandscapeProxy;
+class UMaterial;
+class ULevel;
+class AActor;
+
 class FFXFSR3TEMPORALUPSCALING_API FFXFSR3ViewExtension final : public FSceneViewExtensionBase
 {
 public:
 	FFXFSR3ViewExtension(const FAutoRegister& AutoRegister);
+	~FFXFSR3ViewExtension();
 
 	// ISceneViewExtension interface
 	void SetupViewFamily(FSceneViewFamily& InViewFamily) override;
@@ -46,6 +54,33 @@ public:
 	void PrePostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessingInputs& Inputs) override;
 
 private:
+	// Landscape grass mobility fix-up, driven by level/actor events rather than a per-frame object sweep.
+	void ForceLandscapeHISMMobility(FSceneViewFamily& InViewFamily);
+	uint32 ForceLandscapeProxyHISMMobility(FSceneViewFamily& InViewFamily, ALandscapeProxy* Landscape, int32 Mode);
+	bool MaterialModifiesMeshPosition(const UMaterial* Material, ERHIFeatureLevel::Type FeatureLevel);
+	void AddLandscapeProxy(ALandscapeProxy* Landscape);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+	void OnWorldInitializedActors(const UWorld::FActorsInitializedParams& Params);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void OnLevelActorAdded(AActor* Actor);
+
+	struct FLandscapeGrassState
+	{
+		TWeakObjectPtr<ALandscapeProxy> Proxy;
+		int32 NumGrassComps;
+	};
+	TArray<FLandscapeGrassState> LandscapeProxies;
+	TMap<TPair<TObjectKey<UMaterial>, ERHIFeatureLevel::Type>, bool> MaterialModifiesMeshPositionCache;
+	int32 LandscapeRevalidateIndex;
+	int32 LandscapeHISMMode;
+	bool bLandscapeProxiesDirty;
+	FDelegateHandle LevelAddedToWorldHandle;
+	FDelegateHandle LevelRemovedFromWorldHandle;
+	FDelegateHandle WorldInitializedActorsHandle;
+	FDelegateHandle WorldCleanupHandle;
+	FDelegateHandle LevelActorAddedHandle;
+
 	int32 PreviousFSR3State;
 	int32 PreviousFSR3StateRT;
 	int32 CurrentFSR3StateRT;
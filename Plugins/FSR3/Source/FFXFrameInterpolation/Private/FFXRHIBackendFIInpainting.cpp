@@ -80,7 +80,7 @@ public:
 	static const wchar_t** GetBoundSRVNames()
 	{
 		static const wchar_t* SRVs[] = {
-			L"r_optical_flow_scd ",
+			L"r_optical_flow_scd",
 			L"r_inpainting_pyramid",
 			L"r_present_backbuffer",
 			L"r_current_interpolation_source"
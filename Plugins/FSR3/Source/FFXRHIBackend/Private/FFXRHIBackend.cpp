@@ -427,7 +427,9 @@ static FfxErrorCode CreatePipeline_UE(FfxInterface* backendInterface, FfxEffect
 static FfxErrorCode ScheduleRenderJob_UE(FfxInterface* backendInterface, const FfxGpuJobDescription* job)
 {
 	FFXBackendState* backendContext = (FFXBackendState*)backendInterface->scratchBuffer;
-	backendContext->Jobs[backendContext->NumJobs] = *job;
+	check(backendContext->NumJobs < FFX_MAX_JOB_COUNT);
+	// Only copy the part of the union the job type actually uses; compute jobs are by far the largest.
+	FMemory::Memcpy(&backendContext->Jobs[backendContext->NumJobs], job, ffxGetGpuJobDescriptionSize(job));
 	if (job->jobType == FFX_GPU_JOB_COMPUTE)
 	{
 		// needs to copy SRVs and UAVs in case they are on the stack only
@@ -444,6 +446,17 @@ static FfxErrorCode ScheduleRenderJob_UE(FfxInterface* backendInterface, const F
 	return FFX_OK;
 }
 
+static FfxErrorCode ScheduleRenderJobs_UE(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount)
+{
+	FFXBackendState* backendContext = (FFXBackendState*)backendInterface->scratchBuffer;
+	check(backendContext->NumJobs + jobCount <= FFX_MAX_JOB_COUNT);
+	for (uint32_t JobIndex = 0; JobIndex < jobCount; JobIndex++)
+	{
+		ScheduleRenderJob_UE(backendInterface, &jobs[JobIndex]);
+	}
+	return FFX_OK;
+}
+
 static FfxErrorCode FlushRenderJobs_UE(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId)
 {
 	FfxErrorCode Result = FFX_OK;
@@ -873,6 +886,7 @@ FfxErrorCode ffxGetInterfaceUE(FfxInterface* outInterface, void* scratchBuffer,
 	outInterface->fpCreatePipeline = CreatePipeline_UE;
 	outInterface->fpDestroyPipeline = DestroyPipeline_UE;
 	outInterface->fpScheduleGpuJob = ScheduleRenderJob_UE;
+	outInterface->fpScheduleGpuJobs = ScheduleRenderJobs_UE;
 	outInterface->fpExecuteGpuJobs = FlushRenderJobs_UE;
 
 	outInterface->fpBreadcrumbsAllocBlock = BreadcrumbsAllocBlock_UE;
@@ -101,8 +101,9 @@ public:
 
 		ClearUnusedGraphResources(ComputeShader, Parameters);
 
+		// Name each pass after its job label (e.g. "OF 3 Search") so the GPU profiler attributes time per pass
 		GraphBuilder.AddPass(
-			FRDGEventName(Name),
+			job->jobLabel[0] ? FRDGEventName(TEXT("%s"), WCHAR_TO_TCHAR(job->jobLabel)) : FRDGEventName(Name),
 			Parameters,
 			ERDGPassFlags::Compute,
 			[Parameters, ComputeShader, DispatchCount](FRHIComputeCommandList& RHICmdList)
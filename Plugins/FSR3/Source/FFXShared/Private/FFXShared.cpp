@@ -33,6 +33,7 @@ THIRD_PARTY_INCLUDES_START
 #include "shared/ffx_assert.cpp"
 #include "shared/ffx_breadcrumbs_list.cpp"
 #include "shared/ffx_object_management.cpp"
+#include "shared/ffx_upscaler_tables.cpp"
 
 THIRD_PARTY_INCLUDES_END
 #if PLATFORM_WINDOWS
@@ -26,9 +26,12 @@
 #include "ffx_provider_fsr3upscale.h"
 #include "ffx_provider_framegeneration.h"
 #include "ffx_provider_external.h"
+#include "ffx_provider_cache.h"
 
 #include <array>
 #include <optional>
+#include <mutex>
+#include <unordered_set>
 
 #include <d3d12.h>
 
@@ -55,6 +58,14 @@ static constexpr size_t providerCount = _countof(providers);
 
 static std::array<std::optional<ffxProviderExternal>, 10> externalProviders = {};
 
+// Resolution results per (descriptor type, version override). The provider set only changes when
+// the driver hands out a new external provider, which rebuilds the list and clears the cache.
+static std::mutex       providerCacheMutex;
+static ffxProviderCache providerCache;
+
+// Descriptor types the driver extension has already been asked about
+static std::unordered_set<ffxStructType_t> externalProviderQueries;
+
 MIDL_INTERFACE("b58d6601-7401-4234-8180-6febfc0e484c")
 IAmdExtFfxApi : public IUnknown
 {
@@ -71,7 +82,8 @@ struct ExternalProviderData
 };
 #define FFX_EXTERNAL_PROVIDER_STRUCT_VERSION 1u
 
-void GetExternalProviders(ID3D12Device* device, uint64_t descType)
+// Must be called with providerCacheMutex held. Returns true if a new external provider was added.
+static bool GetExternalProviders(ID3D12Device* device, uint64_t descType)
 {
     static IAmdExtFfxApi* apiExtension = nullptr;
 
@@ -103,14 +115,15 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
         }
     }
 
-    if (apiExtension)
+    // the driver only has to be asked once per descriptor type
+    if (apiExtension && externalProviderQueries.insert(descType).second)
     {
         ExternalProviderData data;
         data.structVersion = FFX_EXTERNAL_PROVIDER_STRUCT_VERSION;
         data.descType = descType;
         HRESULT hr = apiExtension->UpdateFfxApiProvider(&data, sizeof(data));
         if (hr != S_OK)
-            return;
+            return false;
 
         for (auto& slot : externalProviders)
         {
@@ -124,41 +137,41 @@ void GetExternalProviders(ID3D12Device* device, uint64_t descType)
                 // first free slot. slots are filled start to end and never released.
                 // we do not have this provider yet, add it to the list.
                 slot = ffxProviderExternal{data.provider};
-                break;
+                return true;
             }
         }
     }
-    
+
+    return false;
 }
 
-const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
+// Must be called with providerCacheMutex held. External providers take precedence over the built-in ones.
+static void UpdateProviderList(ID3D12Device* device, uint64_t descType)
 {
-    // check driver-side providers
-    GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
+    if (!GetExternalProviders(device, descType) && !providerCache.GetProviders().empty())
+        return;
 
+    std::array<const ffxProvider*, externalProviders.size() + providerCount> providerList;
+    size_t listCount = 0;
     for (const auto& provider : externalProviders)
     {
         if (provider.has_value())
-        {
-            if (provider->GetId() == overrideId || (overrideId == 0 && provider->CanProvide(descType)))
-                return &*provider;
-        }
+            providerList[listCount++] = &*provider;
     }
-
     for (size_t i = 0; i < providerCount; ++i)
-    {
-        if (providers[i]->GetId() == overrideId || (overrideId == 0 && providers[i]->CanProvide(descType)))
-            return providers[i];
-    }
+        providerList[listCount++] = providers[i];
 
-    return nullptr;
+    providerCache.SetProviders(providerList.data(), listCount);
 }
 
-const ffxProvider* GetAssociatedProvider(ffxContext* context)
+const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device)
 {
-    const InternalContextHeader* hdr = (const InternalContextHeader*)(*context);
-    const ffxProvider*        provider = hdr->provider;
-    return provider;
+    std::lock_guard<std::mutex> lock(providerCacheMutex);
+
+    // check driver-side providers
+    UpdateProviderList(reinterpret_cast<ID3D12Device*>(device), descType);
+
+    return providerCache.Find(descType, overrideId);
 }
 
 uint64_t GetProviderCount(ffxStructType_t descType, void* device)
@@ -170,13 +183,15 @@ uint64_t GetProviderVersions(ffxStructType_t descType, void* device, uint64_t ca
 {
     uint64_t count = 0;
 
+    std::lock_guard<std::mutex> lock(providerCacheMutex);
+
     // check driver-side providers
-    GetExternalProviders(reinterpret_cast<ID3D12Device*>(device), descType);
+    UpdateProviderList(reinterpret_cast<ID3D12Device*>(device), descType);
 
-    for (const auto& provider : externalProviders)
+    for (const ffxProvider* provider : providerCache.GetProviders())
     {
         if (count >= capacity) break;
-        if (provider.has_value() && provider->CanProvide(descType))
+        if (provider->CanProvide(descType))
         {
             auto index = count;
             count++;
@@ -187,19 +202,5 @@ uint64_t GetProviderVersions(ffxStructType_t descType, void* device, uint64_t ca
         }
     }
 
-    for (size_t i = 0; i < providerCount; ++i)
-    {
-        if (count >= capacity) break;
-        if (providers[i]->CanProvide(descType))
-        {
-            auto index = count;
-            count++;
-            if (versionIds)
-                versionIds[index] = providers[i]->GetId();
-            if (versionNames)
-                versionNames[index] = providers[i]->GetVersionName();
-        }
-    }
-
     return count;
 }
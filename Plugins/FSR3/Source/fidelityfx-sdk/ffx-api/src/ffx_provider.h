@@ -23,7 +23,11 @@
 #pragma once
 #include <ffx_api/ffx_api.hpp>
 #include <ffx_api/ffx_api_types.h>
-#include <FidelityFx/host/ffx_types.h>
+#include <FidelityFX/host/ffx_types.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
 
 #define VERIFY(_cond, _retcode) \
     if (!(_cond)) return _retcode
@@ -89,8 +93,6 @@ public:
 
 const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void* device);
 
-const ffxProvider* GetAssociatedProvider(ffxContext* context);
-
 uint64_t GetProviderCount(ffxStructType_t descType, void* device);
 
 uint64_t GetProviderVersions(ffxStructType_t descType, void* device, uint64_t capacity, uint64_t* versionIds, const char** versionNames);
@@ -100,6 +102,12 @@ struct InternalContextHeader
     const ffxProvider* provider;
 };
 
+// Every context starts with its provider, so calls on an existing context skip provider resolution.
+inline const ffxProvider* GetAssociatedProvider(ffxContext* context)
+{
+    return ((const InternalContextHeader*)(*context))->provider;
+}
+
 template<typename T>
 static inline T ConvertEnum(uint32_t enumVal)
 {
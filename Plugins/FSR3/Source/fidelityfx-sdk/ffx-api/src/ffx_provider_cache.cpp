@@ -0,0 +1,52 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "ffx_provider_cache.h"
+
+void ffxProviderCache::SetProviders(const ffxProvider* const* newProviders, size_t providerCount)
+{
+    providers.assign(newProviders, newProviders + providerCount);
+    resolved.clear();
+}
+
+const ffxProvider* ffxProviderCache::Find(ffxStructType_t descType, uint64_t overrideId)
+{
+    const Key key{descType, overrideId};
+    auto cached = resolved.find(key);
+    if (cached != resolved.end())
+        return cached->second;
+
+    const ffxProvider* provider = Resolve(descType, overrideId);
+    resolved.emplace(key, provider);
+    return provider;
+}
+
+const ffxProvider* ffxProviderCache::Resolve(ffxStructType_t descType, uint64_t overrideId) const
+{
+    for (const ffxProvider* provider : providers)
+    {
+        if (provider->GetId() == overrideId || (overrideId == 0 && provider->CanProvide(descType)))
+            return provider;
+    }
+
+    return nullptr;
+}
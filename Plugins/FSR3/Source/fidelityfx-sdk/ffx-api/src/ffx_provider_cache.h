@@ -0,0 +1,71 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+#include "ffx_provider.h"
+
+#include <unordered_map>
+#include <vector>
+
+// Resolves (descriptor type, version override) pairs to providers and remembers the result.
+// Not thread safe, callers hold their own lock.
+class ffxProviderCache
+{
+public:
+    // Replaces the provider list, in resolution order, and drops all cached resolutions.
+    void SetProviders(const ffxProvider* const* providers, size_t providerCount);
+
+    // Returns the provider with id overrideId, or the first one that can provide descType if overrideId is 0.
+    // Only the first lookup of a pair walks the provider list.
+    const ffxProvider* Find(ffxStructType_t descType, uint64_t overrideId);
+
+    // The same resolution as Find, without the cache.
+    const ffxProvider* Resolve(ffxStructType_t descType, uint64_t overrideId) const;
+
+    const std::vector<const ffxProvider*>& GetProviders() const
+    {
+        return providers;
+    }
+
+private:
+    struct Key
+    {
+        ffxStructType_t descType;
+        uint64_t        overrideId;
+
+        bool operator==(const Key& other) const
+        {
+            return descType == other.descType && overrideId == other.overrideId;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            return std::hash<uint64_t>()(key.descType) ^ (std::hash<uint64_t>()(key.overrideId) * 31);
+        }
+    };
+
+    std::vector<const ffxProvider*>                      providers;
+    std::unordered_map<Key, const ffxProvider*, KeyHash> resolved;
+};
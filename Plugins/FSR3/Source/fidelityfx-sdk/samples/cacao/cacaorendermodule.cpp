@@ -125,7 +125,6 @@ void CACAORenderModule::DestroyCacaoContexts()
 
     // Destroy CACAO Contexts
     ffxCacaoContextDestroy(&m_CacaoContext);
-    ffxCacaoContextDestroy(&m_CacaoDownsampledContext);
 }
 
 void CACAORenderModule::OnResize(const ResolutionInfo& resInfo)
@@ -165,7 +164,7 @@ void CACAORenderModule::Execute(double deltaTime, CommandList* pCmdList)
     }
 
     m_CacaoSettings.generateNormals = m_GenerateNormals;
-    FfxErrorCode errorCode = ffxCacaoUpdateSettings(m_UseDownsampledSSAO ? &m_CacaoDownsampledContext : &m_CacaoContext, &m_CacaoSettings, m_UseDownsampledSSAO);
+    FfxErrorCode errorCode = ffxCacaoUpdateSettings(&m_CacaoContext, &m_CacaoSettings, m_UseDownsampledSSAO);
     CauldronAssert(ASSERT_CRITICAL, errorCode == FFX_OK, L"Error returned from ffxCacaoUpdateSettings");
 
     FfxCacaoDispatchDescription dispatchDescription = {};
@@ -177,7 +176,7 @@ void CACAORenderModule::Execute(double deltaTime, CommandList* pCmdList)
     dispatchDescription.normalsToView = &normalsWorldToView;
     dispatchDescription.normalUnpackMul = 2;
     dispatchDescription.normalUnpackAdd = -1;
-    errorCode = ffxCacaoContextDispatch(m_UseDownsampledSSAO ? &m_CacaoDownsampledContext : &m_CacaoContext, &dispatchDescription);
+    errorCode = ffxCacaoContextDispatch(&m_CacaoContext, &dispatchDescription);
     CauldronAssert(ASSERT_CRITICAL, errorCode == FFX_OK, L"Error returned from ffxCacaoContextDispatch");
 
     // FidelityFX contexts modify the set resource view heaps, so set the cauldron one back
@@ -220,10 +219,10 @@ void CACAORenderModule::InitSdkContexts()
         m_FfxInterface.scratchBuffer = nullptr;
     }
 
-    const size_t scratchBufferSize = SDKWrapper::ffxGetScratchMemorySize(FFX_CACAO_CONTEXT_COUNT * 2);
+    const size_t scratchBufferSize = SDKWrapper::ffxGetScratchMemorySize(FFX_CACAO_CONTEXT_COUNT);
     void* scratchBuffer            = calloc(scratchBufferSize, 1u);
     FfxErrorCode errorCode         = SDKWrapper::ffxGetInterface(&m_FfxInterface, GetDevice(), scratchBuffer, 
-                                                     scratchBufferSize, FFX_CACAO_CONTEXT_COUNT * 2);
+                                                     scratchBufferSize, FFX_CACAO_CONTEXT_COUNT);
     CauldronAssert(ASSERT_CRITICAL, errorCode == FFX_OK, L"Could not initialize FidelityFX SDK backend context.");
     CauldronAssert(ASSERT_CRITICAL, m_FfxInterface.fpGetSDKVersion(&m_FfxInterface) == FFX_SDK_MAKE_VERSION(1, 1, 1),
         L"FidelityFX CACAO 2.1 sample requires linking with a 1.1.1 version SDK backend");
@@ -302,12 +301,10 @@ void CACAORenderModule::CreateCacaoContexts(const ResolutionInfo& resInfo)
     description.backendInterface           = m_FfxInterface;
     description.width                      = resInfo.RenderWidth;
     description.height                     = resInfo.RenderHeight;
-    description.useDownsampledSsao         = false;
+    description.useDownsampledSsao         = m_UseDownsampledSSAO;
+    description.allowSsaoResolutionSwitch  = true;  // The UI toggles downsampled SSAO live
     FfxErrorCode errorCode                 = ffxCacaoContextCreate(&m_CacaoContext, &description);
     CauldronAssert(ASSERT_CRITICAL, errorCode == FFX_OK, L"Could not initialize FidelityFX SDK backend context.");
-    description.useDownsampledSsao = true;
-    errorCode = ffxCacaoContextCreate(&m_CacaoDownsampledContext, &description);
-    CauldronAssert(ASSERT_CRITICAL, errorCode == FFX_OK, L"Could not initialize FidelityFX SDK downsampled backend context.");
 }
 
 void CACAORenderModule::SetOutputToCallbackTarget(const bool outputToCallbackTarget)
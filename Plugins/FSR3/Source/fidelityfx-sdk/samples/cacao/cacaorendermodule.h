@@ -376,7 +376,6 @@ private:
     bool                     m_GenerateNormals = false;
     FfxCacaoSettings         m_CacaoSettings;
     FfxCacaoContext          m_CacaoContext;
-    FfxCacaoContext          m_CacaoDownsampledContext;
     bool                     m_ContextCreated = false;
     bool                     m_OutputToCallbackTarget = true;
 
@@ -951,7 +951,8 @@ void FSRRenderModule::UpdateFSRContexts(bool enabled)
                     m_pHudLessTexture[m_curUiTextureIndex]->GetResource(), L"FSR3_HudLessBackbuffer", FFX_RESOURCE_STATE_PIXEL_COMPUTE_READ);
 
                 m_FrameGenerationConfig.frameGenerationEnabled  = false;
-                m_FrameGenerationConfig.frameGenerationCallback = [](const FfxFrameGenerationDispatchDescription* desc, void*) -> FfxErrorCode { return ffxFsr3DispatchFrameGeneration(desc); };
+                m_FrameGenerationConfig.frameGenerationCallback        = ffxFsr3DispatchFrameGenerationCallback;
+                m_FrameGenerationConfig.frameGenerationCallbackContext = &m_FSR3Context;
                 m_FrameGenerationConfig.presentCallback         = (s_uiRenderMode == 2) ? UiCompositionCallback : nullptr;
                 m_FrameGenerationConfig.swapChain               = ffxSwapChain;
                 m_FrameGenerationConfig.HUDLessColor            = (s_uiRenderMode == 3) ? hudLessResource : FfxResource({});
@@ -1279,7 +1280,8 @@ void FSRRenderModule::Execute(double deltaTime, CommandList* pCmdList)
 
             if (m_UseCallback)
             {
-                m_FrameGenerationConfig.frameGenerationCallback = [](const FfxFrameGenerationDispatchDescription* desc, void*) -> FfxErrorCode { return ffxFsr3DispatchFrameGeneration(desc); };
+                m_FrameGenerationConfig.frameGenerationCallback        = ffxFsr3DispatchFrameGenerationCallback;
+                m_FrameGenerationConfig.frameGenerationCallbackContext = &m_FSR3Context;
             }
             else
             {
@@ -1410,7 +1412,7 @@ void FSRRenderModule::Execute(double deltaTime, CommandList* pCmdList)
             fgDesc.interpolationRect.width  = resInfo.UpscaleWidth;
             fgDesc.interpolationRect.height = resInfo.UpscaleHeight;
             fgDesc.frameID                  = m_FrameID;
-            ffxFsr3DispatchFrameGeneration(&fgDesc);
+            ffxFsr3ContextDispatchFrameGeneration(&m_FSR3Context, &fgDesc);
         }
     }
 
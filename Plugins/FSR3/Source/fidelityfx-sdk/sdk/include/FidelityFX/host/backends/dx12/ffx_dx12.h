@@ -79,9 +79,199 @@ FFX_API FfxErrorCode ffxGetInterfaceDX12(
     FfxInterface* backendInterface,
     FfxDevice device,
     void* scratchBuffer,
-    size_t scratchBufferSize, 
+    size_t scratchBufferSize,
     size_t maxContexts);
 
+/// A structure encapsulating the resource barrier statistics gathered by the
+/// DX12 backend while executing the GPU jobs of an effect.
+///
+/// Counters are cumulative from the creation of each effect context.
+///
+/// @ingroup DX12Backend
+typedef struct FfxBarrierStatisticsDX12 {
+
+    uint64_t    transitionBarriers;     ///< The number of full transition barriers emitted.
+    uint64_t    splitBarriers;          ///< The number of split (begin-only + end-only) transition pairs emitted.
+    uint64_t    uavBarriers;            ///< The number of UAV barriers emitted.
+    uint64_t    mergedBarriers;         ///< The number of barriers merged into (or dropped in favour of) a barrier already queued for the same resource.
+    uint64_t    skippedUavBarriers;     ///< The number of UAV barriers dropped because the resource was not accessed as a UAV since its last barrier.
+    uint64_t    flushCount;             ///< The number of <c><i>ResourceBarrier</i></c> calls issued.
+} FfxBarrierStatisticsDX12;
+
+/// Query the resource barrier statistics of all active contexts of an effect.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [in] effect                      The <c><i>FfxEffect</i></c> to gather statistics for.
+/// @param [out] outStatistics              A pointer to a <c><i>FfxBarrierStatisticsDX12</i></c> structure to populate.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>outStatistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetBarrierStatisticsDX12(FfxInterface* backendInterface, FfxEffect effect, FfxBarrierStatisticsDX12* outStatistics);
+
+/// A structure encapsulating the statistics of the root signature and pipeline state
+/// cache shared by all effect contexts of a DirectX 12 backend interface.
+///
+/// Counters are cumulative from the creation of the first effect context on the interface.
+///
+/// @ingroup DX12Backend
+typedef struct FfxPipelineCacheStatisticsDX12 {
+
+    uint64_t    cacheHits;                  ///< The number of pipelines that reused a cached root signature and pipeline state.
+    uint64_t    cacheMisses;                ///< The number of pipelines that had to create a new root signature and pipeline state.
+    uint64_t    evictedEntries;             ///< The number of unreferenced entries released to make room for new ones.
+    uint64_t    hitTimeMicroseconds;        ///< The total time spent in pipeline creation calls that hit the cache.
+    uint64_t    creationTimeMicroseconds;   ///< The total time spent in pipeline creation calls that missed the cache.
+    uint32_t    cachedEntries;              ///< The number of entries currently held by the cache.
+    uint32_t    referencedEntries;          ///< The number of cached entries currently used by at least one pipeline.
+} FfxPipelineCacheStatisticsDX12;
+
+/// Query the statistics of the pipeline cache shared by all effect contexts of a backend interface.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [out] outStatistics              A pointer to a <c><i>FfxPipelineCacheStatisticsDX12</i></c> structure to populate.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>outStatistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetPipelineCacheStatisticsDX12(FfxInterface* backendInterface, FfxPipelineCacheStatisticsDX12* outStatistics);
+
+/// A structure encapsulating the occupancy statistics of the static descriptor heap
+/// range from which bindless descriptor blocks are allocated for effect contexts.
+///
+/// @ingroup DX12Backend
+typedef struct FfxDescriptorStatisticsDX12 {
+
+    uint32_t    capacity;                   ///< The number of descriptors available for bindless blocks.
+    uint32_t    allocatedDescriptors;       ///< The number of descriptors currently allocated to effect contexts.
+    uint32_t    peakAllocatedDescriptors;   ///< The highest number of descriptors allocated at once.
+    uint32_t    highWaterMark;              ///< The highest descriptor offset (exclusive) ever handed out.
+    uint32_t    freeRangeCount;             ///< The number of disjoint free ranges.
+    uint32_t    largestFreeRange;           ///< The size of the largest free range.
+    uint32_t    failedAllocations;          ///< The number of effect context creations that ran out of descriptors.
+    float       fragmentation;              ///< One minus the ratio of the largest free range to all free descriptors.
+} FfxDescriptorStatisticsDX12;
+
+/// Query the bindless descriptor allocation statistics of a backend interface.
+///
+/// The statistics are reset when the last effect context of the interface is destroyed.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [out] outStatistics              A pointer to a <c><i>FfxDescriptorStatisticsDX12</i></c> structure to populate.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>outStatistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetDescriptorStatisticsDX12(FfxInterface* backendInterface, FfxDescriptorStatisticsDX12* outStatistics);
+
+/// A structure encapsulating the statistics of the heaps shared by the transient
+/// resources of all effect contexts created from a backend interface.
+///
+/// Resources created with <c><i>FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT</i></c> are written
+/// before they are read in every dispatch of their effect, so the backend places them in heaps
+/// where they overlap the transient resources of the other effects. Resources which are only
+/// <c><i>FFX_RESOURCE_FLAGS_ALIASABLE</i></c> may carry data from one dispatch to the next
+/// and stay committed, as do those of frame interpolation and optical flow, which may run on
+/// an async queue.
+///
+/// @ingroup DX12Backend
+typedef struct FfxTransientHeapStatisticsDX12 {
+
+    uint32_t    heapCount;                  ///< The number of shared heaps.
+    uint32_t    placedResources;            ///< The number of transient resources placed in the shared heaps.
+    uint64_t    heapBytes;                  ///< The size of all shared heaps.
+    uint64_t    placedBytes;                ///< The size the placed resources would need without aliasing.
+    uint64_t    peakPlacedBytes;            ///< The highest placedBytes seen.
+    uint64_t    savedBytes;                 ///< The video memory saved by aliasing, placedBytes minus heapBytes.
+    uint32_t    committedFallbacks;         ///< The number of transient resources which could not be placed and were committed instead.
+} FfxTransientHeapStatisticsDX12;
+
+/// Query the statistics of the heaps shared by the transient resources of a backend interface.
+///
+/// The savings are also reflected in the <c><i>FfxEffectMemoryUsage</i></c> reported for each
+/// effect, whose <c><i>totalUsageInBytes</i></c> only includes the shared heaps created for it.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [out] outStatistics              A pointer to a <c><i>FfxTransientHeapStatisticsDX12</i></c> structure to populate.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>outStatistics</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetTransientHeapStatisticsDX12(FfxInterface* backendInterface, FfxTransientHeapStatisticsDX12* outStatistics);
+
+/// A structure holding the GPU time of one labelled pass of an effect.
+///
+/// @ingroup DX12Backend
+typedef struct FfxPassTimingDX12 {
+
+    wchar_t     label[FFX_RESOURCE_NAME_SIZE];  ///< The job label the effect scheduled the pass with, e.g. <c><i>"OF 0 Search"</i></c>.
+    double      microseconds;                   ///< The GPU time between the start and the end of the pass.
+} FfxPassTimingDX12;
+
+/// Enable or disable GPU timestamps around the labelled compute jobs of all effect contexts.
+///
+/// Timestamps are resolved into a readback buffer owned by the backend interface, in one of
+/// four slots per effect context. A slot is read back and reused once the fence set with
+/// <c><i>ffxSetPassTimingFenceDX12</i></c> shows the command list that resolved it has
+/// executed. Nothing is timed until a fence is set. Up to 64 passes are timed per execution.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [in] timestampFrequency          The value of <c><i>ID3D12CommandQueue::GetTimestampFrequency</i></c> for the queue executing the jobs, 0 to disable timing.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxSetPassTimingFrequencyDX12(FfxInterface* backendInterface, uint64_t timestampFrequency);
+
+/// Set the fence which tells when the timestamps of the following executions have been resolved.
+///
+/// Call it every frame before recording the effects, with the value the application will signal
+/// on <c><i>fence</i></c> after the command lists recorded from now on have executed. An
+/// execution which finds every timing slot still in flight is not timed, rather than reading
+/// back incomplete data.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [in] fence                       The <c><i>ID3D12Fence</i></c> signalled after the command lists executed, or <c><i>NULL</i></c> to stop timing.
+/// @param [in] signalValue                 The value <c><i>fence</i></c> will be signalled with.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxSetPassTimingFenceDX12(FfxInterface* backendInterface, ID3D12Fence* fence, uint64_t signalValue);
+
+/// Query the latest GPU time of each labelled pass of all active contexts of an effect.
+///
+/// @param [in] backendInterface            A pointer to a <c><i>FfxInterface</i></c> structure populated by <c><i>ffxGetInterfaceDX12</i></c>.
+/// @param [in] effect                      The <c><i>FfxEffect</i></c> to gather timings for.
+/// @param [out] outTimings                 An array of <c><i>FfxPassTimingDX12</i></c> to populate, or <c><i>NULL</i></c> to only query the count.
+/// @param [in,out] inoutCount              The capacity of <c><i>outTimings</i></c>, set to the number of timings available or written.
+///
+/// @retval
+/// FFX_OK                                  The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER               The <c><i>backendInterface</i></c> or <c><i>inoutCount</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup DX12Backend
+FFX_API FfxErrorCode ffxGetPassTimingsDX12(FfxInterface* backendInterface, FfxEffect effect, FfxPassTimingDX12* outTimings, uint32_t* inoutCount);
+
 /// Create a <c><i>FfxCommandList</i></c> from a <c><i>ID3D12CommandList</i></c>.
 ///
 /// @param [in] cmdList                     A pointer to the DirectX12 command list.
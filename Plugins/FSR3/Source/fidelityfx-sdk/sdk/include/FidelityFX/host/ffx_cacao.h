@@ -184,7 +184,7 @@
 /// The size of the context specified in 32bit values.
 ///
 /// @ingroup FfxCacao
-#define FFX_CACAO_CONTEXT_SIZE (301054)
+#define FFX_CACAO_CONTEXT_SIZE (301074)
 
 /// FidelityFX CACAO context count.
 ///
@@ -380,6 +380,7 @@ typedef struct FfxCacaoContextDescription
 	uint32_t                    height;               ///< height of the input/output buffers
 	bool                        useDownsampledSsao;   ///< Whether SSAO should be generated at native resolution or half resolution. It is recommended to enable this setting for improved performance.
     FfxInterface                backendInterface;
+    bool                        allowSsaoResolutionSwitch; ///< Also create the internal resources for the other SSAO resolution, so <c><i>useDownsampledSsao</i></c> can be changed through <c><i>ffxCacaoUpdateSettings</i></c> without recreating the context.
 } FfxCacaoContextDescription;
 
 /// A structure encapsulating the parameters and resources required to dispatch FidelityFX CACAO.
@@ -513,13 +514,22 @@ FFX_API FfxErrorCode ffxCacaoContextDispatch(FfxCacaoContext* context, const Ffx
 FFX_API FfxErrorCode ffxCacaoContextDestroy(FfxCacaoContext* context);
 
 /// Updates the settings used by CACAO.
+///
+/// Quality level and the other settings only affect constants, pipeline selection and
+/// dispatch sizes, so they can be changed every frame. Changing <c><i>useDownsampledSsao</i></c>
+/// swaps to the internal resources of the other resolution, which requires the context to
+/// have been created with <c><i>allowSsaoResolutionSwitch</i></c> set.
+///
 /// @param [in] context A pointer to a <c><i>FfxCacaoContext</i></c> structure to change settings for.
 /// @param [in] settings A pointer to a <c><i>FfxCacaoSettings</i></c> structure.
+/// @param [in] useDownsampledSsao Whether SSAO should be generated at native resolution or half resolution.
 ///
 /// @retval
 /// FFX_OK                              The operation completed successfully.
 /// @retval
 /// FFX_ERROR_CODE_NULL_POINTER         The operation failed because either <c><i>context</i></c> or <c><i>settings</i></c> was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The operation failed because <c><i>useDownsampledSsao</i></c> changed on a context created without <c><i>allowSsaoResolutionSwitch</i></c>.
 ///
 /// @ingroup FfxCacao
 FFX_API FfxErrorCode ffxCacaoUpdateSettings(FfxCacaoContext* context, const FfxCacaoSettings* settings, const bool useDownsampledSsao);
@@ -275,6 +275,23 @@ FFX_API FfxErrorCode ffxClassifierContextReflectionDispatch(FfxClassifierContext
 /// @ingroup ffxClassifier
 FFX_API FfxErrorCode ffxClassifierContextDestroy(FfxClassifierContext* pContext);
 
+/// Get GPU memory usage of the FidelityFX Classifier context.
+///
+/// The tile lists, ray counters and indirect arguments written by the classifier
+/// are provided by the caller and consumed by the denoiser as-is, so they are
+/// not part of either context's usage.
+///
+/// @param [in]  pContext                A pointer to a <c><i>FfxClassifierContext</i></c> structure.
+/// @param [out] pVramUsage              A pointer to a <c><i>FfxEffectMemoryUsage</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because either <c><i>context</i></c> or <c><i>vramUsage</i></c> were <c><i>NULL</i></c>.
+///
+/// @ingroup ffxClassifier
+FFX_API FfxErrorCode ffxClassifierContextGetGpuMemoryUsage(FfxClassifierContext* pContext, FfxEffectMemoryUsage* pVramUsage);
+
 /// Queries the effect version number.
 ///
 /// @returns
@@ -87,6 +87,7 @@ typedef enum FfxDenoiserInitializationFlagBits {
     FFX_DENOISER_SHADOWS                = (1 << 0),     ///< A bit indicating that the denoiser is used for denoising shadows
     FFX_DENOISER_REFLECTIONS            = (1 << 1),     ///< A bit indicating that the denoiser is used for denoising reflections
     FFX_DENOISER_ENABLE_DEPTH_INVERTED  = (1 << 2),     ///< A bit indicating that the input depth buffer data provided is inverted [1..0].
+    FFX_DENOISER_REFLECTIONS_SHARED_ROUGHNESS_HISTORY = (1 << 3), ///< A bit indicating that the previous frame's classifier roughness output is provided as <c><i>extractedRoughnessHistory</i></c>, so the reflections denoiser neither allocates nor copies its own roughness history.
 } FfxDenoiserInitializationFlagBits;
 
 /// A structure encapsulating the parameters required to initialize FidelityFX Denoiser
@@ -158,6 +159,7 @@ typedef struct FfxDenoiserReflectionsDispatchDescription {
     float               roughnessThreshold;         ///< Regions with a roughness value greater than this threshold won't spawn rays.
     uint32_t            frameIndex;                 ///< The index of the current frame.
     bool                reset;
+    FfxResource         extractedRoughnessHistory;  ///< A <c><i>FfxResource</i></c> containing the classifier roughness of the previous frame. Only used with <c><i>FFX_DENOISER_REFLECTIONS_SHARED_ROUGHNESS_HISTORY</i></c>.
 } FfxDenoiserReflectionsDispatchDescription;
 
 
@@ -253,6 +255,22 @@ FFX_API FfxErrorCode ffxDenoiserContextDispatchReflections(FfxDenoiserContext* c
 /// @ingroup FfxDenoiser
 FFX_API FfxErrorCode ffxDenoiserContextDestroy(FfxDenoiserContext* context);
 
+/// Get GPU memory usage of the FidelityFX Denoiser context.
+///
+/// Only resources owned by the context are counted. Buffers shared with the
+/// classifier through the dispatch descriptions belong to the caller.
+///
+/// @param [in]  pContext                A pointer to a <c><i>FfxDenoiserContext</i></c> structure.
+/// @param [out] pVramUsage              A pointer to a <c><i>FfxEffectMemoryUsage</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_CODE_NULL_POINTER         The operation failed because either <c><i>context</i></c> or <c><i>vramUsage</i></c> were <c><i>NULL</i></c>.
+///
+/// @ingroup FfxDenoiser
+FFX_API FfxErrorCode ffxDenoiserContextGetGpuMemoryUsage(FfxDenoiserContext* pContext, FfxEffectMemoryUsage* pVramUsage);
+
 /// Queries the effect version number.
 ///
 /// @returns
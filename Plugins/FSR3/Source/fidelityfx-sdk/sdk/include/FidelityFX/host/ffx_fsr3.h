@@ -212,6 +212,21 @@ typedef struct FfxFsr3DispatchFrameGenerationPrepareDescription
     uint64_t                    frameID;
 } FfxFsr3DispatchFrameGenerationPrepareDescription;
 
+/// Dispatch frame generation for the single FSR3 context which has frame generation enabled.
+///
+/// Kept for applications driving one swapchain. When several contexts have frame generation
+/// enabled (e.g. one per window) use <c><i>ffxFsr3ContextDispatchFrameGeneration</i></c>, or set
+/// <c><i>ffxFsr3DispatchFrameGenerationCallback</i></c> as the frame generation callback with the
+/// context as its user data.
+///
+/// @param [in] desc                    A pointer to a <c><i>FfxFrameGenerationDispatchDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           No context has frame generation enabled, several do, or <c><i>desc</i></c> was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR3
 FFX_API FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* desc);
 
 /// A structure encapsulating the parameters for automatic generation of a reactive mask
@@ -355,6 +370,35 @@ FFX_API FfxErrorCode ffxFsr3ContextGenerateReactiveMask(FfxFsr3Context* context,
 
 FFX_API FfxErrorCode ffxFsr3ConfigureFrameGeneration(FfxFsr3Context* context, const FfxFrameGenerationConfig* config);
 
+/// Dispatch frame generation for a given FSR3 context.
+///
+/// Contexts do not share any state, so several contexts may be dispatched concurrently from
+/// different threads (e.g. from the presentation threads of several swapchains).
+///
+/// @param [in] context                 A pointer to a <c><i>FfxFsr3Context</i></c> structure with frame generation enabled.
+/// @param [in] desc                    A pointer to a <c><i>FfxFrameGenerationDispatchDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The <c><i>context</i></c> or <c><i>desc</i></c> pointer was <c><i>NULL</i></c>.
+///
+/// @ingroup FSR3
+FFX_API FfxErrorCode ffxFsr3ContextDispatchFrameGeneration(FfxFsr3Context* context, const FfxFrameGenerationDispatchDescription* desc);
+
+/// A <c><i>FfxFrameGenerationDispatchFunc</i></c> which dispatches frame generation for the
+/// <c><i>FfxFsr3Context</i></c> passed as its user data.
+///
+/// Set it as <c><i>FfxFrameGenerationConfig::frameGenerationCallback</i></c> with the context as
+/// <c><i>frameGenerationCallbackContext</i></c> to route each swapchain to its own context. A
+/// <c><i>NULL</i></c> user data falls back to <c><i>ffxFsr3DispatchFrameGeneration</i></c>.
+///
+/// @param [in] desc                    A pointer to a <c><i>FfxFrameGenerationDispatchDescription</i></c> structure.
+/// @param [in] callbackContext         A pointer to the <c><i>FfxFsr3Context</i></c> to dispatch, or <c><i>NULL</i></c>.
+///
+/// @ingroup FSR3
+FFX_API FfxErrorCode ffxFsr3DispatchFrameGenerationCallback(const FfxFrameGenerationDispatchDescription* desc, void* callbackContext);
+
 /// Destroy the FidelityFX Super Resolution context.
 ///
 /// @param [out] context                A pointer to a <c><i>FfxFsr3Context</i></c> structure to destroy.
@@ -25,6 +25,7 @@
 #include <FidelityFX/host/ffx_assert.h>
 #include <FidelityFX/host/ffx_types.h>
 #include <FidelityFX/host/ffx_error.h>
+#include <stddef.h>  // offsetof
 
 #if defined(__cplusplus)
 #define FFX_CPU
@@ -436,6 +437,71 @@ typedef FfxErrorCode (*FfxScheduleGpuJobFunc)(
     FfxInterface* backendInterface,
     const FfxGpuJobDescription* job);
 
+/// Schedule several render jobs to be executed on the next call of
+/// <c><i>FfxExecuteGpuJobsFunc</i></c>.
+///
+/// Equivalent to calling <c><i>FfxScheduleGpuJobFunc</i></c> for each job in
+/// order, but lets the backend reserve space for the whole batch at once. The
+/// bindings in each job are resolved resource indices, so the backend does not
+/// need to look anything up by name.
+///
+/// @param [in] backendInterface                    A pointer to the backend interface.
+/// @param [in] jobs                                A pointer to an array of <c><i>FfxGpuJobDescription</i></c> structures.
+/// @param [in] jobCount                            The number of jobs in <c><i>jobs</i></c>.
+///
+/// @retval
+/// FFX_OK                                          The operation completed successfully.
+/// @retval
+/// Anything else                                   The operation failed.
+///
+/// @ingroup FfxInterface
+typedef FfxErrorCode (*FfxScheduleGpuJobsFunc)(
+    FfxInterface* backendInterface,
+    const FfxGpuJobDescription* jobs,
+    uint32_t jobCount);
+
+/// Get the number of leading bytes of a <c><i>FfxGpuJobDescription</i></c>
+/// which are meaningful for its <c><i>jobType</i></c>.
+///
+/// The job description is sized for the largest (compute) job, so backends
+/// queueing a clear, copy, barrier or discard only need to copy this many bytes.
+///
+/// @param [in] job                                 A pointer to a <c><i>FfxGpuJobDescription</i></c> structure.
+///
+/// @returns
+/// The size in bytes of the used part of <c><i>job</i></c>.
+///
+/// @ingroup FfxInterface
+static inline size_t ffxGetGpuJobDescriptionSize(const FfxGpuJobDescription* job)
+{
+    const size_t headerSize = offsetof(FfxGpuJobDescription, clearJobDescriptor);
+
+    switch (job->jobType)
+    {
+    case FFX_GPU_JOB_CLEAR_FLOAT:
+        return headerSize + sizeof(FfxClearFloatJobDescription);
+    case FFX_GPU_JOB_COPY:
+        return headerSize + sizeof(FfxCopyJobDescription);
+    case FFX_GPU_JOB_BARRIER:
+        return headerSize + sizeof(FfxBarrierDescription);
+    case FFX_GPU_JOB_DISCARD:
+        return headerSize + sizeof(FfxDiscardJobDescription);
+    default:
+        return sizeof(FfxGpuJobDescription);
+    }
+}
+
+/// A list of GPU jobs an effect records during one dispatch, and hands to
+/// the backend in a single call to <c><i>FfxScheduleGpuJobsFunc</i></c>.
+///
+/// @ingroup FfxInterface
+typedef struct FfxGpuJobBatch
+{
+    FfxGpuJobDescription*   jobs;           ///< Storage for <c><i>jobCapacity</i></c> jobs.
+    uint32_t                jobCapacity;    ///< The number of jobs <c><i>jobs</i></c> can hold.
+    uint32_t                jobCount;       ///< The number of jobs recorded since the batch was last scheduled.
+} FfxGpuJobBatch;
+
 /// Execute scheduled render jobs on the <c><i>comandList</i></c> provided.
 ///
 /// The recording of the graphics API commands should take place in this
@@ -591,6 +657,7 @@ typedef void(*FfxRegisterConstantBufferAllocatorFunc)(FfxInterface* backendInter
 ///   - <c><i>FfxCreatePipelineFunc</i></c>
 ///   - <c><i>FfxDestroyPipelineFunc</i></c>
 ///   - <c><i>FfxScheduleGpuJobFunc</i></c>
+///   - <c><i>FfxScheduleGpuJobsFunc</i></c>
 ///   - <c><i>FfxExecuteGpuJobsFunc</i></c>
 ///   - <c><i>FfxBeginMarkerFunc</i></c>
 ///   - <c><i>FfxEndMarkerFunc</i></c>
@@ -654,6 +721,7 @@ typedef struct FfxInterface {
     void*                              scratchBuffer;                 ///< A preallocated buffer for memory utilized internally by the backend.
     size_t                             scratchBufferSize;             ///< Size of the buffer pointed to by <c><i>scratchBuffer</i></c>.
     FfxDevice                          device;                        ///< A backend specific device
+    FfxScheduleGpuJobsFunc             fpScheduleGpuJobs;             ///< A callback function to schedule an array of render jobs. May be null, see <c><i>ffxScheduleGpuJobs</i></c>.
 
 } FfxInterface;
 
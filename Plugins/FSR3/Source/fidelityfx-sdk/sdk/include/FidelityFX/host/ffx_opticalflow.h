@@ -117,6 +117,34 @@ typedef struct FfxOpticalflowSharedResourceDescriptions {
 
 } FfxOpticalflowSharedResourceDescriptions;
 
+/// A structure encapsulating the parameters for running the CPU reference
+/// implementation of FidelityFX OpticalFlow on host memory.
+///
+/// The reference runs the same passes as <c><i>ffxOpticalflowContextDispatch</i></c>
+/// (luma preparation, luma pyramid, scene change detection, and the per level
+/// search, filter and scale passes) and produces the same outputs, so it can be
+/// used to validate GPU results in regression tests. It follows the portable
+/// shader path, which does not use the <c><i>msad4</i></c> instruction.
+///
+/// The scratch memory carries the previous frame between dispatches, so the same
+/// memory must be passed every frame and the first dispatch must set <c><i>reset</i></c>.
+///
+/// @ingroup ffxOpticalflow
+typedef struct FfxOpticalflowCpuDispatchDescription
+{
+    const float*     color;                      ///< The input color, 4 floats (RGBA) per pixel.
+    uint32_t         colorRowPitch;              ///< The distance in bytes between two rows of <c><i>color</i></c>.
+    int16_t*         opticalFlowVector;          ///< The output motion vectors, one x/y pair per 8x8 block, in rows of <c><i>ceil(width / 8)</i></c> blocks.
+    uint32_t*        opticalFlowSCD;             ///< The output scene change detection data, 3 values laid out like the <c><i>opticalFlowSCD</i></c> GPU resource.
+    void*            scratchMemory;              ///< Scratch memory of at least <c><i>ffxOpticalflowCpuGetScratchMemorySize</i></c> bytes, kept between dispatches.
+    size_t           scratchMemorySize;          ///< The size of <c><i>scratchMemory</i></c> in bytes.
+    FfxDimensions2D  resolution;                 ///< The resolution of <c><i>color</i></c>.
+    bool             reset;                      ///< A boolean value which when set to true, indicates the camera has moved discontinuously.
+    bool             forceScalar;                ///< Use the scalar block matching even when SIMD is available, to validate one path against the other.
+    int              backbufferTransferFunction;
+    FfxFloatCoords2D minMaxLuminance;
+} FfxOpticalflowCpuDispatchDescription;
+
 /// A structure encapsulating the FidelityFX OpticalFlow context.
 ///
 /// This sets up an object which contains all persistent internal data and
@@ -199,6 +227,37 @@ FFX_API FfxErrorCode ffxOpticalflowContextDispatch(FfxOpticalflowContext* contex
 /// @ingroup ffxOpticalflow
 FFX_API FfxErrorCode ffxOpticalflowContextDestroy(FfxOpticalflowContext* context);
 
+/// Returns the size in bytes of the scratch memory required to run the CPU
+/// reference of OpticalFlow at <c><i>resolution</i></c> with <c><i>ffxOpticalflowCpuDispatch</i></c>.
+///
+/// @param [in]  resolution              The resolution of the input color.
+///
+/// @returns
+/// The size of the scratch memory in bytes.
+///
+/// @ingroup ffxOpticalflow
+FFX_API size_t ffxOpticalflowCpuGetScratchMemorySize(FfxDimensions2D resolution);
+
+/// Compute the optical flow of the provided host color buffer on the CPU,
+/// matching the results of <c><i>ffxOpticalflowContextDispatch</i></c>.
+///
+/// No context is required. This is intended as a reference to validate GPU
+/// results in regression tests, not as a real-time fallback.
+///
+/// @param [in]  pDispatchDescription    A pointer to a <c><i>FfxOpticalflowCpuDispatchDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The operation failed because either <c><i>pDispatchDescription</i></c>, its buffers or its scratch memory was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INVALID_ARGUMENT          The operation failed because the resolution is too small for the 7 level pyramid.
+/// @retval
+/// FFX_ERROR_INSUFFICIENT_MEMORY       The operation failed because <c><i>scratchMemorySize</i></c> is too small.
+///
+/// @ingroup ffxOpticalflow
+FFX_API FfxErrorCode ffxOpticalflowCpuDispatch(const FfxOpticalflowCpuDispatchDescription* pDispatchDescription);
+
 /// Queries the effect version number.
 ///
 /// @returns
@@ -118,6 +118,27 @@ typedef struct FfxParallelSortDispatchDescription {
     uint32_t                    numKeysToSort;      ///< The number of keys in the buffer requiring sorting
 } FfxParallelSortDispatchDescription;
 
+/// A structure encapsulating the parameters needed to sort host memory
+/// buffer(s) on the CPU with the same key/payload layout and 4-bit-per-pass
+/// semantics as the GPU implementation.
+///
+/// The sort is performed in place: on return <c><i>keyBuffer</i></c> (and
+/// <c><i>payloadBuffer</i></c> if provided) hold the sorted data. The sort is
+/// stable, so keys which compare equal keep their original relative order
+/// (and payload association), exactly like the GPU scatter pass.
+///
+/// @ingroup FfxParallelSort
+typedef struct FfxParallelSortCpuDispatchDescription {
+
+    uint32_t*                   keyBuffer;          ///< The host buffer containing the keys to sort
+    uint32_t*                   payloadBuffer;      ///< The (optional) host payload buffer to sort (requires <c><i>FFX_PARALLELSORT_PAYLOAD_SORT</i></c> be set)
+    void*                       scratchMemory;      ///< Scratch memory of at least <c><i>ffxParallelSortCpuGetScratchMemorySize</i></c> bytes
+    size_t                      scratchMemorySize;  ///< The size of <c><i>scratchMemory</i></c> in bytes
+    uint32_t                    numKeysToSort;      ///< The number of keys in the buffer requiring sorting
+    uint32_t                    flags;              ///< A collection of <c><i>FfxParallelSortInitializationFlagBits</i></c>. <c><i>FFX_PARALLELSORT_INDIRECT_SORT</i></c> is ignored.
+    uint32_t                    maxThreads;         ///< The maximum number of worker threads to use, or 0 to use the hardware concurrency
+} FfxParallelSortCpuDispatchDescription;
+
 /// A structure encapsulating the FidelityFX Parallel Sort context.
 ///
 /// This sets up an object which contains all persistent internal data and
@@ -197,6 +218,37 @@ FFX_API FfxErrorCode ffxParallelSortContextDispatch(FfxParallelSortContext* pCon
 /// @ingroup FfxParallelSort
 FFX_API FfxErrorCode ffxParallelSortContextDestroy(FfxParallelSortContext* pContext);
 
+/// Returns the size in bytes of the scratch memory required to sort
+/// <c><i>maxEntries</i></c> keys on the CPU with <c><i>ffxParallelSortCpuDispatch</i></c>.
+///
+/// @param [in]  maxEntries              The maximum number of keys which will be sorted.
+/// @param [in]  flags                   A collection of <c><i>FfxParallelSortInitializationFlagBits</i></c>.
+/// @param [in]  maxThreads              The maximum number of worker threads which will be used, or 0 for the hardware concurrency.
+///
+/// @returns
+/// The size of the scratch memory in bytes.
+///
+/// @ingroup FfxParallelSort
+FFX_API size_t ffxParallelSortCpuGetScratchMemorySize(uint32_t maxEntries, uint32_t flags, uint32_t maxThreads);
+
+/// Sort the provided host buffers on the CPU using a multi-threaded LSD radix
+/// sort matching the semantics of <c><i>ffxParallelSortContextDispatch</i></c>.
+///
+/// No context is required. This is intended as a fallback when no GPU is
+/// available (or it is too busy) and as a reference to validate GPU results.
+///
+/// @param [in]  pDispatchDescription    A pointer to a <c><i>FfxParallelSortCpuDispatchDescription</i></c> structure.
+///
+/// @retval
+/// FFX_OK                              The operation completed successfully.
+/// @retval
+/// FFX_ERROR_INVALID_POINTER           The operation failed because either <c><i>pDispatchDescription</i></c>, its key buffer or its scratch memory was <c><i>NULL</i></c>.
+/// @retval
+/// FFX_ERROR_INSUFFICIENT_MEMORY       The operation failed because <c><i>scratchMemorySize</i></c> is too small.
+///
+/// @ingroup FfxParallelSort
+FFX_API FfxErrorCode ffxParallelSortCpuDispatch(const FfxParallelSortCpuDispatchDescription* pDispatchDescription);
+
 /// Queries the effect version number.
 ///
 /// @returns
@@ -374,9 +374,10 @@ typedef enum FfxResourceViewDimension
 /// @ingroup SDKTypes
 typedef enum FfxResourceFlags {
 
-    FFX_RESOURCE_FLAGS_NONE             = 0,            ///< No flags.
-    FFX_RESOURCE_FLAGS_ALIASABLE        = (1 << 0),     ///< A bit indicating a resource does not need to persist across frames.
-    FFX_RESOURCE_FLAGS_UNDEFINED        = (1 << 1),     ///< Special case flag used internally when importing resources that require additional setup
+    FFX_RESOURCE_FLAGS_NONE                 = 0,            ///< No flags.
+    FFX_RESOURCE_FLAGS_ALIASABLE            = (1 << 0),     ///< A bit indicating a resource does not need to persist across frames.
+    FFX_RESOURCE_FLAGS_UNDEFINED            = (1 << 1),     ///< Special case flag used internally when importing resources that require additional setup
+    FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT   = (1 << 2),     ///< A bit indicating a resource is written before it is read in every dispatch, so its memory may be shared with other effects between dispatches.
 } FfxResourceFlags;
 
 /// An enumeration of all resource view types.
@@ -1270,8 +1271,8 @@ typedef struct FfxFrameGenerationDispatchDescription {
 
 typedef struct FfxEffectMemoryUsage
 {
-    uint64_t totalUsageInBytes;
-    uint64_t aliasableUsageInBytes;
+    uint64_t totalUsageInBytes;         ///< Video memory allocated for the effect. Heaps shared with other effects only count against the effect they were created for.
+    uint64_t aliasableUsageInBytes;     ///< Size of the effect resources which do not persist across frames, whether they are aliased or not.
 } FfxEffectMemoryUsage;
 
 #ifdef __cplusplus
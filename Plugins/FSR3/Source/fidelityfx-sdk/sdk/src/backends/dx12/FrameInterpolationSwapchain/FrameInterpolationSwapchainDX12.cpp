@@ -27,6 +27,7 @@
 #include <FidelityFX/host/backends/dx12/ffx_dx12.h>
 #include "FrameInterpolationSwapchainDX12_UiComposition.h"
 #include "antilag2/ffx_antilag2_dx12.h"
+#include <ffx_frame_pacing.h>
 
 FfxErrorCode ffxRegisterFrameinterpolationUiResourceDX12(FfxSwapchain gameSwapChain, FfxResource uiResource, uint32_t flags)
         {
@@ -431,7 +432,8 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
+            FfxFramePacingEstimator framePacing{};
+            ffxFramePacingEstimatorReset(&framePacing);
 
             int64_t previousQpc = 0;
 
@@ -455,28 +457,14 @@ DWORD WINAPI interpolationThread(LPVOID param)
                     int64_t currentQpc = 0;
                     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
 
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
+                    const int64_t deltaQpc = (currentQpc - previousQpc) * (previousQpc > 0);
+                    previousQpc            = currentQpc;
 
-                    // reset pacing averaging if delta > 10 fps,
                     int64_t qpcFrequency;
                     QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
 
-                    // set presentation time: reduce based on variance and subract 0.5ms as safety margin so we don't lock on a framerate lower than necessary
-                    double  safetyMarginInSec       = 0.0001; // = 0.1ms
-                    int64_t qpcSafetyMargin         = int64_t(qpcFrequency * safetyMarginInSec);
-                    const int64_t conservativeAvg   = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * 0.1);
-                    const int64_t deltaToUse        = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    // set presentation time from the averaged frame time, see ffxFramePacingEstimatorUpdate
+                    const int64_t deltaToUse = ffxFramePacingEstimatorUpdate(&framePacing, deltaQpc, qpcFrequency, presenter->resetTimer);
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
 
@@ -27,11 +27,15 @@
 #include <FidelityFX/host/backends/dx12/d3dx12.h>
 #include <ffx_shader_blobs.h>
 #include <ffx_breadcrumbs_list.h>
+#include <ffx_descriptor_allocator.h>
+#include <ffx_transient_heap_planner.h>
+#include <ffx_barrier_planner.h>
 #include <codecvt>  // convert string to wstring
 #include <memoryapi.h> // for VirtualAlloc
 #include <mutex>
 #include <tuple> // std::ignore
 #include <limits> // std::numeric_limits
+#include <chrono> // pipeline cache timing
 
 // Disable this to remove the dll load of PIX and PIX tracing
 #define ENABLE_PIX_CAPTURES 1
@@ -84,6 +88,7 @@ FfxErrorCode StageConstantBufferDataDX12(FfxInterface* backendInterface, void* d
 FfxErrorCode CreatePipelineDX12(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription*  desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
 FfxErrorCode DestroyPipelineDX12(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
 FfxErrorCode ScheduleGpuJobDX12(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
+FfxErrorCode ScheduleGpuJobsDX12(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount);
 FfxErrorCode ExecuteGpuJobsDX12(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
 FfxErrorCode BreadcrumbsAllocBlockDX12(FfxInterface* backendInterface, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData);
 void BreadcrumbsFreeBlockDX12(FfxInterface* backendInterface, FfxBreadcrumbsBlockData* blockData);
@@ -93,6 +98,23 @@ void RegisterConstantBufferAllocatorDX12(FfxInterface* backendInterface, FfxCons
 
 #define FFX_MAX_RESOURCE_IDENTIFIER_COUNT   (128)
 #define FFX_MAX_STATIC_DESCRIPTOR_COUNT   (65536)
+#define FFX_MAX_PIPELINE_CACHE_ENTRIES    (256)
+
+// Smallest heap created for aliasable resources, larger heaps are created as the transient footprint grows
+#define FFX_TRANSIENT_HEAP_MINIMUM_SIZE   (4 * 1024 * 1024)
+
+// GPU pass timing, see ffxSetPassTimingFrequencyDX12
+#define FFX_MAX_PASS_TIMINGS              (64)
+#define FFX_PASS_TIMING_FRAME_COUNT       (4)
+
+// Aliasable buffers and textures live in separate heaps to support resource heap tier 1
+enum TransientHeapKind
+{
+    FFX_TRANSIENT_HEAP_KIND_BUFFER = 0,
+    FFX_TRANSIENT_HEAP_KIND_TEXTURE,
+
+    FFX_TRANSIENT_HEAP_KIND_COUNT
+};
 
 // Constant buffer allocation callback
 static FfxConstantBufferAllocator s_fpConstantAllocator = nullptr;
@@ -108,10 +130,12 @@ typedef struct BackendContext_DX12 {
         ID3D12Resource*         resourcePtr;
         FfxResourceDescription  resourceDescription;
         FfxResourceStates       initialState;
-        FfxResourceStates       currentState;
+        FfxBarrierResourceState barrierState;
         uint32_t                srvDescIndex;
         uint32_t                uavDescIndex;
         uint32_t                uavDescCount;
+        uint32_t                transientHeapKind;          // TransientHeapKind of the heap the resource is placed in
+        uint64_t                transientSize;              // bytes placed in a shared transient heap, 0 for committed resources
     } Resource;
 
     uint32_t refCount;
@@ -133,15 +157,64 @@ typedef struct BackendContext_DX12 {
     uint32_t                descRingBufferBase;
     ID3D12DescriptorHeap*   descRingBuffer;
     uint32_t                descBindlessBase;
+    FfxDescriptorAllocator  bindlessDescriptorAllocator;
 
     uint8_t*                pStagingRingBuffer;
     uint32_t                stagingRingBufferBase = 0;
 
-    D3D12_RESOURCE_BARRIER  barriers[FFX_MAX_BARRIERS];
-    uint32_t                barrierCount;
+    // Merges and elides the barriers of the jobs being executed, counting them in the statistics of their effect
+    FfxBarrierPlanner       barrierPlanner;
 
     IDXGIFactory*           dxgiFactory = nullptr;
 
+    // Root signature and PSO shared by every pipeline created from the same shader and sampler layout.
+    // The cache holds one reference on each object and every pipeline using the entry holds another,
+    // so unreferenced entries stay available for contexts recreated after a resize.
+    typedef struct PipelineCacheEntry
+    {
+        uint64_t                hash;
+        size_t                  shaderSize;
+        ID3D12RootSignature*    rootSignature;
+        ID3D12PipelineState*    pipeline;
+        uint32_t                userCount;
+    } PipelineCacheEntry;
+
+    PipelineCacheEntry              pipelineCache[FFX_MAX_PIPELINE_CACHE_ENTRIES];
+    FfxPipelineCacheStatisticsDX12  pipelineCacheStatistics;
+    std::mutex                      pipelineCacheMutex;
+
+    // Shared heaps aliasing the per-dispatch resources of all effect contexts
+    FfxTransientHeapPlanner         transientHeapPlanners[FFX_TRANSIENT_HEAP_KIND_COUNT];
+    ID3D12Heap*                     transientHeaps[FFX_TRANSIENT_HEAP_KIND_COUNT][FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS];
+    uint32_t                        transientHeapOwners[FFX_TRANSIENT_HEAP_KIND_COUNT][FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS];  // effect context charged for the heap, UINT32_MAX once destroyed
+    uint32_t                        transientFallbackResources;
+    std::mutex                      transientHeapMutex;
+
+    // Timestamps around labelled compute jobs, FFX_PASS_TIMING_FRAME_COUNT slots of
+    // FFX_MAX_PASS_TIMINGS begin/end pairs per effect context
+    typedef struct PassTimingFrame
+    {
+        wchar_t     labels[FFX_MAX_PASS_TIMINGS][FFX_RESOURCE_NAME_SIZE];
+        uint32_t    count;
+        uint64_t    fenceValue;     // value of the pass timing fence once the timestamps are resolved
+    } PassTimingFrame;
+
+    typedef struct PassTimings
+    {
+        PassTimingFrame     frames[FFX_PASS_TIMING_FRAME_COUNT];
+        uint32_t            frameIndex;
+        FfxPassTimingDX12   results[FFX_MAX_PASS_TIMINGS];
+        uint32_t            resultCount;
+    } PassTimings;
+
+    uint64_t                        passTimingFrequency;
+    ID3D12QueryHeap*                passTimingQueryHeap;
+    ID3D12Resource*                 passTimingReadback;
+    const uint64_t*                 passTimingData;
+    ID3D12Fence*                    passTimingFence;
+    uint64_t                        passTimingFenceValue;
+    std::mutex                      passTimingMutex;
+
     typedef struct alignas(32) EffectContext {
 
         // Effect identifier -- used for various resource callbacks to application
@@ -174,6 +247,15 @@ typedef struct BackendContext_DX12 {
         // VRAM usage
         FfxEffectMemoryUsage vramUsage;
 
+        // Barrier statistics
+        FfxBarrierPlannerStatistics barrierStatistics;
+
+        // Placement of the aliasable resources in the shared transient heaps
+        FfxTransientHeapCursor transientHeapCursors[FFX_TRANSIENT_HEAP_KIND_COUNT];
+
+        // Pass timings, allocated when timing is first used by the context
+        PassTimings*        pPassTimings;
+
     } EffectContext;
 
     // Resource holder
@@ -190,25 +272,174 @@ typedef struct BackendContext_DX12 {
 
 } BackendContext_DX12;
 
-static uint32_t getFreeBindlessDescriptorBlock(BackendContext_DX12 *context, uint32_t size, uint32_t effectId)
+// 64-bit FNV-1a, used to key the pipeline cache
+static uint64_t hashPipelineData(uint64_t hash, const void* data, size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// The root signature is derived from the shader reflection and the static samplers, so the shader
+// bytecode and sampler descriptions fully identify a cache entry.
+static uint64_t hashPipelineDescription(const FfxShaderBlob& shaderBlob, const FfxPipelineDescription* pipelineDescription)
 {
-    uint32_t base = context->descBindlessBase;
+    uint64_t hash = hashPipelineData(0xcbf29ce484222325ull, shaderBlob.data, shaderBlob.size);
+    hash = hashPipelineData(hash, &pipelineDescription->samplerCount, sizeof(pipelineDescription->samplerCount));
+    for (size_t i = 0; i < pipelineDescription->samplerCount; ++i) {
+        const FfxSamplerDescription& sampler = pipelineDescription->samplers[i];
+        const uint32_t samplerKey[] = { uint32_t(sampler.filter), uint32_t(sampler.addressModeU), uint32_t(sampler.addressModeV), uint32_t(sampler.addressModeW) };
+        hash = hashPipelineData(hash, samplerKey, sizeof(samplerKey));
+    }
+    return hash;
+}
 
-    for (uint32_t i = 0; i < context->maxEffectContexts; ++i) {
-        BackendContext_DX12::EffectContext *effectContext = &context->pEffectContexts[i];
-        if (i == effectId || !effectContext->active) {
-            continue;
+// Must be called with the pipeline cache mutex held
+static BackendContext_DX12::PipelineCacheEntry* findPipelineCacheEntry(BackendContext_DX12* backendContext, uint64_t hash, size_t shaderSize)
+{
+    for (uint32_t i = 0; i < FFX_MAX_PIPELINE_CACHE_ENTRIES; ++i) {
+        BackendContext_DX12::PipelineCacheEntry& entry = backendContext->pipelineCache[i];
+        if (entry.pipeline && entry.hash == hash && entry.shaderSize == shaderSize) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+static void releasePipelineCacheEntry(BackendContext_DX12::PipelineCacheEntry& entry)
+{
+    entry.rootSignature->Release();
+    entry.pipeline->Release();
+    entry = {};
+}
+
+// Takes over one reference on rootSignature and pipeline. Must be called with the pipeline cache mutex held.
+static void insertPipelineCacheEntry(BackendContext_DX12* backendContext, uint64_t hash, size_t shaderSize, ID3D12RootSignature* rootSignature, ID3D12PipelineState* pipeline)
+{
+    BackendContext_DX12::PipelineCacheEntry* freeEntry = nullptr;
+    BackendContext_DX12::PipelineCacheEntry* unusedEntry = nullptr;
+    for (uint32_t i = 0; i < FFX_MAX_PIPELINE_CACHE_ENTRIES && !freeEntry; ++i) {
+        BackendContext_DX12::PipelineCacheEntry& entry = backendContext->pipelineCache[i];
+        if (!entry.pipeline) {
+            freeEntry = &entry;
+        } else if (!entry.userCount && !unusedEntry) {
+            unusedEntry = &entry;
+        }
+    }
+
+    if (!freeEntry && unusedEntry) {
+        releasePipelineCacheEntry(*unusedEntry);
+        ++backendContext->pipelineCacheStatistics.evictedEntries;
+        freeEntry = unusedEntry;
+    }
+
+    // Every entry is in use: leave the objects uncached, the pipeline's own references keep them alive
+    if (!freeEntry) {
+        rootSignature->Release();
+        pipeline->Release();
+        return;
+    }
+
+    freeEntry->hash          = hash;
+    freeEntry->shaderSize    = shaderSize;
+    freeEntry->rootSignature = rootSignature;
+    freeEntry->pipeline      = pipeline;
+    freeEntry->userCount     = 1;
+}
+
+// Frame interpolation and optical flow may run on an async queue next to other effects,
+// so their resources cannot share memory with effects dispatched on the graphics queue.
+static bool canAliasEffectResources(FfxEffect effect)
+{
+    return effect != FFX_EFFECT_FRAMEINTERPOLATION && effect != FFX_EFFECT_OPTICALFLOW;
+}
+
+// Create a placed resource in the shared transient heaps, creating a heap if none has room left.
+// Returns nullptr when the resource cannot be aliased and should be committed instead.
+// Must be called with the transient heap mutex held.
+static ID3D12Resource* createTransientResource(BackendContext_DX12* backendContext, uint32_t effectContextId, BackendContext_DX12::Resource* backendResource,
+                                               const D3D12_RESOURCE_DESC& dx12ResourceDescription, D3D12_RESOURCE_STATES dx12ResourceStates, uint64_t* outNewHeapBytes)
+{
+    BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    ID3D12Device* dx12Device = backendContext->device;
+    *outNewHeapBytes = 0;
+
+    // Render and depth targets need their own heap category on tier 1 hardware and must be initialized after aliasing
+    if (dx12ResourceDescription.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) {
+        return nullptr;
+    }
+
+    const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = dx12Device->GetResourceAllocationInfo(0, 1, &dx12ResourceDescription);
+    if (allocationInfo.SizeInBytes == UINT64_MAX || allocationInfo.Alignment > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT) {
+        return nullptr;
+    }
+
+    const uint32_t kind = (dx12ResourceDescription.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) ? FFX_TRANSIENT_HEAP_KIND_BUFFER : FFX_TRANSIENT_HEAP_KIND_TEXTURE;
+    FfxTransientHeapPlanner* planner = &backendContext->transientHeapPlanners[kind];
+    FfxTransientHeapCursor*  cursor  = &effectContext.transientHeapCursors[kind];
+
+    uint32_t heapIndex   = 0;
+    uint64_t heapOffset  = 0;
+    uint64_t newHeapSize = 0;
+    while (!ffxTransientHeapPlannerPlace(planner, cursor, allocationInfo.SizeInBytes, allocationInfo.Alignment, &heapIndex, &heapOffset, &newHeapSize)) {
+
+        if (!newHeapSize) {
+            return nullptr;
         }
 
-        if (!(base >= effectContext->bindlessBufferHeapEnd || base + size <= effectContext->bindlessBufferHeapStart)) {
-            base = effectContext->bindlessBufferHeapEnd;
-            i = 0;
+        D3D12_HEAP_DESC dx12HeapDescription = {};
+        dx12HeapDescription.SizeInBytes     = newHeapSize;
+        dx12HeapDescription.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+        dx12HeapDescription.Alignment       = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        dx12HeapDescription.Flags           = (kind == FFX_TRANSIENT_HEAP_KIND_BUFFER) ? D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+
+        ID3D12Heap* dx12Heap = nullptr;
+        if (FAILED(dx12Device->CreateHeap(&dx12HeapDescription, IID_PPV_ARGS(&dx12Heap)))) {
+            return nullptr;
         }
+
+        const uint32_t newHeapIndex = ffxTransientHeapPlannerAddHeap(planner, newHeapSize);
+        backendContext->transientHeaps[kind][newHeapIndex]      = dx12Heap;
+        backendContext->transientHeapOwners[kind][newHeapIndex] = effectContextId;
+        *outNewHeapBytes += newHeapSize;
+    }
+
+    ID3D12Resource* dx12Resource = nullptr;
+    if (FAILED(dx12Device->CreatePlacedResource(backendContext->transientHeaps[kind][heapIndex], heapOffset, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)))) {
+        ffxTransientHeapPlannerRelease(planner, cursor, allocationInfo.SizeInBytes);
+        return nullptr;
     }
 
-    FFX_ASSERT(base + size <= context->descBindlessBase + FFX_MAX_STATIC_DESCRIPTOR_COUNT);
+    backendResource->transientHeapKind = kind;
+    backendResource->transientSize     = allocationInfo.SizeInBytes;
+    return dx12Resource;
+}
+
+// Return the placement of a destroyed transient resource, releasing the heaps once nothing is placed in them.
+// Must be called with the transient heap mutex held.
+static void releaseTransientResource(BackendContext_DX12* backendContext, BackendContext_DX12::EffectContext& effectContext, BackendContext_DX12::Resource* backendResource)
+{
+    const uint32_t kind = backendResource->transientHeapKind;
+    FfxTransientHeapPlanner* planner = &backendContext->transientHeapPlanners[kind];
+
+    ffxTransientHeapPlannerRelease(planner, &effectContext.transientHeapCursors[kind], backendResource->transientSize);
+    backendResource->transientSize = 0;
+
+    if (!planner->placementCount) {
+        for (uint32_t i = 0; i < planner->heapCount; ++i) {
+            backendContext->transientHeaps[kind][i]->Release();
+            backendContext->transientHeaps[kind][i] = nullptr;
 
-    return base;
+            // the context which created the heap was charged for it
+            const uint32_t owner = backendContext->transientHeapOwners[kind][i];
+            if (owner != UINT32_MAX) {
+                backendContext->pEffectContexts[owner].vramUsage.totalUsageInBytes -= planner->heapSizes[i];
+            }
+        }
+        ffxTransientHeapPlannerReset(planner);
+    }
 }
 
 FFX_API size_t ffxGetScratchMemorySizeDX12(size_t maxContexts)
@@ -217,8 +448,9 @@ FFX_API size_t ffxGetScratchMemorySizeDX12(size_t maxContexts)
     uint32_t contextArraySize           = FFX_ALIGN_UP(maxContexts * sizeof(BackendContext_DX12::EffectContext), sizeof(uint32_t));
     uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(maxContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
     uint32_t gpuJobDescArraySize        = FFX_ALIGN_UP(maxContexts * FFX_MAX_GPU_JOBS * sizeof(FfxGpuJobDescription), sizeof(uint32_t));
+    uint32_t bindlessFreeRangeArraySize = FFX_ALIGN_UP((maxContexts + 1) * sizeof(FfxDescriptorRange), sizeof(uint32_t));
 
-    return FFX_ALIGN_UP(sizeof(BackendContext_DX12) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize, sizeof(uint64_t));
+    return FFX_ALIGN_UP(sizeof(BackendContext_DX12) + resourceArraySize + contextArraySize + stagingRingBufferArraySize + gpuJobDescArraySize + bindlessFreeRangeArraySize, sizeof(uint64_t));
 }
 
 // Create a FfxDevice from a ID3D12Device*
@@ -266,6 +498,7 @@ FfxErrorCode ffxGetInterfaceDX12(
     backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
     backendInterface->fpDestroyPipeline = DestroyPipelineDX12;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobDX12;
+    backendInterface->fpScheduleGpuJobs = ScheduleGpuJobsDX12;
     backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsDX12;
     backendInterface->fpBreadcrumbsAllocBlock = BreadcrumbsAllocBlockDX12;
     backendInterface->fpBreadcrumbsFreeBlock = BreadcrumbsFreeBlockDX12;
@@ -843,34 +1076,55 @@ void endMarkerDX12(BackendContext_DX12* backendContext, ID3D12GraphicsCommandLis
 #endif // #if defined(ENABLE_PIX_CAPTURES)
 }
 
-void addBarrier(BackendContext_DX12* backendContext, FfxResourceInternal* resource, FfxResourceStates newState)
+// Flush function of the barrier planner, translating its records into D3D12 barriers
+static void issueBarriersDX12(void* flushContext, void* commandList, const FfxBarrierRecord* barriers, uint32_t barrierCount)
 {
-    FFX_ASSERT(NULL != backendContext);
-    FFX_ASSERT(NULL != resource);
-
-    ID3D12Resource* dx12Resource = getDX12ResourcePtr(backendContext, resource->internalIndex);
-    D3D12_RESOURCE_BARRIER* barrier = &backendContext->barriers[backendContext->barrierCount];
+    BackendContext_DX12*       backendContext  = (BackendContext_DX12*)flushContext;
+    ID3D12GraphicsCommandList* dx12CommandList = reinterpret_cast<ID3D12GraphicsCommandList*>(commandList);
+    FFX_ASSERT(NULL != dx12CommandList);
 
-    FFX_ASSERT(backendContext->barrierCount < FFX_MAX_BARRIERS);
+    D3D12_RESOURCE_BARRIER dx12Barriers[FFX_MAX_BARRIERS];
+    for (uint32_t i = 0; i < barrierCount; ++i) {
 
-    FfxResourceStates* currentState = &backendContext->pResources[resource->internalIndex].currentState;
+        const FfxBarrierRecord& barrier      = barriers[i];
+        ID3D12Resource*         dx12Resource = getDX12ResourcePtr(backendContext, barrier.resourceIndex);
+        switch (barrier.type) {
 
-    if ((*currentState & newState) != newState) {
+        case FFX_BARRIER_RECORD_TRANSITION: {
 
-        *barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            dx12Resource,
-            ffxGetDX12StateFromResourceState(*currentState),
-            ffxGetDX12StateFromResourceState(newState));
+            D3D12_RESOURCE_BARRIER_FLAGS flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            if (barrier.flags & FFX_BARRIER_RECORD_FLAG_BEGIN_ONLY) {
+                flags = D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
+            }
+            else if (barrier.flags & FFX_BARRIER_RECORD_FLAG_END_ONLY) {
+                flags = D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+            }
+            dx12Barriers[i] = CD3DX12_RESOURCE_BARRIER::Transition(
+                dx12Resource,
+                ffxGetDX12StateFromResourceState(barrier.stateBefore),
+                ffxGetDX12StateFromResourceState(barrier.stateAfter),
+                D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES,
+                flags);
+            break;
+        }
+        case FFX_BARRIER_RECORD_UAV:
+            dx12Barriers[i] = CD3DX12_RESOURCE_BARRIER::UAV(dx12Resource);
+            break;
+        case FFX_BARRIER_RECORD_ALIASING:
+            dx12Barriers[i] = CD3DX12_RESOURCE_BARRIER::Aliasing(nullptr, nullptr);
+            break;
+        }
+    }
 
-        *currentState = newState;
-        ++backendContext->barrierCount;
+    dx12CommandList->ResourceBarrier(barrierCount, dx12Barriers);
+}
 
-    }
-    else if (newState == FFX_RESOURCE_STATE_UNORDERED_ACCESS) {
+void addBarrier(BackendContext_DX12* backendContext, ID3D12GraphicsCommandList* dx12CommandList, FfxResourceInternal* resource, FfxResourceStates newState)
+{
+    FFX_ASSERT(NULL != backendContext);
+    FFX_ASSERT(NULL != resource);
 
-        *barrier = CD3DX12_RESOURCE_BARRIER::UAV(dx12Resource);
-        ++backendContext->barrierCount;
-    }
+    ffxBarrierPlannerTransition(&backendContext->barrierPlanner, dx12CommandList, resource->internalIndex, newState);
 }
 
 void flushBarriers(BackendContext_DX12* backendContext, ID3D12GraphicsCommandList* dx12CommandList)
@@ -878,11 +1132,13 @@ void flushBarriers(BackendContext_DX12* backendContext, ID3D12GraphicsCommandLis
     FFX_ASSERT(NULL != backendContext);
     FFX_ASSERT(NULL != dx12CommandList);
 
-    if (backendContext->barrierCount > 0) {
+    ffxBarrierPlannerFlush(&backendContext->barrierPlanner, dx12CommandList);
+}
 
-        dx12CommandList->ResourceBarrier(backendContext->barrierCount, backendContext->barriers);
-        backendContext->barrierCount = 0;
-    }
+// Record that a job accessed a resource as a UAV, so the next UAV use needs a UAV barrier
+static void markUavAccess(BackendContext_DX12* backendContext, const FfxResourceInternal& resource)
+{
+    ffxBarrierPlannerMarkUavAccess(&backendContext->barrierPlanner, resource.internalIndex);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -946,6 +1202,198 @@ FfxErrorCode GetEffectGpuMemoryUsageDX12(FfxInterface* backendInterface, FfxUInt
     return FFX_OK;
 }
 
+FfxErrorCode ffxGetBarrierStatisticsDX12(FfxInterface* backendInterface, FfxEffect effect, FfxBarrierStatisticsDX12* outStatistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(outStatistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    *outStatistics = {};
+    for (uint32_t i = 0; i < backendContext->maxEffectContexts; ++i) {
+
+        const BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[i];
+        if (!effectContext.active || effectContext.effectId != effect) {
+            continue;
+        }
+
+        outStatistics->transitionBarriers += effectContext.barrierStatistics.transitionBarriers;
+        outStatistics->splitBarriers      += effectContext.barrierStatistics.splitBarriers;
+        outStatistics->uavBarriers        += effectContext.barrierStatistics.uavBarriers;
+        outStatistics->mergedBarriers     += effectContext.barrierStatistics.mergedBarriers;
+        outStatistics->skippedUavBarriers += effectContext.barrierStatistics.skippedUavBarriers;
+        outStatistics->flushCount         += effectContext.barrierStatistics.flushCount;
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxGetPipelineCacheStatisticsDX12(FfxInterface* backendInterface, FfxPipelineCacheStatisticsDX12* outStatistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(outStatistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    // without a context the cache is empty and its mutex does not exist
+    if (!backendContext->refCount) {
+        *outStatistics = backendContext->pipelineCacheStatistics;
+        outStatistics->cachedEntries     = 0;
+        outStatistics->referencedEntries = 0;
+        return FFX_OK;
+    }
+
+    std::lock_guard<std::mutex> cacheLock{ backendContext->pipelineCacheMutex };
+
+    *outStatistics = backendContext->pipelineCacheStatistics;
+    outStatistics->cachedEntries     = 0;
+    outStatistics->referencedEntries = 0;
+    for (uint32_t i = 0; i < FFX_MAX_PIPELINE_CACHE_ENTRIES; ++i) {
+
+        const BackendContext_DX12::PipelineCacheEntry& entry = backendContext->pipelineCache[i];
+        if (entry.pipeline) {
+            ++outStatistics->cachedEntries;
+            outStatistics->referencedEntries += entry.userCount ? 1 : 0;
+        }
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxGetTransientHeapStatisticsDX12(FfxInterface* backendInterface, FfxTransientHeapStatisticsDX12* outStatistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(outStatistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    // without a context there are no heaps and the mutex does not exist
+    *outStatistics = {};
+    if (!backendContext->refCount) {
+        return FFX_OK;
+    }
+
+    std::lock_guard<std::mutex> transientLock{ backendContext->transientHeapMutex };
+
+    for (uint32_t kind = 0; kind < FFX_TRANSIENT_HEAP_KIND_COUNT; ++kind) {
+
+        FfxTransientHeapPlannerStatistics plannerStatistics = {};
+        ffxTransientHeapPlannerGetStatistics(&backendContext->transientHeapPlanners[kind], &plannerStatistics);
+
+        outStatistics->heapCount         += plannerStatistics.heapCount;
+        outStatistics->placedResources   += plannerStatistics.placementCount;
+        outStatistics->heapBytes         += plannerStatistics.heapBytes;
+        outStatistics->placedBytes       += plannerStatistics.placedBytes;
+        outStatistics->peakPlacedBytes   += plannerStatistics.peakPlacedBytes;
+        outStatistics->committedFallbacks += plannerStatistics.failedPlacements;
+    }
+    outStatistics->committedFallbacks += backendContext->transientFallbackResources;
+    outStatistics->savedBytes = outStatistics->placedBytes > outStatistics->heapBytes ? outStatistics->placedBytes - outStatistics->heapBytes : 0;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxSetPassTimingFrequencyDX12(FfxInterface* backendInterface, uint64_t timestampFrequency)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    // the query heap is created on the first execute with timing enabled
+    if (!backendContext->refCount) {
+        backendContext->passTimingFrequency = timestampFrequency;
+        return FFX_OK;
+    }
+
+    std::lock_guard<std::mutex> timingLock{ backendContext->passTimingMutex };
+    backendContext->passTimingFrequency = timestampFrequency;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxSetPassTimingFenceDX12(FfxInterface* backendInterface, ID3D12Fence* fence, uint64_t signalValue)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    // without a context no execute can race with the update
+    std::unique_lock<std::mutex> timingLock;
+    if (backendContext->refCount) {
+        timingLock = std::unique_lock<std::mutex>{ backendContext->passTimingMutex };
+    }
+
+    if (fence) {
+        fence->AddRef();
+    }
+    if (backendContext->passTimingFence) {
+        backendContext->passTimingFence->Release();
+    }
+    backendContext->passTimingFence      = fence;
+    backendContext->passTimingFenceValue = signalValue;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxGetPassTimingsDX12(FfxInterface* backendInterface, FfxEffect effect, FfxPassTimingDX12* outTimings, uint32_t* inoutCount)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(inoutCount, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    // without a context there is nothing to report and the mutex does not exist
+    if (!backendContext->refCount) {
+        *inoutCount = 0;
+        return FFX_OK;
+    }
+
+    std::lock_guard<std::mutex> timingLock{ backendContext->passTimingMutex };
+
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < backendContext->maxEffectContexts; ++i) {
+
+        const BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[i];
+        if (!effectContext.active || effectContext.effectId != effect || !effectContext.pPassTimings) {
+            continue;
+        }
+
+        for (uint32_t pass = 0; pass < effectContext.pPassTimings->resultCount; ++pass) {
+            if (outTimings && count < *inoutCount) {
+                outTimings[count] = effectContext.pPassTimings->results[pass];
+            }
+            ++count;
+        }
+    }
+    *inoutCount = outTimings ? FFX_MINIMUM(count, *inoutCount) : count;
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxGetDescriptorStatisticsDX12(FfxInterface* backendInterface, FfxDescriptorStatisticsDX12* outStatistics)
+{
+    FFX_RETURN_ON_ERROR(backendInterface, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(outStatistics, FFX_ERROR_INVALID_POINTER);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    FfxDescriptorAllocatorStatistics allocatorStatistics = {};
+    if (backendContext->refCount) {
+        ffxDescriptorAllocatorGetStatistics(&backendContext->bindlessDescriptorAllocator, &allocatorStatistics);
+    }
+
+    outStatistics->capacity                 = allocatorStatistics.capacity;
+    outStatistics->allocatedDescriptors     = allocatorStatistics.allocatedDescriptors;
+    outStatistics->peakAllocatedDescriptors = allocatorStatistics.peakAllocatedDescriptors;
+    outStatistics->highWaterMark            = allocatorStatistics.highWaterMark;
+    outStatistics->freeRangeCount           = allocatorStatistics.freeRangeCount;
+    outStatistics->largestFreeRange         = allocatorStatistics.largestFreeRange;
+    outStatistics->failedAllocations        = allocatorStatistics.failedAllocations;
+    outStatistics->fragmentation            = allocatorStatistics.fragmentation;
+
+    return FFX_OK;
+}
+
 // initialize the DX12 backend
 FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId)
 {
@@ -961,7 +1409,11 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
     // Set things up if this is the first invocation
     if (!backendContext->refCount) {
 
+        // the scratch memory is only cleared, so the mutexes have to be constructed here
         new (&backendContext->constantBufferMutex) std::mutex();
+        new (&backendContext->pipelineCacheMutex) std::mutex();
+        new (&backendContext->transientHeapMutex) std::mutex();
+        new (&backendContext->passTimingMutex) std::mutex();
 
         if (dx12Device != NULL) {
 
@@ -974,6 +1426,7 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
         uint32_t resourceArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_MAX_RESOURCE_COUNT * sizeof(BackendContext_DX12::Resource), sizeof(uint64_t));
         uint32_t stagingRingBufferArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * FFX_CONSTANT_BUFFER_RING_BUFFER_SIZE, sizeof(uint32_t));
         uint32_t contextArraySize = FFX_ALIGN_UP(backendContext->maxEffectContexts * sizeof(BackendContext_DX12::EffectContext), sizeof(uint32_t));
+        uint32_t bindlessFreeRangeCount = backendContext->maxEffectContexts + 1;
 
         uint8_t* pMem = (uint8_t*)((BackendContext_DX12*)(backendContext + 1));
 
@@ -986,6 +1439,8 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
         backendContext->pResources = (BackendContext_DX12::Resource*)(pMem);
         memset(backendContext->pResources, 0, resourceArraySize);
         pMem += resourceArraySize;
+        ffxBarrierPlannerInit(&backendContext->barrierPlanner, &backendContext->pResources[0].barrierState, sizeof(BackendContext_DX12::Resource),
+                              issueBarriersDX12, backendContext);
 
         // Map the staging buffer
         backendContext->pStagingRingBuffer = (uint8_t*)(pMem);
@@ -995,6 +1450,10 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
         // Map the effect contexts
         backendContext->pEffectContexts = reinterpret_cast<BackendContext_DX12::EffectContext*>(pMem);
         memset(backendContext->pEffectContexts, 0, contextArraySize);
+        pMem += contextArraySize;
+
+        // Map the bindless free list, every live context can split at most one free range
+        FfxDescriptorRange* pBindlessFreeRanges = reinterpret_cast<FfxDescriptorRange*>(pMem);
 
         // CPUVisible
         D3D12_DESCRIPTOR_HEAP_DESC descHeap;
@@ -1025,6 +1484,13 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
 
         // initialize the bindless offset to *after* the ring-buffer 
         backendContext->descBindlessBase = FFX_RING_BUFFER_DESCRIPTOR_COUNT * backendContext->maxEffectContexts;
+        ffxDescriptorAllocatorInit(&backendContext->bindlessDescriptorAllocator, backendContext->descBindlessBase, FFX_MAX_STATIC_DESCRIPTOR_COUNT, pBindlessFreeRanges, bindlessFreeRangeCount);
+
+        // no transient heap is created until an effect places a dispatch transient resource
+        for (uint32_t kind = 0; kind < FFX_TRANSIENT_HEAP_KIND_COUNT; ++kind) {
+            ffxTransientHeapPlannerInit(&backendContext->transientHeapPlanners[kind], FFX_TRANSIENT_HEAP_MINIMUM_SIZE);
+        }
+        backendContext->transientFallbackResources = 0;
 
         // DXGI factory used for memory usage tracking
         result = CreateDXGIFactory2(0, IID_PPV_ARGS(&backendContext->dxgiFactory));
@@ -1044,6 +1510,12 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
             BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[i];
             effectContext.active = true;
             effectContext.effectId = effect;
+            effectContext.barrierStatistics = {};
+            effectContext.vramUsage = {};
+            for (uint32_t kind = 0; kind < FFX_TRANSIENT_HEAP_KIND_COUNT; ++kind) {
+                ffxTransientHeapCursorReset(&effectContext.transientHeapCursors[kind]);
+            }
+            effectContext.pPassTimings = nullptr;
 
             effectContext.nextStaticResource = (i * FFX_MAX_RESOURCE_COUNT) + 1;
             effectContext.nextDynamicResource = (i * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
@@ -1054,7 +1526,12 @@ FfxErrorCode CreateBackendContextDX12(FfxInterface* backendInterface, FfxEffect
             {
                 uint32_t numDescriptors = bindlessConfig->maxTextureSrvs + bindlessConfig->maxBufferSrvs + bindlessConfig->maxTextureUavs + bindlessConfig->maxBufferUavs;
 
-                uint32_t bindlessBase = getFreeBindlessDescriptorBlock(backendContext, numDescriptors, i);
+                uint32_t bindlessBase = 0;
+                if (!ffxDescriptorAllocatorAllocate(&backendContext->bindlessDescriptorAllocator, numDescriptors, &bindlessBase)) {
+                    FFX_ASSERT_MESSAGE(false, "FFXInterface: DX12: Out of static descriptors for bindless resources.");
+                    DestroyBackendContextDX12(backendInterface, i);
+                    return FFX_ERROR_OUT_OF_MEMORY;
+                }
 
                 effectContext.bindlessBufferHeapStart = bindlessBase;
                 effectContext.bindlessBufferHeapEnd = bindlessBase + numDescriptors;
@@ -1211,6 +1688,32 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
         }
     }
 
+    // Return the bindless descriptors of this context
+    ffxDescriptorAllocatorFree(&backendContext->bindlessDescriptorAllocator,
+                               effectContext.bindlessBufferHeapStart,
+                               effectContext.bindlessBufferHeapEnd - effectContext.bindlessBufferHeapStart);
+    effectContext.bindlessBufferHeapStart = 0;
+    effectContext.bindlessBufferHeapEnd   = 0;
+
+    // Transient heaps created by this context stay alive while other contexts place resources in them
+    {
+        std::lock_guard<std::mutex> transientLock{ backendContext->transientHeapMutex };
+        for (uint32_t kind = 0; kind < FFX_TRANSIENT_HEAP_KIND_COUNT; ++kind) {
+            for (uint32_t i = 0; i < backendContext->transientHeapPlanners[kind].heapCount; ++i) {
+                if (backendContext->transientHeapOwners[kind][i] == effectContextId) {
+                    backendContext->transientHeapOwners[kind][i] = UINT32_MAX;
+                }
+            }
+        }
+    }
+
+    // Drop the pass timings of this context
+    {
+        std::lock_guard<std::mutex> timingLock{ backendContext->passTimingMutex };
+        delete effectContext.pPassTimings;
+        effectContext.pPassTimings = nullptr;
+    }
+
     // Free up for use by another context
     effectContext.nextStaticResource = 0;
     effectContext.active = false;
@@ -1231,7 +1734,37 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
         }
 
         backendContext->gpuJobCount             = 0;
-        backendContext->barrierCount            = 0;
+        ffxBarrierPlannerReset(&backendContext->barrierPlanner);
+
+        // release the shared root signatures and PSOs
+        for (uint32_t i = 0; i < FFX_MAX_PIPELINE_CACHE_ENTRIES; ++i) {
+            BackendContext_DX12::PipelineCacheEntry& entry = backendContext->pipelineCache[i];
+            if (entry.pipeline) {
+                FFX_ASSERT_MESSAGE(entry.userCount == 0, "FFXInterface: DX12: SDK Pipeline was not destroyed prior to destroying the backend context.");
+                releasePipelineCacheEntry(entry);
+            }
+        }
+
+        // release the pass timing queries
+        if (backendContext->passTimingReadback) {
+            backendContext->passTimingReadback->Unmap(0, nullptr);
+            backendContext->passTimingReadback->Release();
+            backendContext->passTimingReadback = nullptr;
+            backendContext->passTimingData     = nullptr;
+        }
+        if (backendContext->passTimingQueryHeap) {
+            backendContext->passTimingQueryHeap->Release();
+            backendContext->passTimingQueryHeap = nullptr;
+        }
+        if (backendContext->passTimingFence) {
+            backendContext->passTimingFence->Release();
+            backendContext->passTimingFence = nullptr;
+        }
+
+        // every placement is gone by now, which released the transient heaps
+        for (uint32_t kind = 0; kind < FFX_TRANSIENT_HEAP_KIND_COUNT; ++kind) {
+            FFX_ASSERT(backendContext->transientHeapPlanners[kind].heapCount == 0);
+        }
 
         // release heaps
         backendContext->descHeapRtvCpu->Release();
@@ -1249,6 +1782,12 @@ FfxErrorCode DestroyBackendContextDX12(FfxInterface* backendInterface, FfxUInt32
             backendContext->dxgiFactory->Release();
             backendContext->dxgiFactory = NULL;
         }
+
+        // constructed by the first CreateBackendContextDX12
+        backendContext->constantBufferMutex.~mutex();
+        backendContext->pipelineCacheMutex.~mutex();
+        backendContext->transientHeapMutex.~mutex();
+        backendContext->passTimingMutex.~mutex();
     }
 
     return FFX_OK;
@@ -1300,6 +1839,7 @@ FfxErrorCode CreateResourceDX12(
     outTexture->internalIndex = effectContext.nextStaticResource++;
     BackendContext_DX12::Resource* backendResource = &backendContext->pResources[outTexture->internalIndex];
     backendResource->resourceDescription = createResourceDescription->resourceDescription;
+    backendResource->transientSize = 0;
 
     const auto& initData = createResourceDescription->initData;
 
@@ -1352,6 +1892,7 @@ FfxErrorCode CreateResourceDX12(
     }
 
     ID3D12Resource* dx12Resource = nullptr;
+    uint64_t transientHeapBytes = 0;
     if (createResourceDescription->heapType == FFX_HEAP_TYPE_UPLOAD) {
 
         D3D12_PLACED_SUBRESOURCE_FOOTPRINT dx12Footprint = {};
@@ -1378,7 +1919,7 @@ FfxErrorCode CreateResourceDX12(
 
         TIF(dx12Device->CreateCommittedResource(&dx12HeapProperties, D3D12_HEAP_FLAG_NONE, &dx12UploadBufferDescription, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&dx12Resource)));
         backendResource->initialState = FFX_RESOURCE_STATE_GENERIC_READ;
-        backendResource->currentState = FFX_RESOURCE_STATE_GENERIC_READ;
+        ffxBarrierResourceStateReset(&backendResource->barrierState, FFX_RESOURCE_STATE_GENERIC_READ);
 
         D3D12_RANGE dx12EmptyRange = {};
         void* uploadBufferData = nullptr;
@@ -1419,9 +1960,24 @@ FfxErrorCode CreateResourceDX12(
         // Buffers ignore any input state and create in common (but issue a warning)
         const D3D12_RESOURCE_STATES dx12ResourceStates = dx12ResourceDescription.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER ? D3D12_RESOURCE_STATE_COMMON : ffxGetDX12StateFromResourceState(resourceStates);
 
-        TIF(dx12Device->CreateCommittedResource(&dx12HeapProperties, D3D12_HEAP_FLAG_NONE, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)));
+        // Resources written before they are read in every dispatch share memory with those of the other effects
+        const bool isTransient = ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT) == FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT)
+                              && (createResourceDescription->heapType == FFX_HEAP_TYPE_DEFAULT)
+                              && (initData.type == FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED)
+                              && canAliasEffectResources(effectContext.effectId);
+        if (isTransient) {
+            std::lock_guard<std::mutex> transientLock{ backendContext->transientHeapMutex };
+            dx12Resource = createTransientResource(backendContext, effectContextId, backendResource, dx12ResourceDescription, dx12ResourceStates, &transientHeapBytes);
+            if (!dx12Resource) {
+                ++backendContext->transientFallbackResources;
+            }
+        }
+
+        if (!dx12Resource) {
+            TIF(dx12Device->CreateCommittedResource(&dx12HeapProperties, D3D12_HEAP_FLAG_NONE, &dx12ResourceDescription, dx12ResourceStates, nullptr, IID_PPV_ARGS(&dx12Resource)));
+        }
         backendResource->initialState = resourceStates;
-        backendResource->currentState = resourceStates;
+        ffxBarrierResourceStateReset(&backendResource->barrierState, resourceStates);
 
         dx12Resource->SetName(createResourceDescription->name);
         backendResource->resourcePtr = dx12Resource;
@@ -1614,10 +2170,19 @@ FfxErrorCode CreateResourceDX12(
     
     uint64_t vramAfter = GetCurrentGpuMemoryUsageDX12(backendInterface);
     uint64_t vramDelta = vramAfter - vramBefore;
-    effectContext.vramUsage.totalUsageInBytes += vramDelta;
-    if ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+    if (backendResource->transientSize)
     {
-        effectContext.vramUsage.aliasableUsageInBytes += vramDelta;
+        // only the heaps created for this resource are new memory, the rest is shared with other effects
+        effectContext.vramUsage.totalUsageInBytes += transientHeapBytes;
+        effectContext.vramUsage.aliasableUsageInBytes += backendResource->transientSize;
+    }
+    else
+    {
+        effectContext.vramUsage.totalUsageInBytes += vramDelta;
+        if ((createResourceDescription->resourceDescription.flags & FFX_RESOURCE_FLAGS_ALIASABLE) == FFX_RESOURCE_FLAGS_ALIASABLE)
+        {
+            effectContext.vramUsage.aliasableUsageInBytes += vramDelta;
+        }
     }
 
     return FFX_OK;
@@ -1635,7 +2200,18 @@ FfxErrorCode DestroyResourceDX12(
 	if ((resource.internalIndex >= int32_t(effectContextId * FFX_MAX_RESOURCE_COUNT)) && (resource.internalIndex < int32_t(effectContext.nextStaticResource))) {
 		ID3D12Resource* dx12Resource = getDX12ResourcePtr(backendContext, resource.internalIndex);
 
-		if (dx12Resource) {
+		if (dx12Resource && backendContext->pResources[resource.internalIndex].transientSize) {
+
+            // the shared heap outlives the resource, so only its placement is given back
+            effectContext.vramUsage.aliasableUsageInBytes -= backendContext->pResources[resource.internalIndex].transientSize;
+            dx12Resource->Release();
+
+            std::lock_guard<std::mutex> transientLock{ backendContext->transientHeapMutex };
+            releaseTransientResource(backendContext, effectContext, &backendContext->pResources[resource.internalIndex]);
+
+			backendContext->pResources[resource.internalIndex].resourcePtr = nullptr;
+		}
+		else if (dx12Resource) {
 
             uint64_t vramBefore = GetCurrentGpuMemoryUsageDX12(backendInterface);
 
@@ -1758,7 +2334,7 @@ FfxErrorCode RegisterResourceDX12(
     BackendContext_DX12::Resource* backendResource = &backendContext->pResources[outFfxResourceInternal->internalIndex];
     backendResource->resourcePtr = dx12Resource;
     backendResource->initialState = state;
-    backendResource->currentState = state;
+    ffxBarrierResourceStateReset(&backendResource->barrierState, state); // the application may have written it
 
 #ifdef _DEBUG
     const wchar_t* name = inFfxResource->name;
@@ -1981,7 +2557,7 @@ FfxResource GetResourceDX12(FfxInterface* backendInterface, FfxResourceInternal
 
     FfxResource resource = {};
     resource.resource = resource.resource = reinterpret_cast<void*>(backendContext->pResources[inResource.internalIndex].resourcePtr);
-    resource.state = backendContext->pResources[inResource.internalIndex].currentState;
+    resource.state = backendContext->pResources[inResource.internalIndex].barrierState.currentState;
     resource.description = ffxResDescription;
 
 #ifdef _DEBUG
@@ -2001,6 +2577,9 @@ FfxErrorCode UnregisterResourcesDX12(FfxInterface* backendInterface, FfxCommandL
     BackendContext_DX12* backendContext = (BackendContext_DX12*)(backendInterface->scratchBuffer);
     BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
 
+    FFX_ASSERT(nullptr != commandList);
+    ID3D12GraphicsCommandList* pCmdList = reinterpret_cast<ID3D12GraphicsCommandList*>(commandList);
+
     // Walk back all the resources that don't belong to us and reset them to their initial state
     for (uint32_t resourceIndex = ++effectContext.nextDynamicResource; resourceIndex < (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT; ++resourceIndex)
     {
@@ -2008,12 +2587,9 @@ FfxErrorCode UnregisterResourcesDX12(FfxInterface* backendInterface, FfxCommandL
         internalResource.internalIndex = resourceIndex;
 
         BackendContext_DX12::Resource* backendResource = &backendContext->pResources[resourceIndex];
-        addBarrier(backendContext, &internalResource, backendResource->initialState);
+        addBarrier(backendContext, pCmdList, &internalResource, backendResource->initialState);
     }
 
-    FFX_ASSERT(nullptr != commandList);
-    ID3D12GraphicsCommandList* pCmdList = reinterpret_cast<ID3D12GraphicsCommandList*>(commandList);
-
     flushBarriers(backendContext, pCmdList);
 
     effectContext.nextDynamicResource      = (effectContextId * FFX_MAX_RESOURCE_COUNT) + FFX_MAX_RESOURCE_COUNT - 1;
@@ -2384,10 +2960,27 @@ FfxErrorCode CreatePipelineDX12(
     BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
     ID3D12Device* dx12Device = backendContext->device;
 
+    const auto creationStart = std::chrono::high_resolution_clock::now();
+
     FfxShaderBlob shaderBlob = { };
     backendInterface->fpGetPermutationBlobByIndex(effect, pass, FFX_BIND_COMPUTE_SHADER_STAGE, permutationOptions, &shaderBlob);
     FFX_ASSERT(shaderBlob.data && shaderBlob.size);
 
+    // Look for a root signature and PSO already created by another pipeline with the same layout
+    const uint64_t pipelineHash = hashPipelineDescription(shaderBlob, pipelineDescription);
+    ID3D12PipelineState* cachedPipeline = nullptr;
+    {
+        std::lock_guard<std::mutex> cacheLock{ backendContext->pipelineCacheMutex };
+        BackendContext_DX12::PipelineCacheEntry* cacheEntry = findPipelineCacheEntry(backendContext, pipelineHash, shaderBlob.size);
+        if (cacheEntry) {
+            ++cacheEntry->userCount;
+            cacheEntry->rootSignature->AddRef();
+            cacheEntry->pipeline->AddRef();
+            outPipeline->rootSignature = cacheEntry->rootSignature;
+            cachedPipeline = cacheEntry->pipeline;
+        }
+    }
+
     int32_t staticTextureSrvCount = 0;
     int32_t staticBufferSrvCount  = 0;
     int32_t staticTextureUavCount = 0;
@@ -2399,8 +2992,7 @@ FfxErrorCode CreatePipelineDX12(
     int32_t staticBufferUavSpace  = -1;
 
     // set up root signature
-    // easiest implementation: simply create one root signature per pipeline
-    // should add some management later on to avoid unnecessarily re-binding the root signature
+    // root signatures are shared through the pipeline cache, only the binding counts are needed on a hit
     {
         FFX_ASSERT(pipelineDescription->samplerCount <= FFX_MAX_SAMPLERS);
         const size_t samplerCount = pipelineDescription->samplerCount;
@@ -2696,7 +3288,10 @@ FfxErrorCode CreatePipelineDX12(
         //Do not pass hD3D12 handle to the FreeLibrary function, as GetModuleHandle will not increment refcount
         HMODULE d3d12ModuleHandle = GetModuleHandleW(L"D3D12.dll");
 
-        if (NULL != d3d12ModuleHandle) {
+        if (cachedPipeline) {
+
+            // root signature was taken from the cache
+        } else if (NULL != d3d12ModuleHandle) {
 
             D3D12SerializeRootSignatureType dx12SerializeRootSignatureType = (D3D12SerializeRootSignatureType)GetProcAddress(d3d12ModuleHandle, "D3D12SerializeRootSignature");
 
@@ -2903,13 +3498,39 @@ FfxErrorCode CreatePipelineDX12(
     dx12PipelineStateDescription.CS.pShaderBytecode = shaderBlob.data;
     dx12PipelineStateDescription.CS.BytecodeLength = shaderBlob.size;
 
-    if (FAILED(dx12Device->CreateComputePipelineState(&dx12PipelineStateDescription, IID_PPV_ARGS(reinterpret_cast<ID3D12PipelineState**>(&outPipeline->pipeline)))))
-        return FFX_ERROR_BACKEND_API_ERROR;
+    if (cachedPipeline) {
+
+        outPipeline->pipeline = cachedPipeline;
+    } else {
 
-    // Set the pipeline name
-    reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline)->SetName(pipelineDescription->name);
+        if (FAILED(dx12Device->CreateComputePipelineState(&dx12PipelineStateDescription, IID_PPV_ARGS(reinterpret_cast<ID3D12PipelineState**>(&outPipeline->pipeline)))))
+            return FFX_ERROR_BACKEND_API_ERROR;
+
+        // Set the pipeline name
+        reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline)->SetName(pipelineDescription->name);
+    }
     wcscpy_s(outPipeline->name, pipelineDescription->name);
 
+    const uint64_t creationTime = uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - creationStart).count());
+
+    std::lock_guard<std::mutex> cacheLock{ backendContext->pipelineCacheMutex };
+    if (cachedPipeline) {
+
+        ++backendContext->pipelineCacheStatistics.cacheHits;
+        backendContext->pipelineCacheStatistics.hitTimeMicroseconds += creationTime;
+    } else {
+
+        ++backendContext->pipelineCacheStatistics.cacheMisses;
+        backendContext->pipelineCacheStatistics.creationTimeMicroseconds += creationTime;
+
+        // Another thread may have cached the same layout in the meantime, in which case this pipeline keeps its own objects
+        if (!findPipelineCacheEntry(backendContext, pipelineHash, shaderBlob.size)) {
+            dx12RootSignature->AddRef();
+            reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline)->AddRef();
+            insertPipelineCacheEntry(backendContext, pipelineHash, shaderBlob.size, dx12RootSignature, reinterpret_cast<ID3D12PipelineState*>(outPipeline->pipeline));
+        }
+    }
+
     return FFX_OK;
 }
 
@@ -2923,6 +3544,20 @@ FfxErrorCode DestroyPipelineDX12(
         return FFX_OK;
     }
 
+    // drop this pipeline's use of its cache entry, the cache keeps its own references until the entry is evicted
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+    if (pipeline->pipeline) {
+        std::lock_guard<std::mutex> cacheLock{ backendContext->pipelineCacheMutex };
+        for (uint32_t i = 0; i < FFX_MAX_PIPELINE_CACHE_ENTRIES; ++i) {
+            BackendContext_DX12::PipelineCacheEntry& entry = backendContext->pipelineCache[i];
+            if (entry.pipeline == pipeline->pipeline) {
+                FFX_ASSERT(entry.userCount > 0);
+                --entry.userCount;
+                break;
+            }
+        }
+    }
+
     // destroy Rootsignature
     ID3D12RootSignature* dx12RootSignature = reinterpret_cast<ID3D12RootSignature*>(pipeline->rootSignature);
     if (dx12RootSignature) {
@@ -2959,12 +3594,30 @@ FfxErrorCode ScheduleGpuJobDX12(
 
     FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    memcpy(&backendContext->pGpuJobs[backendContext->gpuJobCount], job, ffxGetGpuJobDescriptionSize(job));
     backendContext->gpuJobCount++;
 
     return FFX_OK;
 }
 
+FfxErrorCode ScheduleGpuJobsDX12(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != jobs || 0 == jobCount);
+
+    BackendContext_DX12* backendContext = (BackendContext_DX12*)backendInterface->scratchBuffer;
+
+    FFX_ASSERT(backendContext->gpuJobCount + jobCount <= FFX_MAX_GPU_JOBS);
+
+    FfxGpuJobDescription* dstJobs = &backendContext->pGpuJobs[backendContext->gpuJobCount];
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        memcpy(&dstJobs[jobIndex], &jobs[jobIndex], ffxGetGpuJobDescriptionSize(&jobs[jobIndex]));
+    }
+    backendContext->gpuJobCount += jobCount;
+
+    return FFX_OK;
+}
+
 static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendContext,
                                          FfxGpuJobDescription*      job,
                                          ID3D12GraphicsCommandList* dx12CommandList,
@@ -3019,7 +3672,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
             // Set Texture UAVs
             for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex) {
 
-                addBarrier(backendContext, &job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+                addBarrier(backendContext, dx12CommandList, &job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
                 const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavTextureBindings[currentPipelineUavIndex];
 
@@ -3048,7 +3701,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 if (job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource.internalIndex == 0)
                     continue;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+                addBarrier(backendContext, dx12CommandList, &job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
 
                 const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.uavBufferBindings[currentPipelineUavIndex];
 
@@ -3139,7 +3792,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 if (job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource.internalIndex == 0)
                     break;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+                addBarrier(backendContext, dx12CommandList, &job->computeJobDescriptor.srvTextures[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
                 const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvTextureBindings[currentPipelineSrvIndex];
 
@@ -3165,7 +3818,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
                 if (job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource.internalIndex == 0)
                     continue;
 
-                addBarrier(backendContext, &job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
+                addBarrier(backendContext, dx12CommandList, &job->computeJobDescriptor.srvBuffers[currentPipelineSrvIndex].resource, FFX_RESOURCE_STATE_COMPUTE_READ);
 
                 const FfxResourceBinding binding = job->computeJobDescriptor.pipeline.srvBufferBindings[currentPipelineSrvIndex];
 
@@ -3256,7 +3909,7 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
     // If we are dispatching indirectly, transition the argument resource to indirect argument
     if (job->computeJobDescriptor.pipeline.cmdSignature)
     {
-        addBarrier(backendContext, &job->computeJobDescriptor.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+        addBarrier(backendContext, dx12CommandList, &job->computeJobDescriptor.cmdArgument, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
     }
 
     flushBarriers(backendContext, dx12CommandList);
@@ -3298,6 +3951,16 @@ static FfxErrorCode executeGpuJobCompute(BackendContext_DX12*       backendConte
         dx12CommandList->Dispatch(job->computeJobDescriptor.dimensions[0], job->computeJobDescriptor.dimensions[1], job->computeJobDescriptor.dimensions[2]);
     }
 
+    // Track UAV accesses so later barriers on these resources are only issued when needed
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavTextureCount; ++currentPipelineUavIndex)
+    {
+        markUavAccess(backendContext, job->computeJobDescriptor.uavTextures[currentPipelineUavIndex].resource);
+    }
+    for (uint32_t currentPipelineUavIndex = 0; currentPipelineUavIndex < job->computeJobDescriptor.pipeline.uavBufferCount; ++currentPipelineUavIndex)
+    {
+        markUavAccess(backendContext, job->computeJobDescriptor.uavBuffers[currentPipelineUavIndex].resource);
+    }
+
     return FFX_OK;
 }
 
@@ -3310,8 +3973,8 @@ static FfxErrorCode executeGpuJobCopy(BackendContext_DX12* backendContext, FfxGp
     D3D12_RESOURCE_DESC dx12ResourceDescriptionDst = dx12ResourceDst->GetDesc();
     D3D12_RESOURCE_DESC dx12ResourceDescriptionSrc = dx12ResourceSrc->GetDesc();
 
-    addBarrier(backendContext, &job->copyJobDescriptor.src, FFX_RESOURCE_STATE_COPY_SRC);
-    addBarrier(backendContext, &job->copyJobDescriptor.dst, FFX_RESOURCE_STATE_COPY_DEST);
+    addBarrier(backendContext, dx12CommandList, &job->copyJobDescriptor.src, FFX_RESOURCE_STATE_COPY_SRC);
+    addBarrier(backendContext, dx12CommandList, &job->copyJobDescriptor.dst, FFX_RESOURCE_STATE_COPY_DEST);
     flushBarriers(backendContext, dx12CommandList);
 
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT dx12Footprint = {};
@@ -3363,7 +4026,7 @@ static FfxErrorCode executeGpuJobCopy(BackendContext_DX12* backendContext, FfxGp
 
 static FfxErrorCode executeGpuJobBarrier(BackendContext_DX12* backendContext, FfxGpuJobDescription* job, ID3D12GraphicsCommandList* dx12CommandList)
 {
-    addBarrier(backendContext, &job->barrierDescriptor.resource, job->barrierDescriptor.newState);
+    addBarrier(backendContext, dx12CommandList, &job->barrierDescriptor.resource, job->barrierDescriptor.newState);
     flushBarriers(backendContext, dx12CommandList);
 
     return FFX_OK;
@@ -3374,6 +4037,65 @@ static FfxErrorCode executeGpuJobTimestamp(BackendContext_DX12*, FfxGpuJobDescri
     return FFX_OK;
 }
 
+// Create the query heap and readback buffer shared by all contexts the first time timing is used
+static bool preparePassTimings(BackendContext_DX12* backendContext, BackendContext_DX12::EffectContext& effectContext)
+{
+    if (!backendContext->passTimingQueryHeap) {
+
+        ID3D12Device*  dx12Device = backendContext->device;
+        const uint32_t queryCount = backendContext->maxEffectContexts * FFX_PASS_TIMING_FRAME_COUNT * FFX_MAX_PASS_TIMINGS * 2;
+
+        D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
+        queryHeapDesc.Type  = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+        queryHeapDesc.Count = queryCount;
+        if (FAILED(dx12Device->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&backendContext->passTimingQueryHeap)))) {
+            return false;
+        }
+
+        CD3DX12_RESOURCE_DESC   readbackDesc = CD3DX12_RESOURCE_DESC::Buffer(queryCount * sizeof(uint64_t));
+        CD3DX12_HEAP_PROPERTIES readbackHeap(D3D12_HEAP_TYPE_READBACK);
+        void*                   readbackData = nullptr;
+        if (FAILED(dx12Device->CreateCommittedResource(&readbackHeap, D3D12_HEAP_FLAG_NONE, &readbackDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&backendContext->passTimingReadback))) ||
+            FAILED(backendContext->passTimingReadback->Map(0, nullptr, &readbackData))) {
+
+            if (backendContext->passTimingReadback) {
+                backendContext->passTimingReadback->Release();
+                backendContext->passTimingReadback = nullptr;
+            }
+            backendContext->passTimingQueryHeap->Release();
+            backendContext->passTimingQueryHeap = nullptr;
+            return false;
+        }
+        backendContext->passTimingReadback->SetName(L"FFX_DX12_PassTimingReadback");
+
+        // stays mapped, a slot is only read once the GPU is done resolving into it
+        backendContext->passTimingData = static_cast<const uint64_t*>(readbackData);
+    }
+
+    if (!effectContext.pPassTimings) {
+        effectContext.pPassTimings = new BackendContext_DX12::PassTimings();
+    }
+
+    return true;
+}
+
+static void readPassTimings(BackendContext_DX12* backendContext, BackendContext_DX12::PassTimings* passTimings, const BackendContext_DX12::PassTimingFrame& frame, uint32_t queryBase)
+{
+    const uint64_t* timestamps     = backendContext->passTimingData + queryBase;
+    const double    toMicroseconds = 1000000.0 / double(backendContext->passTimingFrequency);
+
+    for (uint32_t i = 0; i < frame.count; ++i) {
+
+        const uint64_t begin = timestamps[2 * i + 0];
+        const uint64_t end   = timestamps[2 * i + 1];
+
+        FfxPassTimingDX12& result = passTimings->results[i];
+        wcscpy_s(result.label, frame.labels[i]);
+        result.microseconds = end >= begin ? double(end - begin) * toMicroseconds : 0.0;
+    }
+    passTimings->resultCount = frame.count;
+}
+
 static FfxErrorCode executeGpuJobClearFloat(BackendContext_DX12* backendContext, FfxGpuJobDescription* job, ID3D12GraphicsCommandList* dx12CommandList)
 {
     ID3D12Device* dx12Device = reinterpret_cast<ID3D12Device*>(backendContext->device);
@@ -3391,7 +4113,7 @@ static FfxErrorCode executeGpuJobClearFloat(BackendContext_DX12* backendContext,
 
     dx12CommandList->SetDescriptorHeaps(1, &backendContext->descHeapUavGpu);
 
-    addBarrier(backendContext, &job->clearJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    addBarrier(backendContext, dx12CommandList, &job->clearJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
     flushBarriers(backendContext, dx12CommandList);
 
     uint32_t clearColorAsUint[4];
@@ -3400,6 +4122,7 @@ static FfxErrorCode executeGpuJobClearFloat(BackendContext_DX12* backendContext,
     clearColorAsUint[2] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[2]);
     clearColorAsUint[3] = reinterpret_cast<uint32_t&> (job->clearJobDescriptor.color[3]);
     dx12CommandList->ClearUnorderedAccessViewUint(dx12GpuHandle, dx12CpuHandle, dx12Resource, clearColorAsUint, 0, nullptr);
+    markUavAccess(backendContext, job->clearJobDescriptor.target);
 
     return FFX_OK;
 }
@@ -3412,7 +4135,7 @@ static FfxErrorCode executeGpuJobDiscard(BackendContext_DX12*       backendConte
     BackendContext_DX12::Resource       ffxResource   = backendContext->pResources[idx];
     ID3D12Resource*                     dx12Resource  = reinterpret_cast<ID3D12Resource*>(ffxResource.resourcePtr);
 
-    addBarrier(backendContext, &job->discardJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    addBarrier(backendContext, dx12CommandList, &job->discardJobDescriptor.target, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
     flushBarriers(backendContext, dx12CommandList);
 
     dx12CommandList->DiscardResource(dx12Resource, nullptr);
@@ -3433,6 +4156,49 @@ FfxErrorCode ExecuteGpuJobsDX12(
 
     FfxErrorCode errorCode = FFX_OK;
 
+    // attribute the barriers of this batch to the effect
+    backendContext->barrierPlanner.statistics = &backendContext->pEffectContexts[effectContextId].barrierStatistics;
+
+    // the transient resources of this effect overlap those of the effect executed before it
+    BackendContext_DX12::EffectContext& effectContext = backendContext->pEffectContexts[effectContextId];
+    if (effectContext.transientHeapCursors[FFX_TRANSIENT_HEAP_KIND_BUFFER].placementCount || effectContext.transientHeapCursors[FFX_TRANSIENT_HEAP_KIND_TEXTURE].placementCount) {
+        ffxBarrierPlannerAliasing(&backendContext->barrierPlanner, dx12CommandList);
+    }
+
+    // open a timing slot for this execution. A slot still holding timestamps is only reused once
+    // the fence shows its resolve has executed, reading them back first. When every slot is still
+    // in flight this execution is not timed.
+    BackendContext_DX12::PassTimingFrame* timingFrame     = nullptr;
+    uint32_t                              timingQueryBase = 0;
+    {
+        std::lock_guard<std::mutex> timingLock{ backendContext->passTimingMutex };
+        if (backendContext->passTimingFrequency && backendContext->passTimingFence && preparePassTimings(backendContext, effectContext)) {
+
+            BackendContext_DX12::PassTimings* passTimings    = effectContext.pPassTimings;
+            const uint64_t                    completedValue = backendContext->passTimingFence->GetCompletedValue();
+
+            for (uint32_t i = 0; i < FFX_PASS_TIMING_FRAME_COUNT && !timingFrame; ++i) {
+
+                const uint32_t                        slot  = (passTimings->frameIndex + i) % FFX_PASS_TIMING_FRAME_COUNT;
+                BackendContext_DX12::PassTimingFrame* frame = &passTimings->frames[slot];
+                if (frame->count && completedValue < frame->fenceValue) {
+                    continue;
+                }
+
+                const uint32_t queryBase = (effectContextId * FFX_PASS_TIMING_FRAME_COUNT + slot) * FFX_MAX_PASS_TIMINGS * 2;
+                if (frame->count) {
+                    readPassTimings(backendContext, passTimings, *frame, queryBase);
+                }
+
+                passTimings->frameIndex = slot + 1;
+                frame->count            = 0;
+                frame->fenceValue       = backendContext->passTimingFenceValue;
+                timingFrame             = frame;
+                timingQueryBase         = queryBase;
+            }
+        }
+    }
+
     // execute all GpuJobs
     for (uint32_t currentGpuJobIndex = 0; currentGpuJobIndex < backendContext->gpuJobCount; ++currentGpuJobIndex) {
 
@@ -3443,6 +4209,12 @@ FfxErrorCode ExecuteGpuJobsDX12(
             beginMarkerDX12(backendContext, dx12CommandList, GpuJob->jobLabel);
         }
 
+        // Time labelled passes
+        const bool timePass = timingFrame && GpuJob->jobType == FFX_GPU_JOB_COMPUTE && GpuJob->jobLabel[0] && timingFrame->count < FFX_MAX_PASS_TIMINGS;
+        if (timePass) {
+            dx12CommandList->EndQuery(backendContext->passTimingQueryHeap, D3D12_QUERY_TYPE_TIMESTAMP, timingQueryBase + 2 * timingFrame->count);
+        }
+
         switch (GpuJob->jobType) {
 
             case FFX_GPU_JOB_CLEAR_FLOAT:
@@ -3455,6 +4227,7 @@ FfxErrorCode ExecuteGpuJobsDX12(
 
             case FFX_GPU_JOB_COMPUTE:
                 errorCode = executeGpuJobCompute(backendContext, GpuJob, dx12CommandList, effectContextId);
+                ffxBarrierPlannerBeginSplitBarriers(&backendContext->barrierPlanner, dx12CommandList, backendContext->pGpuJobs, backendContext->gpuJobCount, currentGpuJobIndex);
                 break;
 
             case FFX_GPU_JOB_BARRIER:
@@ -3468,11 +4241,28 @@ FfxErrorCode ExecuteGpuJobsDX12(
                 break;
         }
 
+        if (timePass) {
+            dx12CommandList->EndQuery(backendContext->passTimingQueryHeap, D3D12_QUERY_TYPE_TIMESTAMP, timingQueryBase + 2 * timingFrame->count + 1);
+            wcscpy_s(timingFrame->labels[timingFrame->count], GpuJob->jobLabel);
+            ++timingFrame->count;
+        }
+
         if (GpuJob->jobLabel[0]) {
             endMarkerDX12(backendContext, dx12CommandList);
         }
     }
 
+    if (timingFrame && timingFrame->count) {
+        dx12CommandList->ResolveQueryData(backendContext->passTimingQueryHeap, D3D12_QUERY_TYPE_TIMESTAMP,
+                                          timingQueryBase, 2 * timingFrame->count,
+                                          backendContext->passTimingReadback, timingQueryBase * sizeof(uint64_t));
+    }
+
+    // close any split barrier whose consumer was never reached
+    ffxBarrierPlannerEndSplitBarriers(&backendContext->barrierPlanner, dx12CommandList);
+
+    backendContext->barrierPlanner.statistics = nullptr;
+
     // check the execute function returned cleanly.
     FFX_RETURN_ON_ERROR(
         errorCode == FFX_OK,
@@ -26,6 +26,7 @@
 #include "FrameInterpolationSwapchainVK_UiComposition.h"
 
 #include <FidelityFX/host/ffx_assert.h>
+#include <ffx_frame_pacing.h>
 
 // enable manually what is needed
 // this mode will compose the UI on the graphics queue in the present call on the main thread
@@ -1088,7 +1089,9 @@ DWORD WINAPI interpolationThread(LPVOID param)
             SetThreadPriority(presenterThreadHandle, THREAD_PRIORITY_HIGHEST);
             SetThreadDescription(presenterThreadHandle, L"AMD FSR Presenter Thread");
 
-            SimpleMovingAverage<10, double> frameTime{};
+            FfxFramePacingEstimator framePacing{};
+            ffxFramePacingEstimatorReset(&framePacing);
+
             int64_t previousQpc = 0;
 
             while (!presenter->shutdown)
@@ -1112,28 +1115,14 @@ DWORD WINAPI interpolationThread(LPVOID param)
                     int64_t currentQpc = 0;
                     QueryPerformanceCounter(reinterpret_cast<LARGE_INTEGER*>(&currentQpc));
 
-                    const double deltaQpc = double(currentQpc - previousQpc) * (previousQpc > 0);
-                    previousQpc           = currentQpc;
+                    const int64_t deltaQpc = (currentQpc - previousQpc) * (previousQpc > 0);
+                    previousQpc            = currentQpc;
 
-                    // reset pacing averaging if delta > 10 fps,
                     int64_t qpcFrequency;
                     QueryPerformanceFrequency(reinterpret_cast<LARGE_INTEGER*>(&qpcFrequency));
-                    const float fTimeoutInSeconds       = 0.1f;
-                    double      deltaQpcResetThreashold = double(qpcFrequency * fTimeoutInSeconds);
-                    if ((deltaQpc > deltaQpcResetThreashold) || presenter->resetTimer)
-                    {
-                        frameTime.reset();
-                    }
-                    else
-                    {
-                        frameTime.update(deltaQpc);
-                    }
 
-                    // set presentation time for the real frame
-                    double  safetyMarginInSec       = 0.0001; // = 0.1ms
-                    int64_t       qpcSafetyMargin = int64_t(qpcFrequency * safetyMarginInSec);
-                    const int64_t conservativeAvg = int64_t(frameTime.getAverage() * 0.5 - frameTime.getVariance() * 0.1);
-                    const int64_t deltaToUse      = conservativeAvg > qpcSafetyMargin ? (conservativeAvg - qpcSafetyMargin) : 0;
+                    // set presentation time from the averaged frame time, see ffxFramePacingEstimatorUpdate
+                    const int64_t deltaToUse = ffxFramePacingEstimatorUpdate(&framePacing, deltaQpc, qpcFrequency, presenter->resetTimer);
                     entry.frames[PacingData::FrameType::Interpolated_1].presentQpcDelta = deltaToUse;
                     entry.frames[PacingData::FrameType::Real].presentQpcDelta           = deltaToUse;
 
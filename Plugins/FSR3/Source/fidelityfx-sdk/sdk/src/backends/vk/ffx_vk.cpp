@@ -54,6 +54,7 @@ FfxErrorCode           StageConstantBufferDataVK(FfxInterface* backendInterface,
 FfxErrorCode           CreatePipelineVK(FfxInterface* backendInterface, FfxEffect effect, FfxPass passId, uint32_t permutationOptions, const FfxPipelineDescription* desc, FfxUInt32 effectContextId, FfxPipelineState* outPass);
 FfxErrorCode           DestroyPipelineVK(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId);
 FfxErrorCode           ScheduleGpuJobVK(FfxInterface* backendInterface, const FfxGpuJobDescription* job);
+FfxErrorCode           ScheduleGpuJobsVK(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount);
 FfxErrorCode           ExecuteGpuJobsVK(FfxInterface* backendInterface, FfxCommandList commandList, FfxUInt32 effectContextId);
 FfxErrorCode           BreadcrumbsAllocBlockVK(FfxInterface* backendInterface, uint64_t blockBytes, FfxBreadcrumbsBlockData* blockData);
 void                   BreadcrumbsFreeBlockVK(FfxInterface* backendInterface, FfxBreadcrumbsBlockData* blockData);
@@ -339,6 +340,7 @@ FfxErrorCode ffxGetInterfaceVK(
     backendInterface->fpDestroyPipeline = DestroyPipelineVK;
     backendInterface->fpGetPermutationBlobByIndex = ffxGetPermutationBlobByIndex;
     backendInterface->fpScheduleGpuJob = ScheduleGpuJobVK;
+    backendInterface->fpScheduleGpuJobs = ScheduleGpuJobsVK;
     backendInterface->fpExecuteGpuJobs = ExecuteGpuJobsVK;
     backendInterface->fpBreadcrumbsAllocBlock = BreadcrumbsAllocBlockVK;
     backendInterface->fpBreadcrumbsFreeBlock = BreadcrumbsFreeBlockVK;
@@ -3594,12 +3596,31 @@ FfxErrorCode ScheduleGpuJobVK(FfxInterface* backendInterface, const FfxGpuJobDes
 
     FFX_ASSERT(backendContext->gpuJobCount < FFX_MAX_GPU_JOBS);
 
-    backendContext->pGpuJobs[backendContext->gpuJobCount] = *job;
+    memcpy(&backendContext->pGpuJobs[backendContext->gpuJobCount], job, ffxGetGpuJobDescriptionSize(job));
     backendContext->gpuJobCount++;
 
     return FFX_OK;
 }
 
+FfxErrorCode ScheduleGpuJobsVK(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount)
+{
+    FFX_ASSERT(NULL != backendInterface);
+    FFX_ASSERT(NULL != jobs || 0 == jobCount);
+
+    BackendContext_VK* backendContext = (BackendContext_VK*)backendInterface->scratchBuffer;
+
+    FFX_ASSERT(backendContext->gpuJobCount + jobCount <= FFX_MAX_GPU_JOBS);
+
+    FfxGpuJobDescription* dstJobs = &backendContext->pGpuJobs[backendContext->gpuJobCount];
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+    {
+        memcpy(&dstJobs[jobIndex], &jobs[jobIndex], ffxGetGpuJobDescriptionSize(&jobs[jobIndex]));
+    }
+    backendContext->gpuJobCount += jobCount;
+
+    return FFX_OK;
+}
+
 static FfxErrorCode executeGpuJobCompute(BackendContext_VK*    backendContext,
                                          FfxGpuJobDescription* job,
                                          VkCommandBuffer       vkCommandBuffer,
@@ -30,6 +30,7 @@
 #include <FidelityFX/gpu/blur/ffx_blur.h>
 
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_blur_private.h"
 
@@ -100,47 +101,19 @@ static wchar_t* getKernelSizeString(wchar_t* buffer, FfxBlurKernelSize kernelSiz
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup cbResourceBindingLookup(cbResourceBindingTable);
 
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    if (!cbResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -32,6 +32,7 @@
 #include <FidelityFX/host/ffx_brixelizer_raw.h>
 #include <FidelityFX/gpu/brixelizer/ffx_brixelizer_resources.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_brixelizer_raw_private.h"
 
@@ -184,83 +185,25 @@ static bool isExternalResource(uint32_t resourceId)
 
 static void patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvTextureIndex = 0; srvTextureIndex < inoutPipeline->srvTextureCount; ++srvTextureIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvTextureBindings[srvTextureIndex];
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvResourceBindingLookup(srvResourceBindingTable);
+    static const FfxBindingLookup uavResourceBindingLookup(uavResourceBindingTable);
+    static const FfxBindingLookup cbvResourceBindingLookup(cbvResourceBindingTable);
 
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
+    if (!srvResourceBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount, true))
+        return;
 
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
+    if (!srvResourceBindingLookup.resolve(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount, true))
+        return;
 
-    for (uint32_t srvBufferIndex = 0; srvBufferIndex < inoutPipeline->srvBufferCount; ++srvBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->srvBufferBindings[srvBufferIndex];
+    if (!uavResourceBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return;
 
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return;
+    if (!uavResourceBindingLookup.resolve(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount, true))
+        return;
 
-        binding.resourceIdentifier = srvResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t uavTextureIndex = 0; uavTextureIndex < inoutPipeline->uavTextureCount; ++uavTextureIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavTextureIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
-
-        inoutPipeline->uavTextureBindings[uavTextureIndex].resourceIdentifier = uavResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavBufferIndex = 0; uavBufferIndex < inoutPipeline->uavBufferCount; ++uavBufferIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->uavBufferBindings[uavBufferIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = uavResourceBindingTable[mapIndex].index + binding.arrayIndex;
-    }
-
-    for (uint32_t cbvIndex = 0; cbvIndex < inoutPipeline->constCount; ++cbvIndex)
-    {
-        FfxResourceBinding& binding = inoutPipeline->constantBufferBindings[cbvIndex];
-
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbvResourceBindingTable[mapIndex].name, binding.name))
-                break;
-        }
-        if (mapIndex == _countof(cbvResourceBindingTable))
-            return;
-
-        binding.resourceIdentifier = cbvResourceBindingTable[mapIndex].index;
-    }
+    if (!cbvResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return;
 }
 
 static uint32_t getPipelinePermutationFlags(uint32_t contextFlags, bool fp16, bool force64)
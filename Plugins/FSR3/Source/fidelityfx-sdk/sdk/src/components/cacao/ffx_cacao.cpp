@@ -32,6 +32,7 @@
 #include <FidelityFX/host/ffx_cacao.h>
 #include <FidelityFX/gpu/ffx_core.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_cacao_private.h"
 
@@ -330,47 +331,19 @@ void ffxCacaoUpdateConstants(FfxCacaoConstants*            consts,
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup constantBufferBindingLookup(constantBufferBindingTable);
 
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_CACAO_ARRAY_SIZE(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_CACAO_ARRAY_SIZE(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    if (!constantBufferBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -584,55 +557,17 @@ static FfxErrorCode createPipelineStates(FfxCacaoContext_Private* context)
     return FFX_OK;
 }
 
-static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacaoContextDescription* contextDescription)
+// Creates the internal resources whose size depends on the SSAO resolution
+static FfxErrorCode createSsaoResolutionResources(FfxCacaoContext_Private* context, const bool useDownsampledSsao, FfxResourceInternal* textures)
 {
-    // Check pointers are valid.
-    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
-
-    // Validate that all callbacks are set for the interface
-    FFX_RETURN_ON_ERROR(contextDescription->backendInterface.fpCreateBackendContext, FFX_ERROR_INCOMPLETE_INTERFACE);
-    FFX_RETURN_ON_ERROR(contextDescription->backendInterface.fpDestroyBackendContext, FFX_ERROR_INCOMPLETE_INTERFACE);
-
-    // If a scratch buffer is declared, then we must have a size
-    if (contextDescription->backendInterface.scratchBuffer)
-    {
-        FFX_RETURN_ON_ERROR(contextDescription->backendInterface.scratchBufferSize, FFX_ERROR_INCOMPLETE_INTERFACE);
-    }
-
-    memset(context, 0, sizeof(FfxCacaoContext_Private));
-    context->device = contextDescription->backendInterface.device;
-    memcpy(&context->contextDescription, contextDescription, sizeof(FfxCacaoContextDescription));
-
-    // Check version info - make sure we are linked with the right backend version
-    FfxVersionNumber version = context->contextDescription.backendInterface.fpGetSDKVersion(&context->contextDescription.backendInterface);
-    FFX_RETURN_ON_ERROR(version == FFX_SDK_MAKE_VERSION(1, 1, 1), FFX_ERROR_INVALID_VERSION);
-    
-    context->constantBuffer.num32BitEntries = sizeof(FfxCacaoConstants) / sizeof(uint32_t);
-
-    // Create the device
-    FfxErrorCode errorCode =
-        context->contextDescription.backendInterface.fpCreateBackendContext(&context->contextDescription.backendInterface, FFX_EFFECT_CACAO, nullptr, &context->effectContextId);
-    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
-
-#ifdef FFX_CACAO_ENABLE_PROFILING
-    errorStatus = gpuTimerInit(&context->gpuTimer, device);
-    if (errorStatus)
-    {
-        goto error_create_gpu_timer;
-    }
-#endif
-
-    context->useDownsampledSsao   = contextDescription->useDownsampledSsao;
+    FfxCacaoBufferSizeInfo  bufferSizeInfo;
+    FfxCacaoBufferSizeInfo* bsi = &bufferSizeInfo;
+    ffxCacaoUpdateBufferSizeInfo(context->contextDescription.width, context->contextDescription.height, useDownsampledSsao, bsi);
 
-    FfxCacaoBufferSizeInfo* bsi = &context->bufferSizeInfo;
-    ffxCacaoUpdateBufferSizeInfo(contextDescription->width, contextDescription->height, context->useDownsampledSsao, bsi);
-
-    // =======================================
-    // Init textures
     const FfxInternalResourceDescription internalSurfaceDesc[] = {
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_DEPTHS,
-         context->useDownsampledSsao ? L"CACAO_Deinterleaved_Depths_Downsampled" : L"CACAO_DeInterleaved_Depths",
+         useDownsampledSsao ? L"CACAO_Deinterleaved_Depths_Downsampled" : L"CACAO_DeInterleaved_Depths",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R16_FLOAT,
@@ -643,7 +578,7 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
          {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_NORMALS,
-         context->useDownsampledSsao ? L"CACAO_DeInterleaved_Normals_Downsampled" : L"CACAO_DeInterleaved_Normals",
+         useDownsampledSsao ? L"CACAO_DeInterleaved_Normals_Downsampled" : L"CACAO_DeInterleaved_Normals",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R8G8B8A8_SNORM,
@@ -654,7 +589,7 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
          {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING,
-         context->useDownsampledSsao ? L"CACAO_Ssao_Buffer_Ping_Downsampled" : L"CACAO_Ssao_Buffer_Ping",
+         useDownsampledSsao ? L"CACAO_Ssao_Buffer_Ping_Downsampled" : L"CACAO_Ssao_Buffer_Ping",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R8G8_UNORM,
@@ -665,7 +600,7 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
          {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PONG,
-         context->useDownsampledSsao ? L"CACAO_Ssao_Buffer_Pong_Downsampled" : L"CACAO_Ssao_Buffer_Pong",
+         useDownsampledSsao ? L"CACAO_Ssao_Buffer_Pong_Downsampled" : L"CACAO_Ssao_Buffer_Pong",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R8G8_UNORM,
@@ -676,7 +611,7 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
          {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_IMPORTANCE_MAP,
-         context->useDownsampledSsao ? L"CACAO_Importance_Map_Downsampled" : L"CACAO_Importance_Map",
+         useDownsampledSsao ? L"CACAO_Importance_Map_Downsampled" : L"CACAO_Importance_Map",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R8_UNORM,
@@ -687,7 +622,7 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
          {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
         {FFX_CACAO_RESOURCE_IDENTIFIER_IMPORTANCE_MAP_PONG,
-         context->useDownsampledSsao ? L"CACAO_Importance_Map_Pong_Downsampled" : L"CACAO_Importance_Map_Pong",
+         useDownsampledSsao ? L"CACAO_Importance_Map_Pong_Downsampled" : L"CACAO_Importance_Map_Pong",
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_UAV,
          FFX_SURFACE_FORMAT_R8_UNORM,
@@ -707,8 +642,83 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
         1, //CACAO_Importance_Map_Pong
     };
 
+    for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex)
+    {
+        const FfxInternalResourceDescription* currentSurfaceDescription = &internalSurfaceDesc[currentSurfaceIndex];
+        const FfxResourceType                 resourceType = currentSurfaceDescription->height > 1 ? FFX_RESOURCE_TYPE_TEXTURE2D : FFX_RESOURCE_TYPE_TEXTURE1D;
+        const FfxResourceDescription          resourceDescription       = {resourceType,
+                                                                           currentSurfaceDescription->format,
+                                                                           currentSurfaceDescription->width,
+                                                                           currentSurfaceDescription->height,
+                                                                           surfaceDepths[currentSurfaceIndex],
+                                                                           currentSurfaceDescription->mipCount,
+                                                                           FFX_RESOURCE_FLAGS_NONE,
+                                                                           currentSurfaceDescription->usage};
+        const FfxResourceStates               initialState              = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+        const FfxCreateResourceDescription    createResourceDescription = {FFX_HEAP_TYPE_DEFAULT,
+                                                                           resourceDescription,
+                                                                           initialState,
+                                                                           currentSurfaceDescription->name,
+                                                                           currentSurfaceDescription->id,
+                                                                           currentSurfaceDescription->initData};
+
+        FFX_VALIDATE(context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface,
+                                                                                   &createResourceDescription,
+                                                                                   context->effectContextId,
+                                                                                   &textures[currentSurfaceDescription->id]));
+    }
+
+    return FFX_OK;
+}
+
+static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacaoContextDescription* contextDescription)
+{
+    // Check pointers are valid.
+    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
+
+    // Validate that all callbacks are set for the interface
+    FFX_RETURN_ON_ERROR(contextDescription->backendInterface.fpCreateBackendContext, FFX_ERROR_INCOMPLETE_INTERFACE);
+    FFX_RETURN_ON_ERROR(contextDescription->backendInterface.fpDestroyBackendContext, FFX_ERROR_INCOMPLETE_INTERFACE);
+
+    // If a scratch buffer is declared, then we must have a size
+    if (contextDescription->backendInterface.scratchBuffer)
+    {
+        FFX_RETURN_ON_ERROR(contextDescription->backendInterface.scratchBufferSize, FFX_ERROR_INCOMPLETE_INTERFACE);
+    }
+
+    memset(context, 0, sizeof(FfxCacaoContext_Private));
+    context->device = contextDescription->backendInterface.device;
+    memcpy(&context->contextDescription, contextDescription, sizeof(FfxCacaoContextDescription));
+
+    // Check version info - make sure we are linked with the right backend version
+    FfxVersionNumber version = context->contextDescription.backendInterface.fpGetSDKVersion(&context->contextDescription.backendInterface);
+    FFX_RETURN_ON_ERROR(version == FFX_SDK_MAKE_VERSION(1, 1, 1), FFX_ERROR_INVALID_VERSION);
+    
+    context->constantBuffer.num32BitEntries = sizeof(FfxCacaoConstants) / sizeof(uint32_t);
+
+    // Create the device
+    FfxErrorCode errorCode =
+        context->contextDescription.backendInterface.fpCreateBackendContext(&context->contextDescription.backendInterface, FFX_EFFECT_CACAO, nullptr, &context->effectContextId);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+
+#ifdef FFX_CACAO_ENABLE_PROFILING
+    errorStatus = gpuTimerInit(&context->gpuTimer, device);
+    if (errorStatus)
+    {
+        goto error_create_gpu_timer;
+    }
+#endif
+
+    context->useDownsampledSsao   = contextDescription->useDownsampledSsao;
+
+    ffxCacaoUpdateBufferSizeInfo(contextDescription->width, contextDescription->height, context->useDownsampledSsao, &context->bufferSizeInfo);
+
+    // =======================================
+    // Init textures
+
     // clear the textures to NULL.
     memset(context->textures, 0, sizeof(context->textures));
+    memset(context->alternateTextures, 0, sizeof(context->alternateTextures));
 
     // Create load counter
     {
@@ -736,30 +746,14 @@ static FfxErrorCode cacaoCreate(FfxCacaoContext_Private* context, const FfxCacao
                                                                            &context->textures[FFX_CACAO_RESOURCE_IDENTIFIER_LOAD_COUNTER_BUFFER]));
     }
 
-    for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex)
-    {
-        const FfxInternalResourceDescription* currentSurfaceDescription = &internalSurfaceDesc[currentSurfaceIndex];
-        const FfxResourceType                 resourceType = currentSurfaceDescription->height > 1 ? FFX_RESOURCE_TYPE_TEXTURE2D : FFX_RESOURCE_TYPE_TEXTURE1D;
-        const FfxResourceDescription          resourceDescription       = {resourceType,
-                                                                           currentSurfaceDescription->format,
-                                                                           currentSurfaceDescription->width,
-                                                                           currentSurfaceDescription->height,
-                                                                           surfaceDepths[currentSurfaceIndex],
-                                                                           currentSurfaceDescription->mipCount,
-                                                                           FFX_RESOURCE_FLAGS_NONE,
-                                                                           currentSurfaceDescription->usage};
-        const FfxResourceStates               initialState              = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
-        const FfxCreateResourceDescription    createResourceDescription = {FFX_HEAP_TYPE_DEFAULT,
-                                                                           resourceDescription,
-                                                                           initialState,
-                                                                           currentSurfaceDescription->name,
-                                                                           currentSurfaceDescription->id,
-                                                                           currentSurfaceDescription->initData};
+    errorCode = createSsaoResolutionResources(context, context->useDownsampledSsao, context->textures);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
 
-        FFX_VALIDATE(context->contextDescription.backendInterface.fpCreateResource(&context->contextDescription.backendInterface,
-                                                                                   &createResourceDescription,
-                                                                                   context->effectContextId,
-                                                                                   &context->textures[currentSurfaceDescription->id]));
+    // Allocating the other resolution up front lets ffxCacaoUpdateSettings toggle useDownsampledSsao without recreating the context
+    if (contextDescription->allowSsaoResolutionSwitch)
+    {
+        errorCode = createSsaoResolutionResources(context, !context->useDownsampledSsao, context->alternateTextures);
+        FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
     }
 
     errorCode = createPipelineStates(context);
@@ -824,6 +818,14 @@ static FfxErrorCode cacaoRelease(FfxCacaoContext_Private* context)
         ffxSafeReleaseResource(&context->contextDescription.backendInterface, context->textures[i], context->effectContextId);
     }
 
+    if (context->contextDescription.allowSsaoResolutionSwitch)
+    {
+        for (uint32_t i = FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_DEPTHS; i <= FFX_CACAO_RESOURCE_IDENTIFIER_IMPORTANCE_MAP_PONG; ++i)
+        {
+            ffxSafeReleaseResource(&context->contextDescription.backendInterface, context->alternateTextures[i], context->effectContextId);
+        }
+    }
+
     // Destroy the context
     context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, context->effectContextId);
 
@@ -1267,7 +1269,26 @@ FfxErrorCode ffxCacaoUpdateSettings(FfxCacaoContext* context, const FfxCacaoSett
     FFX_RETURN_ON_ERROR(settings, FFX_ERROR_INVALID_POINTER);
     
     FfxCacaoContext_Private* contextPrivate = (FfxCacaoContext_Private*)(context);
-    contextPrivate->useDownsampledSsao      = useDownsampledSsao;
+
+    if (contextPrivate->useDownsampledSsao != useDownsampledSsao)
+    {
+        // The resources for the other resolution must already exist, switching never allocates
+        FFX_RETURN_ON_ERROR(contextPrivate->contextDescription.allowSsaoResolutionSwitch, FFX_ERROR_INVALID_ARGUMENT);
+
+        for (uint32_t i = FFX_CACAO_RESOURCE_IDENTIFIER_DEINTERLEAVED_DEPTHS; i <= FFX_CACAO_RESOURCE_IDENTIFIER_IMPORTANCE_MAP_PONG; ++i)
+        {
+            const FfxResourceInternal texture    = contextPrivate->textures[i];
+            contextPrivate->textures[i]          = contextPrivate->alternateTextures[i];
+            contextPrivate->alternateTextures[i] = texture;
+        }
+
+        contextPrivate->useDownsampledSsao = useDownsampledSsao;
+        ffxCacaoUpdateBufferSizeInfo(contextPrivate->contextDescription.width,
+                                     contextPrivate->contextDescription.height,
+                                     useDownsampledSsao,
+                                     &contextPrivate->bufferSizeInfo);
+    }
+
     memcpy(&contextPrivate->settings, settings, sizeof(*settings));
 
     return FFX_OK;
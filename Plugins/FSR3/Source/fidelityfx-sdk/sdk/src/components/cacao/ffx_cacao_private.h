@@ -77,4 +77,7 @@ struct FfxCacaoContext_Private
     FfxPipelineState pipelineUpscaleBilateral5x5NonSmart;
 
     FfxResourceInternal textures[FFX_CACAO_RESOURCE_IDENTIFIER_COUNT];
+
+    // Internal resources sized for the SSAO resolution not in use, only created with allowSsaoResolutionSwitch
+    FfxResourceInternal alternateTextures[FFX_CACAO_RESOURCE_IDENTIFIER_COUNT];
 };
@@ -33,6 +33,7 @@
 #include <FidelityFX/gpu/ffx_core.h>
 #include <FidelityFX/gpu/cas/ffx_cas.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_cas_private.h"
 
@@ -57,47 +58,19 @@ static const ResourceBinding s_CbResourceBindingTable[] = {
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_SrvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_SrvResourceBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_SrvResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = s_SrvResourceBindingTable[mapIndex].index;
-    }
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup s_SrvResourceBindingLookup(s_SrvResourceBindingTable);
+    static const FfxBindingLookup s_UavResourceBindingLookup(s_UavResourceBindingTable);
+    static const FfxBindingLookup s_CbResourceBindingLookup(s_CbResourceBindingTable);
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_UavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_UavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_UavResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = s_UavResourceBindingTable[mapIndex].index;
-    }
+    if (!s_SrvResourceBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(s_CbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(s_CbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(s_CbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = s_CbResourceBindingTable[mapIndex].index;
-    }
+    if (!s_UavResourceBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
+
+    if (!s_CbResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -29,6 +29,7 @@
 #include <FidelityFX/host/ffx_util.h>
 #include <FidelityFX/gpu/ffx_core.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_classifier_private.h"
 
@@ -85,75 +86,27 @@ static const ResourceBinding cbResourceBindingTable[] =
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup srvBufferBindingLookup(srvBufferBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup uavBufferBindingLookup(uavBufferBindingTable);
+    static const FfxBindingLookup cbResourceBindingLookup(cbResourceBindingTable);
 
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvBufferCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBufferBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvBufferBindings[srvIndex].resourceIdentifier = srvBufferBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    if (!srvBufferBindingLookup.resolve(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavBufferCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBufferBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavIndex].resourceIdentifier = uavBufferBindingTable[mapIndex].index;
-    }
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    if (!uavBufferBindingLookup.resolve(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
+
+    if (!cbResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -714,6 +667,21 @@ FfxErrorCode ffxClassifierContextShadowDispatch(FfxClassifierContext* context, c
     return shadowClassifierDispatch(contextPrivate, dispatchDescription);
 }
 
+FFX_API FfxErrorCode ffxClassifierContextGetGpuMemoryUsage(FfxClassifierContext* context, FfxEffectMemoryUsage* vramUsage)
+{
+    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(vramUsage, FFX_ERROR_INVALID_POINTER);
+    FfxClassifierContext_Private* contextPrivate = reinterpret_cast<FfxClassifierContext_Private*>(context);
+
+    FFX_RETURN_ON_ERROR(contextPrivate->device, FFX_ERROR_NULL_DEVICE);
+
+    FfxErrorCode errorCode = contextPrivate->contextDescription.backendInterface.fpGetEffectGpuMemoryUsage(
+        &contextPrivate->contextDescription.backendInterface, contextPrivate->effectContextId, vramUsage);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+
+    return FFX_OK;
+}
+
 FFX_API FfxVersionNumber ffxClassifierGetEffectVersion()
 {
     return FFX_SDK_MAKE_VERSION(FFX_CLASSIFIER_VERSION_MAJOR, FFX_CLASSIFIER_VERSION_MINOR, FFX_CLASSIFIER_VERSION_PATCH);
@@ -21,12 +21,13 @@
 // THE SOFTWARE.
 
 #include <string.h>     // for memset
-#include <stdlib.h>     // for _countof
+#include <stdlib.h>     // for _countof, calloc
 #include <cmath>        // for fabs, abs, sinf, sqrt, etc.
 
 #include <FidelityFX/host/ffx_denoiser.h>
 #include <FidelityFX/gpu/denoiser/ffx_denoiser_resources.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_denoiser_private.h"
 
@@ -143,81 +144,33 @@ typedef struct DenoiserShadowsFilterConstants {
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup srvBufferBindingLookup(srvBufferBindingTable);
+    static const FfxBindingLookup uavBufferBindingLookup(uavBufferBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup cbResourceBindingLookup(cbResourceBindingTable);
+
     // Texture srvs
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     // Buffer srvs
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvBufferCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBufferBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvBufferBindings[srvIndex].resourceIdentifier = srvBufferBindingTable[mapIndex].index;
-    }
+    if (!srvBufferBindingLookup.resolve(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     // Buffer uavs
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavBufferCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBufferBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavIndex].resourceIdentifier = uavBufferBindingTable[mapIndex].index;
-    }
+    if (!uavBufferBindingLookup.resolve(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
 
     // Texture uavs
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     // Constant buffers
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
+    if (!cbResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -426,6 +379,25 @@ static void scheduleIndirectReflectionsDispatch(FfxDenoiserContext_Private* cont
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
+// Zero initialize the given UAV resources with a single batch of clear jobs. Only used on the first
+// frame and on resets; the jobs come from the heap as each one is sized for a compute dispatch.
+static FfxErrorCode scheduleClearJobs(FfxDenoiserContext_Private* context, const wchar_t* label, const uint32_t* resourceIDs, uint32_t resourceCount)
+{
+    FfxGpuJobDescription* jobs = (FfxGpuJobDescription*)calloc(resourceCount, sizeof(FfxGpuJobDescription));
+    FFX_RETURN_ON_ERROR(jobs, FFX_ERROR_OUT_OF_MEMORY);
+
+    for (uint32_t jobIndex = 0; jobIndex < resourceCount; ++jobIndex) {
+        jobs[jobIndex].jobType = FFX_GPU_JOB_CLEAR_FLOAT;
+        wcscpy_s(jobs[jobIndex].jobLabel, label);
+        jobs[jobIndex].clearJobDescriptor.target = context->uavResources[resourceIDs[jobIndex]];
+    }
+
+    const FfxErrorCode errorCode = ffxScheduleGpuJobs(&context->contextDescription.backendInterface, jobs, resourceCount);
+    free(jobs);
+
+    return errorCode;
+}
+
 static void scheduleDispatch(FfxDenoiserContext_Private* context, const FfxDenoiserShadowsDispatchDescription* params, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
     FfxComputeJobDescription jobDescriptor = {};
@@ -518,26 +490,15 @@ static FfxErrorCode denoiserDispatchShadows(FfxDenoiserContext_Private* context,
 
     if (context->isFirstShadowFrame)
     {
-        FfxGpuJobDescription job        = {};
-        job.jobType                     = FFX_GPU_JOB_CLEAR_FLOAT;
-        wcscpy_s(job.jobLabel, L"Clear shadow map");
-        job.clearJobDescriptor.color[0] = 0.0f;
-        job.clearJobDescriptor.color[1] = 0.0f;
-        job.clearJobDescriptor.color[2] = 0.0f;
-        job.clearJobDescriptor.color[3] = 0.0f;
-
-        uint32_t resourceIDs[] = {
+        const uint32_t resourceIDs[] = {
             FFX_DENOISER_RESOURCE_IDENTIFIER_MOMENTS0,
             FFX_DENOISER_RESOURCE_IDENTIFIER_MOMENTS1,
             FFX_DENOISER_RESOURCE_IDENTIFIER_SCRATCH0,
             FFX_DENOISER_RESOURCE_IDENTIFIER_SCRATCH1,
         };
 
-        for (const uint32_t* resourceID = resourceIDs; resourceID < resourceIDs + FFX_ARRAY_ELEMENTS(resourceIDs); ++resourceID)
-        {
-            job.clearJobDescriptor.target = context->uavResources[*resourceID];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &job);
-        }
+        const FfxErrorCode errorCode = scheduleClearJobs(context, L"Clear shadow map", resourceIDs, FFX_ARRAY_ELEMENTS(resourceIDs));
+        FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
     }
 
     // Get DenoiserShadows info for run
@@ -654,15 +615,7 @@ static FfxErrorCode denoiserDispatchReflections(FfxDenoiserContext_Private* cont
 
     // zero initialise resources on first frame
     if (context->isFirstReflectionsFrame) {
-        FfxGpuJobDescription job = {};
-        job.jobType = FFX_GPU_JOB_CLEAR_FLOAT;
-        wcscpy_s(job.jobLabel, L"Zero initialize resource");
-        job.clearJobDescriptor.color[0] = 0.0f;
-        job.clearJobDescriptor.color[1] = 0.0f;
-        job.clearJobDescriptor.color[2] = 0.0f;
-        job.clearJobDescriptor.color[3] = 0.0f;
-
-        uint32_t resourceIDs[] = {
+        const uint32_t resourceIDs[] = {
             FFX_DENOISER_RESOURCE_IDENTIFIER_SAMPLE_COUNT_0,
             FFX_DENOISER_RESOURCE_IDENTIFIER_SAMPLE_COUNT_1,
             FFX_DENOISER_RESOURCE_IDENTIFIER_AVERAGE_RADIANCE_0,
@@ -670,10 +623,8 @@ static FfxErrorCode denoiserDispatchReflections(FfxDenoiserContext_Private* cont
             FFX_DENOISER_RESOURCE_IDENTIFIER_REPROJECTED_RADIANCE,
         };
 
-        for (const uint32_t *resourceID = resourceIDs; resourceID < resourceIDs + FFX_ARRAY_ELEMENTS(resourceIDs); ++resourceID) {
-            job.clearJobDescriptor.target = context->uavResources[*resourceID];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &job);
-        }
+        const FfxErrorCode errorCode = scheduleClearJobs(context, L"Zero initialize resource", resourceIDs, FFX_ARRAY_ELEMENTS(resourceIDs));
+        FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
 
         context->isFirstReflectionsFrame = false;
     }
@@ -690,6 +641,12 @@ static FfxErrorCode denoiserDispatchReflections(FfxDenoiserContext_Private* cont
     context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->indirectArgumentsBuffer,    context->effectContextId, &context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_INDIRECT_ARGS]);
     context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->output,                     context->effectContextId, &context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_OUTPUT]);
 
+    const bool sharedRoughnessHistory = (context->contextDescription.flags & FFX_DENOISER_REFLECTIONS_SHARED_ROUGHNESS_HISTORY) != 0;
+    if (sharedRoughnessHistory)
+    {
+        context->contextDescription.backendInterface.fpRegisterResource(&context->contextDescription.backendInterface, &params->extractedRoughnessHistory, context->effectContextId, &context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_ROUGHNESS_HISTORY]);
+    }
+
     // Don't need to register it twice
     context->uavResources[FFX_DENOISER_RESOURCE_IDENTIFIER_RADIANCE_0]          = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_RADIANCE_0];
     context->uavResources[FFX_DENOISER_RESOURCE_IDENTIFIER_RADIANCE_1]          = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_RADIANCE_1];
@@ -712,24 +669,13 @@ static FfxErrorCode denoiserDispatchReflections(FfxDenoiserContext_Private* cont
 
     if (params->reset)
     {
-        FfxGpuJobDescription job = {};
-        job.jobType = FFX_GPU_JOB_CLEAR_FLOAT;
-        wcscpy_s(job.jobLabel, L"Zero initialize resource");
-        job.clearJobDescriptor.color[0] = 0.0f;
-        job.clearJobDescriptor.color[1] = 0.0f;
-        job.clearJobDescriptor.color[2] = 0.0f;
-        job.clearJobDescriptor.color[3] = 0.0f;
-
-        uint32_t resourceIDs[] = {
+        const uint32_t resourceIDs[] = {
             FFX_DENOISER_RESOURCE_IDENTIFIER_AVERAGE_RADIANCE_0,
             FFX_DENOISER_RESOURCE_IDENTIFIER_AVERAGE_RADIANCE_1,
         };
 
-        for (const uint32_t* resourceID = resourceIDs; resourceID < resourceIDs + FFX_ARRAY_ELEMENTS(resourceIDs); ++resourceID)
-        {
-            job.clearJobDescriptor.target = context->uavResources[*resourceID];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &job);
-        }
+        const FfxErrorCode errorCode = scheduleClearJobs(context, L"Zero initialize resource", resourceIDs, FFX_ARRAY_ELEMENTS(resourceIDs));
+        FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
     }
 
     DenoiserReflectionsConstants reflectionsConstants{};
@@ -786,13 +732,16 @@ static FfxErrorCode denoiserDispatchReflections(FfxDenoiserContext_Private* cont
     dispatchCopyJobDescriptor.copyJobDescriptor.size      = 0;
     context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchCopyJobDescriptor);
 
-    // Roughness history
-    dispatchCopyJobDescriptor.copyJobDescriptor.src = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_EXTRACTED_ROUGHNESS];
-    dispatchCopyJobDescriptor.copyJobDescriptor.dst = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_ROUGHNESS_HISTORY];
-    dispatchCopyJobDescriptor.copyJobDescriptor.srcOffset = 0;
-    dispatchCopyJobDescriptor.copyJobDescriptor.dstOffset = 0;
-    dispatchCopyJobDescriptor.copyJobDescriptor.size      = 0;
-    context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchCopyJobDescriptor);
+    // Roughness history, the caller keeps last frame's classifier output alive instead when it is shared
+    if (!sharedRoughnessHistory)
+    {
+        dispatchCopyJobDescriptor.copyJobDescriptor.src = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_EXTRACTED_ROUGHNESS];
+        dispatchCopyJobDescriptor.copyJobDescriptor.dst = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_ROUGHNESS_HISTORY];
+        dispatchCopyJobDescriptor.copyJobDescriptor.srcOffset = 0;
+        dispatchCopyJobDescriptor.copyJobDescriptor.dstOffset = 0;
+        dispatchCopyJobDescriptor.copyJobDescriptor.size      = 0;
+        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchCopyJobDescriptor);
+    }
 
     // Depth history
     dispatchCopyJobDescriptor.copyJobDescriptor.src = context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_INPUT_DEPTH_HIERARCHY];
@@ -881,7 +830,7 @@ static FfxErrorCode denoiserShadowsCreateResources(FfxDenoiserContext_Private* c
                                                                    sizeof(uint32_t) * tileCount,
                                                                    sizeof(uint32_t),
                                                                    1,
-                                                                   FFX_RESOURCE_FLAGS_NONE,
+                                                                   (FfxResourceFlags)(FFX_RESOURCE_FLAGS_ALIASABLE | FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT),
                                                                    {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}},
 
                                                                   {FFX_DENOISER_RESOURCE_IDENTIFIER_TILE_META_DATA,
@@ -892,7 +841,7 @@ static FfxErrorCode denoiserShadowsCreateResources(FfxDenoiserContext_Private* c
                                                                    sizeof(uint32_t) * tileCount,
                                                                    sizeof(uint32_t),
                                                                    1,
-                                                                   FFX_RESOURCE_FLAGS_NONE,
+                                                                   (FfxResourceFlags)(FFX_RESOURCE_FLAGS_ALIASABLE | FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT),
                                                                    {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED}}};
 
     for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex) {
@@ -1011,6 +960,11 @@ static FfxErrorCode denoiserReflectionsCreateResources(FfxDenoiserContext_Privat
     for (int32_t currentSurfaceIndex = 0; currentSurfaceIndex < FFX_ARRAY_ELEMENTS(internalSurfaceDesc); ++currentSurfaceIndex) {
 
         const FfxInternalResourceDescription* currentSurfaceDescription = &internalSurfaceDesc[currentSurfaceIndex];
+
+        // The roughness history is the classifier's previous output, registered per dispatch
+        if (currentSurfaceDescription->id == FFX_DENOISER_RESOURCE_IDENTIFIER_ROUGHNESS_HISTORY && (contextDescription->flags & FFX_DENOISER_REFLECTIONS_SHARED_ROUGHNESS_HISTORY))
+            continue;
+
         const FfxResourceDescription resourceDescription = { currentSurfaceDescription->type, currentSurfaceDescription->format, currentSurfaceDescription->width, currentSurfaceDescription->height, currentSurfaceDescription->type == FFX_RESOURCE_TYPE_BUFFER ? 0u : 1u, currentSurfaceDescription->mipCount, FFX_RESOURCE_FLAGS_NONE, currentSurfaceDescription->usage };
         const FfxResourceStates initialState = (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_READ_ONLY) ? FFX_RESOURCE_STATE_COMPUTE_READ : FFX_RESOURCE_STATE_UNORDERED_ACCESS;
         const FfxCreateResourceDescription createResourceDescription = { FFX_HEAP_TYPE_DEFAULT, resourceDescription, initialState, currentSurfaceDescription->name, currentSurfaceDescription->id, currentSurfaceDescription->initData };
@@ -1121,6 +1075,9 @@ static FfxErrorCode denoiserRelease(FfxDenoiserContext_Private* context)
         context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_EXTRACTED_ROUGHNESS]     = { FFX_DENOISER_RESOURCE_IDENTIFIER_NULL };
         context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_INDIRECT_ARGS]           = { FFX_DENOISER_RESOURCE_IDENTIFIER_NULL };
         context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_OUTPUT]                  = { FFX_DENOISER_RESOURCE_IDENTIFIER_NULL };
+
+        if (context->contextDescription.flags & FFX_DENOISER_REFLECTIONS_SHARED_ROUGHNESS_HISTORY)
+            context->srvResources[FFX_DENOISER_RESOURCE_IDENTIFIER_ROUGHNESS_HISTORY]   = { FFX_DENOISER_RESOURCE_IDENTIFIER_NULL };
     }
 
     // release internal resources
@@ -1210,6 +1167,21 @@ FfxErrorCode ffxDenoiserContextDispatchReflections(FfxDenoiserContext* context,
     return denoiserDispatchReflections(contextPrivate, dispatchDescription);;
 }
 
+FFX_API FfxErrorCode ffxDenoiserContextGetGpuMemoryUsage(FfxDenoiserContext* context, FfxEffectMemoryUsage* vramUsage)
+{
+    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(vramUsage, FFX_ERROR_INVALID_POINTER);
+    FfxDenoiserContext_Private* contextPrivate = (FfxDenoiserContext_Private*)(context);
+
+    FFX_RETURN_ON_ERROR(contextPrivate->device, FFX_ERROR_NULL_DEVICE);
+
+    FfxErrorCode errorCode = contextPrivate->contextDescription.backendInterface.fpGetEffectGpuMemoryUsage(
+        &contextPrivate->contextDescription.backendInterface, contextPrivate->effectContextId, vramUsage);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+
+    return FFX_OK;
+}
+
 FFX_API FfxVersionNumber ffxDenoiserGetEffectVersion()
 {
     return FFX_SDK_MAKE_VERSION(FFX_DENOISER_VERSION_MAJOR, FFX_DENOISER_VERSION_MINOR, FFX_DENOISER_VERSION_PATCH);
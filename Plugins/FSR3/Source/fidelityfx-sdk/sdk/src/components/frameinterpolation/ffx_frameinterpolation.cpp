@@ -36,81 +36,11 @@
 #include <FidelityFX/gpu/ffx_core.h>
 #include <FidelityFX/gpu/spd/ffx_spd.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_frameinterpolation_private.h"
 
-// lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}ResourceBinding;
-
-static const ResourceBinding srvResourceBindingTable[] =
-{
-    // Frame Interpolation textures
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DEPTH,                                      L"r_input_depth"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_MOTION_VECTORS,                             L"r_input_motion_vectors"},
-
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DILATED_DEPTH,                              L"r_dilated_depth"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                     L"r_dilated_motion_vectors"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_PREVIOUS_FRAME,         L"r_reconstructed_depth_previous_frame"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME,     L"r_reconstructed_depth_interpolated_frame"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_PREVIOUS_INTERPOLATION_SOURCE,              L"r_previous_interpolation_source"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_CURRENT_INTERPOLATION_SOURCE,               L"r_current_interpolation_source"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK,                          L"r_disocclusion_mask"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X,                 L"r_game_motion_vector_field_x"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y,                 L"r_game_motion_vector_field_y"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X,         L"r_optical_flow_motion_vector_field_x"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y,         L"r_optical_flow_motion_vector_field_y"},
-
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_VECTOR,                        L"r_optical_flow"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_CONFIDENCE,                    L"r_optical_flow_confidence"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_GLOBAL_MOTION,                 L"r_optical_flow_global_motion"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_SCENE_CHANGE_DETECTION,        L"r_optical_flow_scd"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OUTPUT,                                     L"r_output"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_MASK,                            L"r_inpainting_mask"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID,                         L"r_inpainting_pyramid"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_PRESENT_BACKBUFFER,                         L"r_present_backbuffer"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNTERS,                                   L"r_counters"},
-};
-
-static const ResourceBinding uavResourceBindingTable[] =
-{
-    // Frame Interpolation textures
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DILATED_DEPTH,                              L"rw_dilated_depth"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                     L"rw_dilated_motion_vectors"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_PREVIOUS_FRAME,         L"rw_reconstructed_depth_previous_frame"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME,     L"rw_reconstructed_depth_interpolated_frame"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OUTPUT,                                     L"rw_output"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_DISOCCLUSION_MASK,                          L"rw_disocclusion_mask"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X,                 L"rw_game_motion_vector_field_x"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_Y,                 L"rw_game_motion_vector_field_y"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_X,         L"rw_optical_flow_motion_vector_field_x"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_OPTICAL_FLOW_MOTION_VECTOR_FIELD_Y,         L"rw_optical_flow_motion_vector_field_y"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_MASK,                            L"rw_inpainting_mask"},
-
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNTERS,                                   L"rw_counters"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_0,                L"rw_inpainting_pyramid0"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_1,                L"rw_inpainting_pyramid1"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_2,                L"rw_inpainting_pyramid2"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_3,                L"rw_inpainting_pyramid3"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_4,                L"rw_inpainting_pyramid4"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_5,                L"rw_inpainting_pyramid5"}, // extra declaration, as this is globallycoherent
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_6,                L"rw_inpainting_pyramid6"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_7,                L"rw_inpainting_pyramid7"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_8,                L"rw_inpainting_pyramid8"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_9,                L"rw_inpainting_pyramid9"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_10,               L"rw_inpainting_pyramid10"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_11,               L"rw_inpainting_pyramid11"},
-    {FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_INPAINTING_PYRAMID_MIPMAP_12,               L"rw_inpainting_pyramid12"},
-};
-
-static const ResourceBinding cbResourceBindingTable[] =
-{
-    {FFX_FRAMEINTERPOLATION_CONSTANTBUFFER_IDENTIFIER,                                      L"cbFI"},
-    {FFX_FRAMEINTERPOLATION_INPAINTING_PYRAMID_CONSTANTBUFFER_IDENTIFIER,                   L"cbInpaintingPyramid"},
-};
+#include "ffx_frameinterpolation_bindings.h"
 
 // Broad structure of the root signature.
 typedef enum FrameInterpolationRootSignatureLayout {
@@ -127,99 +57,34 @@ typedef union FrameInterpolationSecondaryUnion
     InpaintingPyramidConstants inpaintingPyramidConstants;
 } FrameInterpolationSecondaryUnion;
 
-// Lanczos
-static float lanczos2(float value)
-{
-    return abs(value) < FFX_EPSILON ? 1.f : (sinf(FFX_PI * value) / (FFX_PI * value)) * (sinf(0.5f * FFX_PI * value) / (0.5f * FFX_PI * value));
-}
-
-// Calculate halton number for index and base.
-static float halton(int32_t index, int32_t base)
-{
-    float f = 1.0f, result = 0.0f;
-
-    for (int32_t currentIndex = index; currentIndex > 0;) {
+// jobs recorded by ffxFrameInterpolationPrepare: one clear and one dispatch
+static const uint32_t FRAMEINTERPOLATION_MAX_PREPARE_GPU_JOBS = 2;
 
-        f /= (float)base;
-        result = result + f * (float)(currentIndex % base);
-        currentIndex = (uint32_t)(floorf((float)(currentIndex) / (float)(base)));
-    }
-
-    return result;
-}
+// discards, clears, dispatches, copies and barriers of the largest ffxFrameInterpolationDispatch (with the debug view)
+static const uint32_t FRAMEINTERPOLATION_MAX_GPU_JOBS = 32;
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvResourceBindingLookup(srvResourceBindingTable);
+    static const FfxBindingLookup uavResourceBindingLookup(uavResourceBindingTable);
+    static const FfxBindingLookup cbResourceBindingLookup(cbResourceBindingTable);
 
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvResourceBindingTable[mapIndex].index;
-    }
+    if (!srvResourceBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     // check for UAVs where mip chains are to be bound
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavResourceBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavResourceBindingTable[mapIndex].index;
-    }
+    if (!cbResourceBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(cbResourceBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(cbResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavResourceBindingLookup.resolve(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavBufferIndex = 0; uavBufferIndex < inoutPipeline->uavBufferCount; ++uavBufferIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavResourceBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavBufferIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavBufferIndex].resourceIdentifier = uavResourceBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t srvBufferIndex = 0; srvBufferIndex < inoutPipeline->srvBufferCount; ++srvBufferIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvResourceBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvResourceBindingTable[mapIndex].name, inoutPipeline->srvBufferBindings[srvBufferIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvResourceBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvBufferBindings[srvBufferIndex].resourceIdentifier = srvResourceBindingTable[mapIndex].index;
-    }
+    if (!srvResourceBindingLookup.resolve(inoutPipeline->srvBufferBindings, inoutPipeline->srvBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
 
     return FFX_OK;
@@ -356,6 +221,11 @@ static FfxErrorCode frameinterpolationCreate(FfxFrameInterpolationContext_Privat
     errorCode = context->contextDescription.backendInterface.fpGetDeviceCapabilities(&context->contextDescription.backendInterface, &context->deviceCapabilities);
     FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
 
+    errorCode = ffxGpuJobBatchCreate(&context->prepareJobBatch, FRAMEINTERPOLATION_MAX_PREPARE_GPU_JOBS);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+    errorCode = ffxGpuJobBatchCreate(&context->jobBatch, FRAMEINTERPOLATION_MAX_GPU_JOBS);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+
     // set defaults
     context->firstExecution = true;
 
@@ -371,17 +241,6 @@ static FfxErrorCode frameinterpolationCreate(FfxFrameInterpolationContext_Privat
     context->constants.interpolationRectSize[0] = contextDescription->displaySize.width;
     context->constants.interpolationRectSize[1] = contextDescription->displaySize.height;
 
-    // generate the data for the LUT.
-    const uint32_t lanczos2LutWidth = 128;
-    int16_t lanczos2Weights[lanczos2LutWidth] = { };
-
-    for (uint32_t currentLanczosWidthIndex = 0; currentLanczosWidthIndex < lanczos2LutWidth; currentLanczosWidthIndex++) {
-
-        const float x = 2.0f * currentLanczosWidthIndex / float(lanczos2LutWidth - 1);
-        const float y = lanczos2(x);
-        lanczos2Weights[currentLanczosWidthIndex] = int16_t(roundf(y * 32767.0f));
-    }
-
     uint32_t atomicInitData[2] = { 0, 0 };
     float defaultExposure[] = { 0.0f, 0.0f };
     const FfxResourceType texture1dResourceType = (context->contextDescription.flags & FFX_FRAMEINTERPOLATION_ENABLE_TEXTURE1D_USAGE) ? FFX_RESOURCE_TYPE_TEXTURE1D : FFX_RESOURCE_TYPE_TEXTURE2D;
@@ -488,15 +347,26 @@ static FfxErrorCode frameinterpolationRelease(FfxFrameInterpolationContext_Priva
         ffxSafeReleaseResource(&context->contextDescription.backendInterface, context->srvResources[currentResourceIndex], context->effectContextId);
     }
 
+    ffxGpuJobBatchDestroy(&context->prepareJobBatch);
+    ffxGpuJobBatchDestroy(&context->jobBatch);
+
     // Destroy the context
     context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, context->effectContextId);
 
     return FFX_OK;
 }
 
-static void scheduleDispatch(FfxFrameInterpolationContext_Private* context, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
+static FfxGpuJobDescription* addGpuJob(FfxFrameInterpolationContext_Private* context, FfxGpuJobBatch* batch, FfxGpuJobType jobType)
+{
+    return ffxGpuJobBatchAdd(&context->contextDescription.backendInterface, batch, jobType);
+}
+
+static void scheduleDispatch(FfxFrameInterpolationContext_Private* context, FfxGpuJobBatch* batch, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
-    FfxComputeJobDescription jobDescriptor = {};
+    FfxGpuJobDescription* dispatchJob = addGpuJob(context, batch, FFX_GPU_JOB_COMPUTE);
+    wcscpy_s(dispatchJob->jobLabel, pipeline->name);
+
+    FfxComputeJobDescription& jobDescriptor = dispatchJob->computeJobDescriptor;
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex)
     {
@@ -558,12 +428,6 @@ static void scheduleDispatch(FfxFrameInterpolationContext_Private* context, cons
         wcscpy_s(jobDescriptor.srvBuffers[currentShaderResourceViewIndex].name, pipeline->srvBufferBindings[currentShaderResourceViewIndex].name);
 #endif
     }
-
-    FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
-    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
-    dispatchJob.computeJobDescriptor = jobDescriptor;
-
-    context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
 FFX_API FfxErrorCode ffxFrameInterpolationGetSharedResourceDescriptions(FfxFrameInterpolationContext* context, FfxFrameInterpolationSharedResourceDescriptions* SharedResources)
@@ -784,19 +648,20 @@ FFX_API FfxErrorCode ffxFrameInterpolationPrepare(FfxFrameInterpolationContext*
 
     // clear estimated depth resources
     {
-        FfxGpuJobDescription clearJob = {FFX_GPU_JOB_CLEAR_FLOAT};
+        FfxGpuJobDescription* clearJob = addGpuJob(contextPrivate, &contextPrivate->prepareJobBatch, FFX_GPU_JOB_CLEAR_FLOAT);
         const bool bInverted = (contextPrivate->contextDescription.flags & FFX_FRAMEINTERPOLATION_ENABLE_DEPTH_INVERTED) == FFX_FRAMEINTERPOLATION_ENABLE_DEPTH_INVERTED;
         const float clearDepthValue[]{bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f};
-        memcpy(clearJob.clearJobDescriptor.color, clearDepthValue, 4 * sizeof(float));
-        wcscpy_s(clearJob.jobLabel, L"Clear Reconstructed Previous Nearest Depth");
-        clearJob.clearJobDescriptor.target = contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_PREVIOUS_FRAME];
-        contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &clearJob);
+        memcpy(clearJob->clearJobDescriptor.color, clearDepthValue, 4 * sizeof(float));
+        wcscpy_s(clearJob->jobLabel, L"Clear Reconstructed Previous Nearest Depth");
+        clearJob->clearJobDescriptor.target = contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_PREVIOUS_FRAME];
     }
 
     uint32_t                              renderDispatchSizeX = uint32_t(params->renderSize.width + 7) / 8;
     uint32_t                              renderDispatchSizeY = uint32_t(params->renderSize.height + 7) / 8;
 
-    scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiReconstructAndDilate, renderDispatchSizeX, renderDispatchSizeY);
+    scheduleDispatch(contextPrivate, &contextPrivate->prepareJobBatch, &contextPrivate->pipelineFiReconstructAndDilate, renderDispatchSizeX, renderDispatchSizeY);
+
+    ffxGpuJobBatchSchedule(&contextPrivate->contextDescription.backendInterface, &contextPrivate->prepareJobBatch);
 
     contextPrivate->contextDescription.backendInterface.fpExecuteGpuJobs(&contextPrivate->contextDescription.backendInterface, params->commandList, contextPrivate->effectContextId);
 
@@ -956,8 +821,10 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
 
     const bool bExecutePreparationPasses = (false == contextPrivate->constants.Reset);
 
-    // Schedule work for the interpolation command list
+    // Schedule work for the interpolation command list, recorded into one batch handed to the backend before it executes
     {
+        FfxGpuJobBatch* jobBatch = &contextPrivate->jobBatch;
+
         FfxResourceInternal aliasableResources[] = {
             contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME],
             contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_GAME_MOTION_VECTOR_FIELD_X],
@@ -970,12 +837,11 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
         };
         for (int i = 0; i < _countof(aliasableResources); ++i)
         {
-            FfxGpuJobDescription discardJob        = {FFX_GPU_JOB_DISCARD};
-            discardJob.discardJobDescriptor.target = aliasableResources[i];
-            contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &discardJob);
+            FfxGpuJobDescription* discardJob        = addGpuJob(contextPrivate, jobBatch, FFX_GPU_JOB_DISCARD);
+            discardJob->discardJobDescriptor.target = aliasableResources[i];
         }
 
-        scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiSetup, renderDispatchSizeX, renderDispatchSizeY);
+        scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiSetup, renderDispatchSizeX, renderDispatchSizeY);
 
             // game vector field inpainting pyramid
         auto scheduleDispatchGameVectorFieldInpaintingPyramid = [&]() {
@@ -999,7 +865,7 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
                 &contextPrivate->constantBuffers[FFX_FRAMEINTERPOLATION_INPAINTING_PYRAMID_CONSTANTBUFFER_IDENTIFIER]);
 
             scheduleDispatch(
-                contextPrivate, &contextPrivate->pipelineGameVectorFieldInpaintingPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+                contextPrivate, jobBatch, &contextPrivate->pipelineGameVectorFieldInpaintingPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
         };
 
         // only execute FG data preparation passes when reset wasnt triggered
@@ -1007,30 +873,29 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
         {
             // clear estimated depth resources
             {
-                FfxGpuJobDescription clearJob = {FFX_GPU_JOB_CLEAR_FLOAT};
+                FfxGpuJobDescription* clearJob = addGpuJob(contextPrivate, jobBatch, FFX_GPU_JOB_CLEAR_FLOAT);
 
                 const bool bInverted =
                     (contextPrivate->contextDescription.flags & FFX_FRAMEINTERPOLATION_ENABLE_DEPTH_INVERTED) == FFX_FRAMEINTERPOLATION_ENABLE_DEPTH_INVERTED;
                 const float clearDepthValue[]{bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f};
-                memcpy(clearJob.clearJobDescriptor.color, clearDepthValue, 4 * sizeof(float));
+                memcpy(clearJob->clearJobDescriptor.color, clearDepthValue, 4 * sizeof(float));
 
-                wcscpy_s(clearJob.jobLabel, L"Clear Reconstructed Depth Interpolated Frame");
-                clearJob.clearJobDescriptor.target =
+                wcscpy_s(clearJob->jobLabel, L"Clear Reconstructed Depth Interpolated Frame");
+                clearJob->clearJobDescriptor.target =
                     contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_RECONSTRUCTED_DEPTH_INTERPOLATED_FRAME];
-                contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &clearJob);
             }
 
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiReconstructPreviousDepth, renderDispatchSizeX, renderDispatchSizeY);
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiGameMotionVectorField, renderDispatchSizeX, renderDispatchSizeY);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiReconstructPreviousDepth, renderDispatchSizeX, renderDispatchSizeY);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiGameMotionVectorField, renderDispatchSizeX, renderDispatchSizeY);
 
             scheduleDispatchGameVectorFieldInpaintingPyramid();
 
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiOpticalFlowVectorField, opticalFlowDispatchSizeX, opticalFlowDispatchSizeY);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiOpticalFlowVectorField, opticalFlowDispatchSizeX, opticalFlowDispatchSizeY);
 
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiDisocclusionMask, renderDispatchSizeX, renderDispatchSizeY);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiDisocclusionMask, renderDispatchSizeX, renderDispatchSizeY);
         }
 
-        scheduleDispatch(contextPrivate, &contextPrivate->pipelineFiScfi, displayDispatchSizeX, displayDispatchSizeY);
+        scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineFiScfi, displayDispatchSizeX, displayDispatchSizeY);
 
         // inpainting pyramid
         {
@@ -1053,28 +918,27 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
                 sizeof(contextPrivate->inpaintingPyramidContants),
                 &contextPrivate->constantBuffers[FFX_FRAMEINTERPOLATION_INPAINTING_PYRAMID_CONSTANTBUFFER_IDENTIFIER]);
 
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineInpaintingPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineInpaintingPyramid, dispatchThreadGroupCountXY[0], dispatchThreadGroupCountXY[1]);
         }
 
-        scheduleDispatch(contextPrivate, &contextPrivate->pipelineInpainting, displayDispatchSizeX, displayDispatchSizeY);
+        scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineInpainting, displayDispatchSizeX, displayDispatchSizeY);
 
         if (params->flags & FFX_FRAMEINTERPOLATION_DISPATCH_DRAW_DEBUG_VIEW)
         {
             scheduleDispatchGameVectorFieldInpaintingPyramid();
-            scheduleDispatch(contextPrivate, &contextPrivate->pipelineDebugView, displayDispatchSizeX, displayDispatchSizeY);
+            scheduleDispatch(contextPrivate, jobBatch, &contextPrivate->pipelineDebugView, displayDispatchSizeX, displayDispatchSizeY);
         }
 
         // store current buffer
         {
-            FfxGpuJobDescription copyJobs[] = { {FFX_GPU_JOB_COPY} };
-            FfxResourceInternal  copySources[_countof(copyJobs)] = { contextPrivate->srvResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_CURRENT_INTERPOLATION_SOURCE] };
-            FfxResourceInternal destSources[_countof(copyJobs)] = { contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_PREVIOUS_INTERPOLATION_SOURCE] };
+            FfxResourceInternal copySources[] = { contextPrivate->srvResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_CURRENT_INTERPOLATION_SOURCE] };
+            FfxResourceInternal destSources[_countof(copySources)] = { contextPrivate->uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_PREVIOUS_INTERPOLATION_SOURCE] };
 
-            for (int i = 0; i < _countof(copyJobs); ++i)
+            for (int i = 0; i < _countof(copySources); ++i)
             {
-                copyJobs[i].copyJobDescriptor.src = copySources[i];
-                copyJobs[i].copyJobDescriptor.dst = destSources[i];
-                contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &copyJobs[i]);
+                FfxGpuJobDescription* copyJob   = addGpuJob(contextPrivate, jobBatch, FFX_GPU_JOB_COPY);
+                copyJob->copyJobDescriptor.src = copySources[i];
+                copyJob->copyJobDescriptor.dst = destSources[i];
             }
         }
 
@@ -1104,14 +968,15 @@ FFX_API FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext*
             if (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_READ_ONLY) initialState = FFX_RESOURCE_STATE_COMPUTE_READ;
             if (currentSurfaceDescription->usage == FFX_RESOURCE_USAGE_RENDERTARGET) initialState = FFX_RESOURCE_STATE_RENDER_TARGET;
 
-            FfxGpuJobDescription barrier = {FFX_GPU_JOB_BARRIER};
-            barrier.barrierDescriptor.resource = contextPrivate->srvResources[currentSurfaceDescription->id];
-            barrier.barrierDescriptor.subResourceID = 0;
-            barrier.barrierDescriptor.newState = (currentSurfaceDescription->id == FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNTERS) ? FFX_RESOURCE_STATE_COPY_DEST : initialState;
-            barrier.barrierDescriptor.barrierType = FFX_BARRIER_TYPE_TRANSITION;
-            contextPrivate->contextDescription.backendInterface.fpScheduleGpuJob(&contextPrivate->contextDescription.backendInterface, &barrier);
+            FfxGpuJobDescription* barrier = addGpuJob(contextPrivate, jobBatch, FFX_GPU_JOB_BARRIER);
+            barrier->barrierDescriptor.resource = contextPrivate->srvResources[currentSurfaceDescription->id];
+            barrier->barrierDescriptor.subResourceID = 0;
+            barrier->barrierDescriptor.newState = (currentSurfaceDescription->id == FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNTERS) ? FFX_RESOURCE_STATE_COPY_DEST : initialState;
+            barrier->barrierDescriptor.barrierType = FFX_BARRIER_TYPE_TRANSITION;
         }
 
+        ffxGpuJobBatchSchedule(&contextPrivate->contextDescription.backendInterface, jobBatch);
+
         // schedule optical flow and frame interpolation
         contextPrivate->contextDescription.backendInterface.fpExecuteGpuJobs(&contextPrivate->contextDescription.backendInterface, params->commandList, contextPrivate->effectContextId);
     }
@@ -137,6 +137,10 @@ typedef struct FfxFrameInterpolationContext_Private {
     FfxResourceInternal                         srvResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT];
     FfxResourceInternal                         uavResources[FFX_FRAMEINTERPOLATION_RESOURCE_IDENTIFIER_COUNT];
 
+    // the jobs of one prepare or interpolation dispatch, scheduled together. Separate, as the two can be recorded on different threads
+    FfxGpuJobBatch                              prepareJobBatch;
+    FfxGpuJobBatch                              jobBatch;
+
     bool                                        firstExecution;
     bool                                        refreshPipelineStates;
 
@@ -42,6 +42,8 @@
 #include <FidelityFX/gpu/fsr2/ffx_fsr2_callbacks_hlsl.h>
 #include <FidelityFX/gpu/fsr2/ffx_fsr2_common.h>
 #include <ffx_object_management.h>
+#include <ffx_upscaler_tables.h>
+#include <ffx_binding_lookup.h>
 
 #include "ffx_fsr2_maximum_bias.h"
 
@@ -167,25 +169,23 @@ typedef union Fsr2SecondaryUnion {
     Fsr2GenerateReactiveConstants2  autogenReactive;
 } Fsr2SecondaryUnion;
 
-// Lanczos
-static float lanczos2(float value)
-{
-    return abs(value) < FFX_EPSILON ? 1.f : (sinf(FFX_PI * value) / (FFX_PI * value)) * (sinf(0.5f * FFX_PI * value) / (0.5f * FFX_PI * value));
-}
-
-// Calculate halton number for index and base.
-static float halton(int32_t index, int32_t base)
-{
-    float f = 1.0f, result = 0.0f;
+// The upload path only supports R16_SNORM, so the maximum bias table is converted on first use
+typedef struct Fsr2MaximumBiasLut {
+    int16_t values[FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT];
 
-    for (int32_t currentIndex = index; currentIndex > 0;) {
+    Fsr2MaximumBiasLut()
+    {
+        for (uint32_t i = 0; i < FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT; ++i) {
 
-        f /= (float)base;
-        result = result + f * (float)(currentIndex % base);
-        currentIndex = (uint32_t)(floorf((float)(currentIndex) / (float)(base)));
+            values[i] = int16_t(roundf(ffxFsr2MaximumBias[i] / 2.0f * 32767.0f));
+        }
     }
+} Fsr2MaximumBiasLut;
 
-    return result;
+static const int16_t* getMaximumBiasLut()
+{
+    static const Fsr2MaximumBiasLut lut;
+    return lut.values;
 }
 
 static void fsr2DebugCheckDispatch(FfxFsr2Context_Private* context, const FfxFsr2DispatchDescription* params)
@@ -323,47 +323,19 @@ static void fsr2DebugCheckDispatch(FfxFsr2Context_Private* context, const FfxFsr
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup constantBufferBindingLookup(constantBufferBindingTable);
 
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    if (!constantBufferBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -524,23 +496,8 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
     context->constants.displaySize[0] = contextDescription->displaySize.width;
     context->constants.displaySize[1] = contextDescription->displaySize.height;
 
-    // generate the data for the LUT.
-    const uint32_t lanczos2LutWidth = 128;
-    int16_t lanczos2Weights[lanczos2LutWidth] = { };
-
-    for (uint32_t currentLanczosWidthIndex = 0; currentLanczosWidthIndex < lanczos2LutWidth; currentLanczosWidthIndex++) {
-
-        const float x = 2.0f * currentLanczosWidthIndex / float(lanczos2LutWidth - 1);
-        const float y = lanczos2(x);
-        lanczos2Weights[currentLanczosWidthIndex] = int16_t(roundf(y * 32767.0f));
-    }
-
-    // upload path only supports R16_SNORM, let's go and convert
-    int16_t maximumBias[FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT];
-    for (uint32_t i = 0; i < FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT; ++i) {
-
-        maximumBias[i] = int16_t(roundf(ffxFsr2MaximumBias[i] / 2.0f * 32767.0f));
-    }
+    // converted once, shared by every context
+    const int16_t* maximumBias = getMaximumBiasLut();
 
     // declare internal resources needed
     const FfxInternalResourceDescription internalSurfaceDesc[] = {
@@ -726,11 +683,11 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
          FFX_RESOURCE_TYPE_TEXTURE2D,
          FFX_RESOURCE_USAGE_READ_ONLY,
          FFX_SURFACE_FORMAT_R16_SNORM,
-         lanczos2LutWidth,
+         FFX_LANCZOS2_LUT_WIDTH,
          1,
          1,
          FFX_RESOURCE_FLAGS_NONE,
-         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(lanczos2Weights), lanczos2Weights}},
+         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, FFX_LANCZOS2_LUT_WIDTH * sizeof(int16_t), const_cast<int16_t*>(ffxGetLanczos2Lut())}},
 
         {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY,
          L"FSR2_DefaultReactiviyMask",
@@ -752,7 +709,7 @@ static FfxErrorCode fsr2Create(FfxFsr2Context_Private* context, const FfxFsr2Con
          FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT,
          1,
          FFX_RESOURCE_FLAGS_NONE,
-         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(maximumBias), maximumBias}},
+         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, FFX_FSR2_MAXIMUM_BIAS_TEXTURE_WIDTH * FFX_FSR2_MAXIMUM_BIAS_TEXTURE_HEIGHT * sizeof(int16_t), const_cast<int16_t*>(maximumBias)}},
 
         {FFX_FSR2_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_EXPOSURE,
          L"FSR2_DefaultExposure",
@@ -1478,11 +1435,7 @@ FfxErrorCode ffxFsr2GetJitterOffset(float* outX, float* outY, int32_t index, int
         phaseCount > 0,
         FFX_ERROR_INVALID_ARGUMENT);
 
-    const float x = halton((index % phaseCount) + 1, 2) - 0.5f;
-    const float y = halton((index % phaseCount) + 1, 3) - 0.5f;
-
-    *outX = x;
-    *outY = y;
+    ffxGetJitterOffsetFromTable(outX, outY, index, phaseCount);
     return FFX_OK;
 }
 
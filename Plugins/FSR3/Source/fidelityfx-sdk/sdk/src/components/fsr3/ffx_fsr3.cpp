@@ -32,6 +32,10 @@
 #pragma clang diagnostic ignored "-Wsign-compare"
 #endif
 
+#include <algorithm>    // for find
+#include <mutex>
+#include <vector>
+
 #include <FidelityFX/gpu/ffx_core.h>
 #include <FidelityFX/gpu/fsr3/ffx_fsr3_resources.h>
 #include <ffx_object_management.h>
@@ -39,8 +43,16 @@
 
 #include "ffx_fsr3_private.h"
 
-// To track only one context is present, also used in fi dispatch callback
-static FfxFsr3Context* s_Context = nullptr;
+// Contexts with frame generation enabled, used to route ffxFsr3DispatchFrameGeneration when the
+// swapchain callback does not carry the context in its user data
+static std::mutex                    s_FrameGenerationContextsMutex;
+static std::vector<FfxFsr3Context*>  s_FrameGenerationContexts;
+
+static void unregisterFrameGenerationContext(FfxFsr3Context* context)
+{
+    std::lock_guard<std::mutex> lock(s_FrameGenerationContextsMutex);
+    s_FrameGenerationContexts.erase(std::remove(s_FrameGenerationContexts.begin(), s_FrameGenerationContexts.end(), context), s_FrameGenerationContexts.end());
+}
 
 FfxErrorCode ffxFsr3ContextCreate(FfxFsr3Context* context, FfxFsr3ContextDescription* contextDescription)
 {
@@ -274,15 +286,10 @@ FfxErrorCode ffxFsr3ContextGenerateReactiveMask(FfxFsr3Context* context, const F
     return ffxFsr3UpscalerContextGenerateReactiveMask(&contextPrivate->upscalerContext, &fsr3Params);
 }
 
-FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* callbackDesc)
+static FfxErrorCode fsr3DispatchFrameGeneration(FfxFsr3Context_Private* contextPrivate, const FfxFrameGenerationDispatchDescription* callbackDesc)
 {
     FfxErrorCode errorCode = FFX_OK;
 
-    FFX_RETURN_ON_ERROR(s_Context, FFX_ERROR_INVALID_POINTER);
-    FFX_RETURN_ON_ERROR(callbackDesc, FFX_ERROR_INVALID_POINTER);
-
-    FfxFsr3Context_Private* contextPrivate = (FfxFsr3Context_Private*)(s_Context);
-
     bool upscalingOnly     = (contextPrivate->description.flags & FFX_FSR3_ENABLE_UPSCALING_ONLY) != 0;
     FFX_ASSERT_MESSAGE(upscalingOnly == false, "Fsr3 context has not been initialized to support Frame Generation");
 
@@ -361,6 +368,38 @@ FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDesc
     return errorCode;
 }
 
+FfxErrorCode ffxFsr3ContextDispatchFrameGeneration(FfxFsr3Context* context, const FfxFrameGenerationDispatchDescription* callbackDesc)
+{
+    FFX_RETURN_ON_ERROR(context, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(callbackDesc, FFX_ERROR_INVALID_POINTER);
+
+    return fsr3DispatchFrameGeneration((FfxFsr3Context_Private*)(context), callbackDesc);
+}
+
+FfxErrorCode ffxFsr3DispatchFrameGenerationCallback(const FfxFrameGenerationDispatchDescription* callbackDesc, void* callbackContext)
+{
+    if (callbackContext) {
+        return ffxFsr3ContextDispatchFrameGeneration((FfxFsr3Context*)callbackContext, callbackDesc);
+    }
+
+    return ffxFsr3DispatchFrameGeneration(callbackDesc);
+}
+
+FfxErrorCode ffxFsr3DispatchFrameGeneration(const FfxFrameGenerationDispatchDescription* callbackDesc)
+{
+    FfxFsr3Context* context = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(s_FrameGenerationContextsMutex);
+        FFX_ASSERT_MESSAGE(s_FrameGenerationContexts.size() <= 1,
+                           "Several Fsr3 contexts have frame generation enabled, use ffxFsr3ContextDispatchFrameGeneration or ffxFsr3DispatchFrameGenerationCallback instead");
+        if (s_FrameGenerationContexts.size() == 1) {
+            context = s_FrameGenerationContexts[0];
+        }
+    }
+
+    return ffxFsr3ContextDispatchFrameGeneration(context, callbackDesc);
+}
+
 FfxErrorCode ffxFsr3ContextDispatchUpscale(FfxFsr3Context* context, const FfxFsr3DispatchUpscaleDescription* dispatchParams)
 {
     FfxErrorCode ret = FFX_OK;
@@ -508,11 +547,11 @@ FfxErrorCode ffxFsr3ConfigureFrameGeneration(FfxFsr3Context* context, const FfxF
         contextPrivate->frameGenerationEnabled = patchedConfig.frameGenerationEnabled;
 
         if (contextPrivate->frameGenerationEnabled) {
-            FFX_ASSERT(nullptr == s_Context);
-            s_Context = context;
+            std::lock_guard<std::mutex> lock(s_FrameGenerationContextsMutex);
+            s_FrameGenerationContexts.push_back(context);
         }
-        else if (s_Context == context) {
-            s_Context = nullptr;
+        else {
+            unregisterFrameGenerationContext(context);
         }
     }
 
@@ -543,9 +582,7 @@ FfxErrorCode ffxFsr3ContextDestroy(FfxFsr3Context* context)
         FFX_VALIDATE(ffxFsr3UpscalerContextDestroy(&contextPrivate->upscalerContext));
     }
 
-    if (s_Context == context) {
-        s_Context = nullptr;
-    }
+    unregisterFrameGenerationContext(context);
 
     return FFX_OK;
 }
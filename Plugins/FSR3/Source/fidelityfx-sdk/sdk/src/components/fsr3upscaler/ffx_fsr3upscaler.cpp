@@ -40,87 +40,18 @@
 #include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_resources.h>
 #include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_common.h>
 #include <ffx_object_management.h>
+#include <ffx_upscaler_tables.h>
+#include <ffx_binding_lookup.h>
 
 // max queued frames for descriptor management
 static const uint32_t FSR3UPSCALER_MAX_QUEUED_FRAMES = 16;
 
+// clears, discards and dispatches of the largest fsr3upscalerDispatch (first frame, sharpening and debug view)
+static const uint32_t FSR3UPSCALER_MAX_GPU_JOBS = 32;
+
 #include "ffx_fsr3upscaler_private.h"
 
-// lists to map shader resource bindpoint name to resource identifier
-typedef struct ResourceBinding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}ResourceBinding;
-
-static const ResourceBinding srvTextureBindingTable[] =
-{
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_COLOR,                              L"r_input_color_jittered"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_OPAQUE_ONLY,                        L"r_input_opaque_only"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_MOTION_VECTORS,                     L"r_input_motion_vectors"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_DEPTH,                              L"r_input_depth" },
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_EXPOSURE,                           L"r_input_exposure"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FRAME_INFO,                               L"r_frame_info"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_REACTIVE_MASK,                      L"r_reactive_mask"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INPUT_TRANSPARENCY_AND_COMPOSITION_MASK,  L"r_transparency_and_composition_mask"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH,     L"r_reconstructed_previous_nearest_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                   L"r_dilated_motion_vectors"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_DEPTH,                            L"r_dilated_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR,                  L"r_internal_upscaled_color"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION,                             L"r_accumulation"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_HISTORY,                             L"r_luma_history" },
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_RCAS_INPUT,                               L"r_rcas_input"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LANCZOS_LUT,                              L"r_lanczos_lut"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS,                                 L"r_spd_mips"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,                   L"r_dilated_reactive_masks"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_NEW_LOCKS,                                L"r_new_locks"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH,                           L"r_farthest_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1,                      L"r_farthest_depth_mip1"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SHADING_CHANGE,                           L"r_shading_change"},
-
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_CURRENT_LUMA,                             L"r_current_luma"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_PREVIOUS_LUMA,                            L"r_previous_luma"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_INSTABILITY,                         L"r_luma_instability"},
-};
-
-static const ResourceBinding uavTextureBindingTable[] =
-{
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH,     L"rw_reconstructed_previous_nearest_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_MOTION_VECTORS,                   L"rw_dilated_motion_vectors"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_DEPTH,                            L"rw_dilated_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERNAL_UPSCALED_COLOR,                  L"rw_internal_upscaled_color"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION,                             L"rw_accumulation"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_HISTORY,                             L"rw_luma_history"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_UPSCALED_OUTPUT,                          L"rw_upscaled_output"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_DILATED_REACTIVE_MASKS,                   L"rw_dilated_reactive_masks"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FRAME_INFO,                               L"rw_frame_info"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT,                         L"rw_spd_global_atomic"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_NEW_LOCKS,                                L"rw_new_locks"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_AUTOREACTIVE,                             L"rw_output_autoreactive"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SHADING_CHANGE,                           L"rw_shading_change"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH,                           L"rw_farthest_depth"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FARTHEST_DEPTH_MIP1,                      L"rw_farthest_depth_mip1"},
-
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_CURRENT_LUMA,                             L"rw_current_luma"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_INSTABILITY,                         L"rw_luma_instability"},
-
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_0,                         L"rw_spd_mip0"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_1,                         L"rw_spd_mip1"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_2,                         L"rw_spd_mip2"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_3,                         L"rw_spd_mip3"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_4,                         L"rw_spd_mip4"},
-    {FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS_LEVEL_5,                         L"rw_spd_mip5"},
-
-
-};
-
-static const ResourceBinding constantBufferBindingTable[] =
-{
-    {FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_FSR3UPSCALER,   L"cbFSR3Upscaler"},
-    {FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_SPD,            L"cbSPD"},
-    {FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_RCAS,           L"cbRCAS"},
-    {FFX_FSR3UPSCALER_CONSTANTBUFFER_IDENTIFIER_GENREACTIVE,    L"cbGenerateReactive"},
-};
+#include "ffx_fsr3upscaler_bindings.h"
 
 typedef struct Fsr3UpscalerRcasConstants {
 
@@ -160,27 +91,6 @@ typedef union Fsr3UpscalerSecondaryUnion {
     Fsr3UpscalerGenerateReactiveConstants2  autogenReactive;
 } Fsr3UpscalerSecondaryUnion;
 
-// Lanczos
-static float lanczos2(float value)
-{
-    return abs(value) < FFX_EPSILON ? 1.f : (sinf(FFX_PI * value) / (FFX_PI * value)) * (sinf(0.5f * FFX_PI * value) / (0.5f * FFX_PI * value));
-}
-
-// Calculate halton number for index and base.
-static float halton(int32_t index, int32_t base)
-{
-    float f = 1.0f, result = 0.0f;
-
-    for (int32_t currentIndex = index; currentIndex > 0;) {
-
-        f /= (float)base;
-        result = result + f * (float)(currentIndex % base);
-        currentIndex = (uint32_t)(floorf((float)(currentIndex) / (float)(base)));
-    }
-
-    return result;
-}
-
 static void fsr3upscalerDebugCheckDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription* params)
 {
     if (params->commandList == nullptr)
@@ -316,47 +226,19 @@ static void fsr3upscalerDebugCheckDispatch(FfxFsr3UpscalerContext_Private* conte
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup constantBufferBindingLookup(constantBufferBindingTable);
 
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == _countof(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    if (!constantBufferBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -524,6 +406,9 @@ static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context,
     errorCode = context->contextDescription.backendInterface.fpGetDeviceCapabilities(&context->contextDescription.backendInterface, &context->deviceCapabilities);
     FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
 
+    errorCode = ffxGpuJobBatchCreate(&context->jobBatch, FSR3UPSCALER_MAX_GPU_JOBS);
+    FFX_RETURN_ON_ERROR(errorCode == FFX_OK, errorCode);
+
     // set defaults
     context->firstExecution = true;
     context->resourceFrameIndex = 0;
@@ -532,17 +417,6 @@ static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context,
     context->constants.maxUpscaleSize[1] = contextDescription->maxUpscaleSize.height;
     context->constants.velocityFactor = 1.0f;
 
-    // generate the data for the LUT.
-    const uint32_t lanczos2LutWidth = 128;
-    int16_t lanczos2Weights[lanczos2LutWidth] = { };
-
-    for (uint32_t currentLanczosWidthIndex = 0; currentLanczosWidthIndex < lanczos2LutWidth; currentLanczosWidthIndex++) {
-
-        const float x = 2.0f * currentLanczosWidthIndex / float(lanczos2LutWidth - 1);
-        const float y = lanczos2(x);
-        lanczos2Weights[currentLanczosWidthIndex] = int16_t(roundf(y * 32767.0f));
-    }
-
     uint8_t defaultReactiveMaskData = 0U;
     uint32_t atomicInitData = 0U;
     float defaultExposure[] = { 0.0f, 0.0f };
@@ -598,7 +472,7 @@ static FfxErrorCode fsr3upscalerCreate(FfxFsr3UpscalerContext_Private* context,
             FFX_SURFACE_FORMAT_R8G8B8A8_UNORM, contextDescription->maxRenderSize.width, contextDescription->maxRenderSize.height, 1, FFX_RESOURCE_FLAGS_ALIASABLE, {FFX_RESOURCE_INIT_DATA_TYPE_UNINITIALIZED} },
 
         {   FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LANCZOS_LUT, L"FSR3UPSCALER_LanczosLutData", FFX_RESOURCE_TYPE_TEXTURE2D, FFX_RESOURCE_USAGE_READ_ONLY,
-            FFX_SURFACE_FORMAT_R16_SNORM, lanczos2LutWidth, 1, 1, FFX_RESOURCE_FLAGS_NONE, {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(lanczos2Weights), lanczos2Weights} },
+            FFX_SURFACE_FORMAT_R16_SNORM, FFX_LANCZOS2_LUT_WIDTH, 1, 1, FFX_RESOURCE_FLAGS_NONE, {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, FFX_LANCZOS2_LUT_WIDTH * sizeof(int16_t), const_cast<int16_t*>(ffxGetLanczos2Lut())} },
 
         {   FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_INTERNAL_DEFAULT_REACTIVITY, L"FSR3UPSCALER_DefaultReactiviyMask", FFX_RESOURCE_TYPE_TEXTURE2D, FFX_RESOURCE_USAGE_READ_ONLY,
             FFX_SURFACE_FORMAT_R8_UNORM, 1, 1, 1, FFX_RESOURCE_FLAGS_NONE, FfxResourceInitData::FfxResourceInitValue(sizeof(defaultReactiveMaskData), defaultReactiveMaskData) },
@@ -695,6 +569,8 @@ static FfxErrorCode fsr3upscalerRelease(FfxFsr3UpscalerContext_Private* context)
         ffxSafeReleaseResource(&context->contextDescription.backendInterface, context->srvResources[currentResourceIndex], context->effectContextId);
     }
 
+    ffxGpuJobBatchDestroy(&context->jobBatch);
+
     // Destroy the context
     context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, context->effectContextId);
 
@@ -752,9 +628,25 @@ static void setupDeviceDepthToViewSpaceDepthParams(FfxFsr3UpscalerContext_Privat
     context->constants.deviceToViewDepth[3] = (1.0f / b);
 }
 
+static FfxGpuJobDescription* addGpuJob(FfxFsr3UpscalerContext_Private* context, FfxGpuJobType jobType)
+{
+    return ffxGpuJobBatchAdd(&context->contextDescription.backendInterface, &context->jobBatch, jobType);
+}
+
+static void addClearJob(FfxFsr3UpscalerContext_Private* context, const wchar_t* label, FfxResourceInternal target, const float color[4])
+{
+    FfxGpuJobDescription* clearJob = addGpuJob(context, FFX_GPU_JOB_CLEAR_FLOAT);
+    wcscpy_s(clearJob->jobLabel, label);
+    memcpy(clearJob->clearJobDescriptor.color, color, 4 * sizeof(float));
+    clearJob->clearJobDescriptor.target = target;
+}
+
 static void scheduleDispatch(FfxFsr3UpscalerContext_Private* context, const FfxFsr3UpscalerDispatchDescription*, const FfxPipelineState* pipeline, uint32_t dispatchX, uint32_t dispatchY)
 {
-    FfxComputeJobDescription jobDescriptor = {};
+    FfxGpuJobDescription* dispatchJob = addGpuJob(context, FFX_GPU_JOB_COMPUTE);
+    wcscpy_s(dispatchJob->jobLabel, pipeline->name);
+
+    FfxComputeJobDescription& jobDescriptor = dispatchJob->computeJobDescriptor;
 
     for (uint32_t currentShaderResourceViewIndex = 0; currentShaderResourceViewIndex < pipeline->srvTextureCount; ++currentShaderResourceViewIndex) {
 
@@ -798,12 +690,6 @@ static void scheduleDispatch(FfxFsr3UpscalerContext_Private* context, const FfxF
 #endif
         jobDescriptor.cbs[currentRootConstantIndex] = context->constantBuffers[pipeline->constantBufferBindings[currentRootConstantIndex].resourceIdentifier];
     }
-
-    FfxGpuJobDescription dispatchJob = { FFX_GPU_JOB_COMPUTE };
-    wcscpy_s(dispatchJob.jobLabel, pipeline->name);
-    dispatchJob.computeJobDescriptor = jobDescriptor;
-
-    context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &dispatchJob);
 }
 
 FFX_API FfxErrorCode ffxFsr3UpscalerGetSharedResourceDescriptions(FfxFsr3UpscalerContext* context, FfxFsr3UpscalerSharedResourceDescriptions* SharedResources)
@@ -839,24 +725,13 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
 
     if (context->firstExecution)
     {
-        FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
-        
         const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
-        memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
-
-        wcscpy_s(clearJob.jobLabel, L"Clear Accumulation 1");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION_1];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
-        wcscpy_s(clearJob.jobLabel, L"Clear Accumulation 2");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION_2];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
-
-        wcscpy_s(clearJob.jobLabel, L"Clear Temporal Luma 1");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_1];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
-        wcscpy_s(clearJob.jobLabel, L"Clear Temporal Luma 2");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_2];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+
+        addClearJob(context, L"Clear Accumulation 1", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION_1], clearValuesToZeroFloat);
+        addClearJob(context, L"Clear Accumulation 2", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_ACCUMULATION_2], clearValuesToZeroFloat);
+
+        addClearJob(context, L"Clear Temporal Luma 1", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_1], clearValuesToZeroFloat);
+        addClearJob(context, L"Clear Temporal Luma 2", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_LUMA_2], clearValuesToZeroFloat);
     }
 
     // Prepare per frame descriptor tables
@@ -1038,48 +913,30 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
     // Clear reconstructed depth for max depth store.
     if (resetAccumulation) {
 
-        FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
-        wcscpy_s(clearJob.jobLabel, L"Clear Resource");
-
         const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
-        memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
-        clearJob.clearJobDescriptor.target = context->srvResources[accumulationSrvResourceIndex];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        addClearJob(context, L"Clear Resource", context->srvResources[accumulationSrvResourceIndex], clearValuesToZeroFloat);
 
-        wcscpy_s(clearJob.jobLabel, L"Clear Scene Luminance");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        addClearJob(context, L"Clear Scene Luminance", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS], clearValuesToZeroFloat);
 
         // Auto exposure always used to track luma changes in locking logic
         {
             const float clearValuesExposure[]{ -1.f, 1.f, 0.f, 0.f };
-            memcpy(clearJob.clearJobDescriptor.color, clearValuesExposure, 4 * sizeof(float));
-            wcscpy_s(clearJob.jobLabel, L"Clear Frame Info");
-            clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FRAME_INFO];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+            addClearJob(context, L"Clear Frame Info", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_FRAME_INFO], clearValuesExposure);
         }
     }
 
     {
-        FfxGpuJobDescription clearJob = {FFX_GPU_JOB_CLEAR_FLOAT};
         // FSR3: need to clear here since we need the content of this surface for frameinterpolation
         // so clearing in the lock pass is not an option
         const bool  bInverted = (context->contextDescription.flags & FFX_FSR3UPSCALER_ENABLE_DEPTH_INVERTED) == FFX_FSR3UPSCALER_ENABLE_DEPTH_INVERTED;
         const float clearDepthValue[]{bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f, bInverted ? 0.f : 1.f};
-        memcpy(clearJob.clearJobDescriptor.color, clearDepthValue, 4 * sizeof(float));
-        wcscpy_s(clearJob.jobLabel, L"Clear Reconstructed Previous Nearest Depth");
-        clearJob.clearJobDescriptor.target = context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH];
-        context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+        addClearJob(context, L"Clear Reconstructed Previous Nearest Depth", context->srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_RECONSTRUCTED_PREVIOUS_NEAREST_DEPTH], clearDepthValue);
     }
 
     // Suggested by Enduring to resolve issues with running FSR3 on console via the RHI backend in the plugin as this resource won't be cleared to 0 by default.
 	{
-		FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
-		wcscpy_s(clearJob.jobLabel, L"Clear Spd Atomic Count");
 		const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
-		memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
-		clearJob.clearJobDescriptor.target = context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT];
-		context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+		addClearJob(context, L"Clear Spd Atomic Count", context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_ATOMIC_COUNT], clearValuesToZeroFloat);
 	}
 
     // Auto exposure
@@ -1120,18 +977,13 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
         };
         for(int i = 0; i<_countof(aliasableResources); ++i)
         {
-            FfxGpuJobDescription discardJob = { FFX_GPU_JOB_DISCARD };
-            discardJob.discardJobDescriptor.target = aliasableResources[i];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &discardJob);
+            FfxGpuJobDescription* discardJob = addGpuJob(context, FFX_GPU_JOB_DISCARD);
+            discardJob->discardJobDescriptor.target = aliasableResources[i];
         }
         // SPD counter needs to be cleared
         {
-            FfxGpuJobDescription clearJob = { FFX_GPU_JOB_CLEAR_FLOAT };
-            wcscpy_s(clearJob.jobLabel, L"Clear Spd Atomic Count");
             const float clearValuesToZeroFloat[]{ 0.f, 0.f, 0.f, 0.f };
-            memcpy(clearJob.clearJobDescriptor.color, clearValuesToZeroFloat, 4 * sizeof(float));
-            clearJob.clearJobDescriptor.target = context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS];
-            context->contextDescription.backendInterface.fpScheduleGpuJob(&context->contextDescription.backendInterface, &clearJob);
+            addClearJob(context, L"Clear Spd Atomic Count", context->uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_SPD_MIPS], clearValuesToZeroFloat);
         }
     }
 
@@ -1164,6 +1016,9 @@ static FfxErrorCode fsr3upscalerDispatch(FfxFsr3UpscalerContext_Private* context
     // Fsr3UpscalerMaxQueuedFrames must be an even number.
     FFX_STATIC_ASSERT((FSR3UPSCALER_MAX_QUEUED_FRAMES & 1) == 0);
 
+    // hand all jobs of this dispatch to the backend at once
+    ffxGpuJobBatchSchedule(&context->contextDescription.backendInterface, &context->jobBatch);
+
     context->contextDescription.backendInterface.fpExecuteGpuJobs(&context->contextDescription.backendInterface, commandList, context->effectContextId);
 
     // release dynamic resources
@@ -1331,11 +1186,7 @@ FfxErrorCode ffxFsr3UpscalerGetJitterOffset(float* outX, float* outY, int32_t in
         phaseCount > 0,
         FFX_ERROR_INVALID_ARGUMENT);
 
-    const float x = halton((index % phaseCount) + 1, 2) - 0.5f;
-    const float y = halton((index % phaseCount) + 1, 3) - 0.5f;
-
-    *outX = x;
-    *outY = y;
+    ffxGetJitterOffsetFromTable(outX, outY, index, phaseCount);
     return FFX_OK;
 }
 
@@ -106,6 +106,9 @@ typedef struct FfxFsr3UpscalerContext_Private {
     FfxResourceInternal                 srvResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT];
     FfxResourceInternal                 uavResources[FFX_FSR3UPSCALER_RESOURCE_IDENTIFIER_COUNT];
 
+    // the jobs of one dispatch, scheduled together
+    FfxGpuJobBatch                      jobBatch;
+
     bool                                firstExecution;
     uint32_t                            resourceFrameIndex;
     float                               previousJitterOffset[2];
@@ -36,48 +36,13 @@
 #include <FidelityFX/gpu/spd/ffx_spd.h>
 #include <FidelityFX/gpu/opticalflow/ffx_opticalflow_callbacks_hlsl.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #define FFX_OPTICALFLOW_MAX_QUEUED_FRAMES 16
 
 #include "ffx_opticalflow_private.h"
 
-typedef struct Binding
-{
-    uint32_t    index;
-    wchar_t     name[64];
-}Binding;
-
-static const Binding srvBindingNames[] =
-{
-    {FFX_OF_BINDING_IDENTIFIER_INPUT_COLOR,                           L"r_input_color"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT,                    L"r_optical_flow_input"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_PREVIOUS_INPUT,           L"r_optical_flow_previous_input"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW,                          L"r_optical_flow"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_PREVIOUS,                 L"r_optical_flow_previous"},
-};
-
-static const Binding uavBindingNames[] =
-{
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT,                      L"rw_optical_flow_input"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_1,              L"rw_optical_flow_input_level_1"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_2,              L"rw_optical_flow_input_level_2"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_3,              L"rw_optical_flow_input_level_3"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_4,              L"rw_optical_flow_input_level_4"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_5,              L"rw_optical_flow_input_level_5"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_INPUT_LEVEL_6,              L"rw_optical_flow_input_level_6"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW,                            L"rw_optical_flow"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_NEXT_LEVEL,                 L"rw_optical_flow_next_level"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_SCD_HISTOGRAM,              L"rw_optical_flow_scd_histogram"}, // scene change detection histogram
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_SCD_PREVIOUS_HISTOGRAM,     L"rw_optical_flow_scd_previous_histogram"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_SCD_TEMP,                   L"rw_optical_flow_scd_temp"},
-    {FFX_OF_BINDING_IDENTIFIER_OPTICAL_FLOW_SCD_OUTPUT,                 L"rw_optical_flow_scd_output"},
-};
-
-static const Binding cbBindingNames[] =
-{
-    {FFX_OPTICALFLOW_CONSTANTBUFFER_IDENTIFIER,       L"cbOF"},
-    {FFX_OPTICALFLOW_CONSTANTBUFFER_IDENTIFIER_SPD,   L"cbOF_SPD"}
-};
+#include "ffx_opticalflow_bindings.h"
 
 // Broad structure of the root signature.
 typedef enum OpticalFlowRootSignatureLayout {
@@ -104,50 +69,25 @@ typedef struct OpticalFlowSpdConstants
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(srvBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(srvBindingNames[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(srvBindingNames));
-        if (mapIndex == _countof(srvBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvBindingNames[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(uavBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBindingNames[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(uavBindingNames));
-        if (mapIndex == _countof(uavBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavBindingNames[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < _countof(cbBindingNames); ++mapIndex)
-        {
-            if (0 == wcscmp(cbBindingNames[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        FFX_ASSERT(mapIndex < _countof(cbBindingNames));
-        if (mapIndex == _countof(cbBindingNames))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = cbBindingNames[mapIndex].index;
-    }
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvBindingLookup(srvBindingNames);
+    static const FfxBindingLookup uavBindingLookup(uavBindingNames);
+    static const FfxBindingLookup cbBindingLookup(cbBindingNames);
+
+    const bool srvResolved = srvBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount);
+    FFX_ASSERT(srvResolved);
+    if (!srvResolved)
+        return FFX_ERROR_INVALID_ARGUMENT;
+
+    const bool uavResolved = uavBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount);
+    FFX_ASSERT(uavResolved);
+    if (!uavResolved)
+        return FFX_ERROR_INVALID_ARGUMENT;
+
+    const bool cbResolved = cbBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount);
+    FFX_ASSERT(cbResolved);
+    if (!cbResolved)
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -233,6 +173,14 @@ constexpr uint32_t HistogramBins = 256;
 constexpr uint32_t HistogramsPerDim = 3;
 constexpr uint32_t HistogramShifts = 3;
 
+// Per level pass names, used as job labels so backends can attribute GPU time to each pass
+static const wchar_t* const OpticalFlowSearchPassNames[OpticalFlowMaxPyramidLevels] = {
+    L"OF 0 Search", L"OF 1 Search", L"OF 2 Search", L"OF 3 Search", L"OF 4 Search", L"OF 5 Search", L"OF 6 Search" };
+static const wchar_t* const OpticalFlowFilterPassNames[OpticalFlowMaxPyramidLevels] = {
+    L"OF 0 Filter", L"OF 1 Filter", L"OF 2 Filter", L"OF 3 Filter", L"OF 4 Filter", L"OF 5 Filter", L"OF 6 Filter" };
+static const wchar_t* const OpticalFlowScalePassNames[OpticalFlowMaxPyramidLevels] = {
+    L"OF 0 Scale", L"OF 1 Scale", L"OF 2 Scale", L"OF 3 Scale", L"OF 4 Scale", L"OF 5 Scale", L"OF 6 Scale" };
+
 static FfxDimensions2D GetOpticalFlowTextureSize(const FfxDimensions2D& displaySize, const uint32_t opticalFlowBlockSize)
 {
     uint32_t width = (displaySize.width + opticalFlowBlockSize - 1) / opticalFlowBlockSize;
@@ -745,7 +693,7 @@ static FfxErrorCode dispatch(FfxOpticalflowContext_Private* context, const FfxOp
                 {
                     const FfxUInt32 inputLumaWidth = ffxMax(context->contextDescription.resolution.width >> level, 1);
                     const FfxUInt32 inputLumaHeight = ffxMax(context->contextDescription.resolution.height >> level, 1);
-                    std::wstring pipelineName = L"OF " + std::to_wstring(level) + L" Search";
+                    const wchar_t* pipelineName = OpticalFlowSearchPassNames[level];
 
                     {
                         uint32_t threadPixels = 4;
@@ -754,7 +702,7 @@ static FfxErrorCode dispatch(FfxOpticalflowContext_Private* context, const FfxOp
                         uint32_t threadGroupSize = 64;
                         uint32_t dispatchX = ((inputLumaWidth + threadPixels - 1) / threadPixels * threadGroupSizeY + (threadGroupSize - 1)) / threadGroupSize;
                         uint32_t dispatchY = (inputLumaHeight + (threadGroupSizeY - 1)) / threadGroupSizeY;
-                        scheduleDispatch(context, &context->pipelineComputeOpticalFlowAdvancedV5, pipelineName.c_str(), dispatchX, dispatchY);
+                        scheduleDispatch(context, &context->pipelineComputeOpticalFlowAdvancedV5, pipelineName, dispatchX, dispatchY);
                     }
                 }
 
@@ -776,10 +724,10 @@ static FfxErrorCode dispatch(FfxOpticalflowContext_Private* context, const FfxOp
                     const uint32_t threadGroupSizeY = 4;
                     const uint32_t dispatchX = (levelWidth + threadGroupSizeX - 1) / threadGroupSizeX;
                     const uint32_t dispatchY = (levelHeight + threadGroupSizeY - 1) / threadGroupSizeY;
-                    std::wstring pipelineName = L"OF " + std::to_wstring(level) + L" Filter";
+                    const wchar_t* pipelineName = OpticalFlowFilterPassNames[level];
 
                     {
-                        scheduleDispatch(context, &context->pipelineFilterOpticalFlowV5, pipelineName.c_str(), dispatchX, dispatchY);
+                        scheduleDispatch(context, &context->pipelineFilterOpticalFlowV5, pipelineName, dispatchX, dispatchY);
                     }
                 }
 
@@ -805,12 +753,12 @@ static FfxErrorCode dispatch(FfxOpticalflowContext_Private* context, const FfxOp
                     const uint32_t dispatchX = (nextLevelWidth + threadGroupSizeX - 1) / threadGroupSizeX;
                     const uint32_t dispatchY = (nextLevelHeight + threadGroupSizeY - 1) / threadGroupSizeY;
                     const uint32_t dispatchZ = 1;
-                    std::wstring pipelineName = L"OF " + std::to_wstring(level) + L" Scale";
+                    const wchar_t* pipelineName = OpticalFlowScalePassNames[level];
 
                     {
                         const uint32_t dispatchX = (nextLevelWidth + 3) / 4;
                         const uint32_t dispatchY = (nextLevelHeight + 3) / 4;
-                        scheduleDispatch(context, &context->pipelineScaleOpticalFlowAdvancedV5, pipelineName.c_str(), dispatchX, dispatchY, dispatchZ);
+                        scheduleDispatch(context, &context->pipelineScaleOpticalFlowAdvancedV5, pipelineName, dispatchX, dispatchY, dispatchZ);
                     }
 
                     {
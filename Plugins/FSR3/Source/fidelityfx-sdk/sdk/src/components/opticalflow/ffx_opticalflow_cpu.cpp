@@ -0,0 +1,614 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <string.h>     // for memset, memcpy
+#include <math.h>
+
+#include <FidelityFX/host/ffx_opticalflow.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FFX_OPTICALFLOW_CPU_SSE2 1
+#include <emmintrin.h>
+#else
+#define FFX_OPTICALFLOW_CPU_SSE2 0
+#endif
+
+// These mirror the constants used by ffx_opticalflow.cpp and the v5 shaders
+#define FFX_OPTICALFLOW_CPU_LEVEL_COUNT         (7)
+#define FFX_OPTICALFLOW_CPU_BLOCK_SIZE          (8)
+#define FFX_OPTICALFLOW_CPU_SEARCH_RADIUS       (8)
+#define FFX_OPTICALFLOW_CPU_SEARCH_WINDOW       (FFX_OPTICALFLOW_CPU_BLOCK_SIZE + 2 * FFX_OPTICALFLOW_CPU_SEARCH_RADIUS)
+#define FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS      (256)
+#define FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM  (3)
+#define FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT     (FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM * FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM)
+#define FFX_OPTICALFLOW_CPU_HISTOGRAM_SHIFTS    (3)
+#define FFX_OPTICALFLOW_CPU_SCD_FACTOR          (1000000.0f)
+#define FFX_OPTICALFLOW_CPU_SCD_THRESHOLD       (0.45f)
+
+// Scene change is reported for this many frames after a reset, like IsSceneChanged()
+#define FFX_OPTICALFLOW_CPU_WARMUP_FRAMES       (5)
+
+typedef struct OpticalflowCpuVector
+{
+    int32_t x;
+    int32_t y;
+} OpticalflowCpuVector;
+
+typedef struct OpticalflowCpuLuma
+{
+    const uint8_t*  pixels;
+    int32_t         width;
+    int32_t         height;
+} OpticalflowCpuLuma;
+
+// Persistent state at the start of the scratch memory
+typedef struct OpticalflowCpuState
+{
+    FfxDimensions2D resolution;
+    uint32_t        frameIndex;
+    uint32_t        currentInput;       // which of the two luma pyramids receives the current frame
+    uint32_t        sceneChangeHistory;
+} OpticalflowCpuState;
+
+// Placement of every buffer in the scratch memory
+typedef struct OpticalflowCpuLayout
+{
+    FfxDimensions2D lumaSizes[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    size_t          lumaOffsets[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    FfxDimensions2D flowSizes[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    size_t          flowOffsets[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    size_t          lumaPyramidOffsets[2];
+    size_t          lumaSumsOffset;
+    size_t          previousHistogramOffset;
+    size_t          flowOffset[2];
+    size_t          totalSize;
+} OpticalflowCpuLayout;
+
+static void getCpuLayout(FfxDimensions2D resolution, OpticalflowCpuLayout* layout)
+{
+    size_t lumaPyramidSize = 0;
+    size_t flowCount       = 0;
+    for (uint32_t level = 0; level < FFX_OPTICALFLOW_CPU_LEVEL_COUNT; ++level) {
+
+        layout->lumaSizes[level]   = { resolution.width >> level, resolution.height >> level };
+        layout->lumaOffsets[level] = lumaPyramidSize;
+        lumaPyramidSize += size_t(layout->lumaSizes[level].width) * layout->lumaSizes[level].height;
+
+        // same rounding as the OPTICALFLOW_OpticalFlow textures
+        layout->flowSizes[level] = (level == 0)
+            ? FfxDimensions2D{ FFX_DIVIDE_ROUNDING_UP(resolution.width, FFX_OPTICALFLOW_CPU_BLOCK_SIZE), FFX_DIVIDE_ROUNDING_UP(resolution.height, FFX_OPTICALFLOW_CPU_BLOCK_SIZE) }
+            : FfxDimensions2D{ (layout->flowSizes[level - 1].width + 1) / 2, (layout->flowSizes[level - 1].height + 1) / 2 };
+        layout->flowOffsets[level] = flowCount;
+        flowCount += size_t(layout->flowSizes[level].width) * layout->flowSizes[level].height;
+    }
+    lumaPyramidSize = FFX_ALIGN_UP(lumaPyramidSize, sizeof(uint64_t));
+
+    size_t offset = FFX_ALIGN_UP(sizeof(OpticalflowCpuState), sizeof(uint64_t));
+    layout->lumaPyramidOffsets[0] = offset;
+    offset += lumaPyramidSize;
+    layout->lumaPyramidOffsets[1] = offset;
+    offset += lumaPyramidSize;
+    layout->lumaSumsOffset = offset;
+    offset += FFX_ALIGN_UP(size_t(layout->lumaSizes[1].width) * layout->lumaSizes[1].height * sizeof(uint32_t), sizeof(uint64_t));
+    layout->previousHistogramOffset = offset;
+    offset += FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS * sizeof(float);
+    layout->flowOffset[0] = offset;
+    offset += flowCount * sizeof(OpticalflowCpuVector);
+    layout->flowOffset[1] = offset;
+    offset += flowCount * sizeof(OpticalflowCpuVector);
+    layout->totalSize = offset;
+}
+
+static inline int32_t clampInt(int32_t value, int32_t minimum, int32_t maximum)
+{
+    return FFX_MAXIMUM(minimum, FFX_MINIMUM(maximum, value));
+}
+
+// Float to uint conversion with the D3D semantics, NaN and negative values become 0
+static inline uint32_t floatToUint(float value)
+{
+    if (!(value > 0.0f)) {
+        return 0;
+    }
+    return value >= 4294967296.0f ? 0xffffffffu : uint32_t(value);
+}
+
+//
+// Luma preparation, see ffx_opticalflow_prepare_luma.h
+//
+
+static float luminanceToPerceivedLuminance(float luminance)
+{
+    const float perceivedLuminance = (luminance <= 216.0f / 24389.0f)
+        ? luminance * (24389.0f / 27.0f)
+        : powf(luminance, 1.0f / 3.0f) * 116.0f - 16.0f;
+    return perceivedLuminance * 0.01f;
+}
+
+static float linearFromPQ(float value)
+{
+    const float p = powf(value, 0.0126833f);
+    return powf(FFX_MAXIMUM(FFX_MINIMUM(p - 0.835938f, 1.0f), 0.0f) / (18.8516f - 18.6875f * p), 6.27739f);
+}
+
+static uint8_t prepareLuma(const float* rgb, int backbufferTransferFunction, FfxFloatCoords2D minMaxLuminance)
+{
+    float luminance = 0.0f;
+    if (backbufferTransferFunction == 0) {
+        luminance = 0.2126f * rgb[0] + 0.7152f * rgb[1] + 0.0722f * rgb[2];
+    }
+    else if (backbufferTransferFunction == 1) {
+        const float scale = 10000.0f / minMaxLuminance.y;
+        luminance = 0.2627f * linearFromPQ(rgb[0]) * scale + 0.678f * linearFromPQ(rgb[1]) * scale + 0.0593f * linearFromPQ(rgb[2]) * scale;
+        luminance = luminanceToPerceivedLuminance(luminance);
+    }
+    else if (backbufferTransferFunction == 2) {
+        const float offset = minMaxLuminance.x / 80.0f;
+        const float range  = (minMaxLuminance.y - minMaxLuminance.x) / 80.0f;
+        luminance = 0.2126f * ((rgb[0] - offset) / range) + 0.7152f * ((rgb[1] - offset) / range) + 0.0722f * ((rgb[2] - offset) / range);
+        luminance = luminanceToPerceivedLuminance(luminance);
+    }
+
+    // R8_UINT store of FfxUInt32(fY * 255)
+    return uint8_t(FFX_MINIMUM(floatToUint(luminance * 255.0f), 255u));
+}
+
+// SPD averages the float values of each quad without rounding in between, so every
+// level holds the truncated mean of the matching level 0 pixels.
+static void generateLumaPyramid(uint8_t* pyramid, uint32_t* sums, const OpticalflowCpuLayout& layout)
+{
+    const uint8_t*  level0 = pyramid + layout.lumaOffsets[0];
+    const uint32_t  width0 = layout.lumaSizes[0].width;
+
+    for (uint32_t level = 1; level < FFX_OPTICALFLOW_CPU_LEVEL_COUNT; ++level) {
+
+        const FfxDimensions2D size       = layout.lumaSizes[level];
+        const uint32_t        inputWidth = layout.lumaSizes[level - 1].width;
+        uint8_t*              output     = pyramid + layout.lumaOffsets[level];
+
+        // reduce in place, each sum is written before any later one reads its inputs
+        for (uint32_t y = 0; y < size.height; ++y) {
+            for (uint32_t x = 0; x < size.width; ++x) {
+
+                uint32_t sum;
+                if (level == 1) {
+                    const uint8_t* quad = level0 + (2 * y) * width0 + 2 * x;
+                    sum = quad[0] + quad[1] + quad[width0] + quad[width0 + 1];
+                }
+                else {
+                    const uint32_t* quad = sums + (2 * y) * inputWidth + 2 * x;
+                    sum = quad[0] + quad[1] + quad[inputWidth] + quad[inputWidth + 1];
+                }
+                sums[y * size.width + x] = sum;
+                output[y * size.width + x] = uint8_t(sum >> (2 * level));
+            }
+        }
+    }
+}
+
+//
+// Scene change detection, see ffx_opticalflow_generate_scd_histogram.h and ffx_opticalflow_compute_scd_divergence.h
+//
+
+static void generateSceneChangeHistograms(const OpticalflowCpuLuma& luma, uint32_t* histograms)
+{
+    const uint32_t width  = uint32_t(luma.width);
+    const uint32_t height = uint32_t(luma.height);
+    const uint32_t divX   = width / FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM;
+    const uint32_t divY   = height / FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM;
+
+    // the dispatch covers strips of 4 pixels with 32 wide groups, which may read past the strata
+    const uint32_t strataWidth = (width / 4) / FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM;
+    const uint32_t stripCount  = FFX_DIVIDE_ROUNDING_UP(strataWidth, 32u) * 32u;
+
+    memset(histograms, 0, FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS * sizeof(uint32_t));
+    for (uint32_t histogram = 0; histogram < FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT; ++histogram) {
+
+        uint32_t*      bins   = histograms + histogram * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS;
+        const uint32_t startX = divX * (histogram % FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM);
+        const uint32_t startY = divY * (histogram / FFX_OPTICALFLOW_CPU_HISTOGRAMS_PER_DIM);
+
+        for (uint32_t y = startY; y < startY + divY; ++y) {
+            const uint8_t* row = luma.pixels + y * width;
+            for (uint32_t strip = 0; strip < stripCount && 4 * strip < divX; ++strip) {
+                for (uint32_t i = 0; i < 4; ++i) {
+                    const uint32_t x = startX + 4 * strip + i;
+                    ++bins[x < width ? row[x] : 0];
+                }
+            }
+        }
+    }
+}
+
+// Same reduction order as the groupshared tree in the divergence shader
+static float reduceSum256(float* values)
+{
+    for (uint32_t stride = FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS / 2; stride > 0; stride >>= 1) {
+        for (uint32_t i = 0; i < stride; ++i) {
+            values[i] += values[i + stride];
+        }
+    }
+    return values[0];
+}
+
+static float computeSceneChangeValue(const uint32_t* histograms, float* previousHistograms)
+{
+    static const float kernel[] = { 0.0088122291f, 0.027143577f, 0.065114059f, 0.12164907f, 0.17699835f, 0.20056541f };
+    const int32_t      lastBin  = FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS - 1;
+
+    uint32_t divergence[FFX_OPTICALFLOW_CPU_HISTOGRAM_SHIFTS] = {};
+    float    centeredHistograms[FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT][FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+
+    for (uint32_t histogram = 0; histogram < FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT; ++histogram) {
+
+        const uint32_t* source   = histograms + histogram * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS;
+        const float*    previous = previousHistograms + histogram * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS;
+
+        float smoothed[FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+        for (int32_t bin = 0; bin <= lastBin; ++bin) {
+            float value = 0.0f;
+            for (int32_t tap = 0; tap < 11; ++tap) {
+                value += kernel[tap < 6 ? tap : 10 - tap] * float(source[clampInt(bin - 5 + tap, 0, lastBin)]);
+            }
+            smoothed[bin] = value + 1.0f;
+        }
+
+        for (int32_t shift = 0; shift < FFX_OPTICALFLOW_CPU_HISTOGRAM_SHIFTS; ++shift) {
+
+            // shift the histogram by -1, 0 or +1 bins and pad the vacated bin with 1
+            float filtered[FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+            for (int32_t bin = 0; bin <= lastBin; ++bin) {
+                const int32_t sourceBin = bin + 1 - shift;
+                filtered[bin] = (sourceBin < 0 || sourceBin > lastBin) ? 1.0f : smoothed[sourceBin];
+            }
+
+            float scratch[FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+            memcpy(scratch, filtered, sizeof(scratch));
+            const float total = reduceSum256(scratch);
+
+            float forward[FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+            float backward[FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+            for (int32_t bin = 0; bin <= lastBin; ++bin) {
+                filtered[bin] /= total;
+                forward[bin]  = filtered[bin] * logf(filtered[bin] / previous[bin]);
+                backward[bin] = previous[bin] * logf(previous[bin] / filtered[bin]);
+            }
+
+            const float result = 1.0f - expf(-(fabsf(reduceSum256(forward)) + fabsf(reduceSum256(backward))));
+            divergence[shift] += floatToUint((result / float(FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT)) * FFX_OPTICALFLOW_CPU_SCD_FACTOR);
+
+            if (shift == 1) {
+                memcpy(centeredHistograms[histogram], filtered, sizeof(filtered));
+            }
+        }
+    }
+
+    // every shift compares against the previous frame, so update it last
+    memcpy(previousHistograms, centeredHistograms, sizeof(centeredHistograms));
+
+    return float(FFX_MINIMUM(divergence[0], FFX_MINIMUM(divergence[1], divergence[2]))) / FFX_OPTICALFLOW_CPU_SCD_FACTOR;
+}
+
+//
+// Block matching, see ffx_opticalflow_compute_optical_flow_v5.h
+//
+
+// Copy a region of luma, clamping to the edges like LoadFirstImagePackedLuma and LoadSecondImagePackedLuma
+static void gatherLuma(const OpticalflowCpuLuma& luma, int32_t x0, int32_t y0, int32_t width, int32_t height, uint8_t* destination)
+{
+    const bool inside = x0 >= 0 && y0 >= 0 && x0 + width <= luma.width && y0 + height <= luma.height;
+    for (int32_t row = 0; row < height; ++row) {
+
+        const uint8_t* source = luma.pixels + clampInt(y0 + row, 0, luma.height - 1) * luma.width;
+        if (inside) {
+            memcpy(destination + row * width, source + x0, width);
+        }
+        else {
+            for (int32_t column = 0; column < width; ++column) {
+                destination[row * width + column] = source[clampInt(x0 + column, 0, luma.width - 1)];
+            }
+        }
+    }
+}
+
+static uint32_t blockSadScalar(const uint8_t* block, const uint8_t* candidate, uint32_t candidatePitch)
+{
+    uint32_t sad = 0;
+    for (uint32_t row = 0; row < FFX_OPTICALFLOW_CPU_BLOCK_SIZE; ++row) {
+        for (uint32_t column = 0; column < FFX_OPTICALFLOW_CPU_BLOCK_SIZE; ++column) {
+            const int32_t delta = int32_t(block[row * FFX_OPTICALFLOW_CPU_BLOCK_SIZE + column]) - int32_t(candidate[row * candidatePitch + column]);
+            sad += uint32_t(delta < 0 ? -delta : delta);
+        }
+    }
+    return sad;
+}
+
+#if FFX_OPTICALFLOW_CPU_SSE2
+// Two 8 pixel rows per psadbw, which is what msad4 does four lanes at a time on the GPU
+static uint32_t blockSadSse2(const uint8_t* block, const uint8_t* candidate, uint32_t candidatePitch)
+{
+    __m128i sum = _mm_setzero_si128();
+    for (uint32_t row = 0; row < FFX_OPTICALFLOW_CPU_BLOCK_SIZE; row += 2) {
+        const __m128i blockRows     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + row * FFX_OPTICALFLOW_CPU_BLOCK_SIZE));
+        const __m128i candidateRows = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(candidate + row * candidatePitch)),
+                                                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(candidate + (row + 1) * candidatePitch)));
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(blockRows, candidateRows));
+    }
+    return uint32_t(_mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8)));
+}
+#endif // #if FFX_OPTICALFLOW_CPU_SSE2
+
+typedef uint32_t (*BlockSadFunction)(const uint8_t* block, const uint8_t* candidate, uint32_t candidatePitch);
+
+// Favour the smallest displacement when SADs are equal (FFX_OPTICALFLOW_FIX_TOP_LEFT_BIAS)
+static inline uint32_t encodeSearchCoord(int32_t x, int32_t y)
+{
+    const uint32_t absX = uint32_t(x > FFX_OPTICALFLOW_CPU_SEARCH_RADIUS ? x - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS : FFX_OPTICALFLOW_CPU_SEARCH_RADIUS - x);
+    const uint32_t absY = uint32_t(y > FFX_OPTICALFLOW_CPU_SEARCH_RADIUS ? y - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS : FFX_OPTICALFLOW_CPU_SEARCH_RADIUS - y);
+    return (absY << 12) | (absX << 8) | (uint32_t(y) << 4) | uint32_t(x);
+}
+
+static void searchLevel(const OpticalflowCpuLuma& current, const OpticalflowCpuLuma& previous, FfxDimensions2D flowSize,
+                        uint32_t level, bool usePrediction, BlockSadFunction blockSad, OpticalflowCpuVector* flow)
+{
+    uint8_t block[FFX_OPTICALFLOW_CPU_BLOCK_SIZE * FFX_OPTICALFLOW_CPU_BLOCK_SIZE];
+    uint8_t window[FFX_OPTICALFLOW_CPU_SEARCH_WINDOW * FFX_OPTICALFLOW_CPU_SEARCH_WINDOW];
+
+    for (uint32_t blockY = 0; blockY < flowSize.height; ++blockY) {
+        for (uint32_t blockX = 0; blockX < flowSize.width; ++blockX) {
+
+            OpticalflowCpuVector& vector     = flow[blockY * flowSize.width + blockX];
+            const OpticalflowCpuVector prediction = usePrediction ? vector : OpticalflowCpuVector{ 0, 0 };
+            const int32_t              pixelX     = int32_t(blockX * FFX_OPTICALFLOW_CPU_BLOCK_SIZE);
+            const int32_t              pixelY     = int32_t(blockY * FFX_OPTICALFLOW_CPU_BLOCK_SIZE);
+
+            gatherLuma(current, pixelX, pixelY, FFX_OPTICALFLOW_CPU_BLOCK_SIZE, FFX_OPTICALFLOW_CPU_BLOCK_SIZE, block);
+            gatherLuma(previous,
+                       pixelX + prediction.x - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS,
+                       pixelY + prediction.y - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS,
+                       FFX_OPTICALFLOW_CPU_SEARCH_WINDOW, FFX_OPTICALFLOW_CPU_SEARCH_WINDOW, window);
+
+            uint32_t minSad = 0xffffffffu;
+            for (int32_t searchY = 0; searchY < 2 * FFX_OPTICALFLOW_CPU_SEARCH_RADIUS; ++searchY) {
+                for (int32_t searchX = 0; searchX < 2 * FFX_OPTICALFLOW_CPU_SEARCH_RADIUS; ++searchX) {
+                    const uint32_t sad = blockSad(block, window + searchY * FFX_OPTICALFLOW_CPU_SEARCH_WINDOW + searchX, FFX_OPTICALFLOW_CPU_SEARCH_WINDOW);
+                    minSad = FFX_MINIMUM(minSad, (sad << 16) | encodeSearchCoord(searchX, searchY));
+                }
+            }
+
+            vector.x = prediction.x + int32_t(minSad & 0xfu) - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS;
+            vector.y = prediction.y + int32_t((minSad >> 4) & 0xfu) - FFX_OPTICALFLOW_CPU_SEARCH_RADIUS;
+
+            // FFX_LOCAL_SEARCH_FALLBACK: keep static blocks static at full resolution
+            if (level == 0) {
+                gatherLuma(previous, pixelX, pixelY, FFX_OPTICALFLOW_CPU_BLOCK_SIZE, FFX_OPTICALFLOW_CPU_BLOCK_SIZE, window);
+                if (blockSad(block, window, FFX_OPTICALFLOW_CPU_BLOCK_SIZE) <= (minSad >> 16)) {
+                    vector = { 0, 0 };
+                }
+            }
+        }
+    }
+}
+
+//
+// Filter and scale, see ffx_opticalflow_filter_optical_flow_v5.h and ffx_opticalflow_scale_optical_flow_advanced_v5.h
+//
+
+static inline OpticalflowCpuVector loadVector(const OpticalflowCpuVector* flow, FfxDimensions2D flowSize, int32_t x, int32_t y)
+{
+    // out of bounds texture reads return 0
+    if (x < 0 || y < 0 || x >= int32_t(flowSize.width) || y >= int32_t(flowSize.height)) {
+        return { 0, 0 };
+    }
+    return flow[y * int32_t(flowSize.width) + x];
+}
+
+static void filterLevel(const OpticalflowCpuVector* input, FfxDimensions2D flowSize, OpticalflowCpuVector* output)
+{
+    for (int32_t y = 0; y < int32_t(flowSize.height); ++y) {
+        for (int32_t x = 0; x < int32_t(flowSize.width); ++x) {
+
+            OpticalflowCpuVector neighbours[9];
+            uint32_t             count = 0;
+            for (int32_t offsetX = -1; offsetX < 2; ++offsetX) {
+                for (int32_t offsetY = -1; offsetY < 2; ++offsetY) {
+                    neighbours[count++] = loadVector(input, flowSize, x + offsetX, y + offsetY);
+                }
+            }
+
+            // the vector closest to all the others, the lowest index on ties
+            uint32_t best = 0xffffffffu;
+            for (uint32_t i = 0; i < 9; ++i) {
+                uint32_t distance = 0;
+                for (uint32_t j = 0; j < 9; ++j) {
+                    const int32_t deltaX = neighbours[i].x - neighbours[j].x;
+                    const int32_t deltaY = neighbours[i].y - neighbours[j].y;
+                    distance += uint32_t(deltaX * deltaX + deltaY * deltaY);
+                }
+                best = FFX_MINIMUM(best, (distance << 4) | i);
+            }
+
+            output[y * int32_t(flowSize.width) + x] = neighbours[best & 0xfu];
+        }
+    }
+}
+
+static void scaleLevel(const OpticalflowCpuLuma& current, const OpticalflowCpuLuma& previous,
+                       const OpticalflowCpuVector* input, FfxDimensions2D flowSize,
+                       OpticalflowCpuVector* output, FfxDimensions2D nextFlowSize)
+{
+    // each next level block covers 4x4 pixels of this level
+    uint8_t block[4 * 4];
+    uint8_t candidate[4 * 4];
+
+    for (int32_t y = 0; y < int32_t(nextFlowSize.height); ++y) {
+        for (int32_t x = 0; x < int32_t(nextFlowSize.width); ++x) {
+
+            gatherLuma(current, x * 4, y * 4, 4, 4, block);
+
+            // pick between the four nearest coarse vectors the one matching best
+            uint32_t             bestSad    = 0xffffffffu;
+            OpticalflowCpuVector bestVector = { 0, 0 };
+            for (int32_t neighbour = 0; neighbour < 4; ++neighbour) {
+
+                const OpticalflowCpuVector vector = loadVector(input, flowSize,
+                                                               x / 2 + (neighbour % 2) - 1 + (x % 2),
+                                                               y / 2 + (neighbour / 2) - 1 + (y % 2));
+                gatherLuma(previous, x * 4 + vector.x, y * 4 + vector.y, 4, 4, candidate);
+
+                uint32_t sad = 0;
+                for (uint32_t i = 0; i < 16; ++i) {
+                    const int32_t delta = int32_t(block[i]) - int32_t(candidate[i]);
+                    sad += uint32_t(delta < 0 ? -delta : delta);
+                }
+                if (sad < bestSad) {
+                    bestSad    = sad;
+                    bestVector = vector;
+                }
+            }
+
+            output[y * int32_t(nextFlowSize.width) + x] = { bestVector.x * 2, bestVector.y * 2 };
+        }
+    }
+}
+
+size_t ffxOpticalflowCpuGetScratchMemorySize(FfxDimensions2D resolution)
+{
+    OpticalflowCpuLayout layout;
+    getCpuLayout(resolution, &layout);
+    return layout.totalSize;
+}
+
+FfxErrorCode ffxOpticalflowCpuDispatch(const FfxOpticalflowCpuDispatchDescription* pDispatchDescription)
+{
+    // check pointers are valid.
+    FFX_RETURN_ON_ERROR(pDispatchDescription, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->color, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->opticalFlowVector, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->opticalFlowSCD, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->scratchMemory, FFX_ERROR_INVALID_POINTER);
+
+    // every level of the luma pyramid needs at least one pixel
+    const FfxDimensions2D resolution = pDispatchDescription->resolution;
+    FFX_RETURN_ON_ERROR((resolution.width >> (FFX_OPTICALFLOW_CPU_LEVEL_COUNT - 1)) > 0, FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR((resolution.height >> (FFX_OPTICALFLOW_CPU_LEVEL_COUNT - 1)) > 0, FFX_ERROR_INVALID_ARGUMENT);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->colorRowPitch >= resolution.width * 4 * sizeof(float), FFX_ERROR_INVALID_ARGUMENT);
+
+    OpticalflowCpuLayout layout;
+    getCpuLayout(resolution, &layout);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->scratchMemorySize >= layout.totalSize, FFX_ERROR_INSUFFICIENT_MEMORY);
+
+    uint8_t*             scratch = static_cast<uint8_t*>(pDispatchDescription->scratchMemory);
+    OpticalflowCpuState* state   = reinterpret_cast<OpticalflowCpuState*>(scratch);
+
+    // the GPU clears the luma pyramids and scene change history on reset
+    if (pDispatchDescription->reset || state->resolution.width != resolution.width || state->resolution.height != resolution.height) {
+        memset(scratch, 0, layout.totalSize);
+        state->resolution = resolution;
+    }
+    else {
+        ++state->frameIndex;
+    }
+
+    uint8_t*              currentPyramid     = scratch + layout.lumaPyramidOffsets[state->currentInput];
+    const uint8_t*        previousPyramid    = scratch + layout.lumaPyramidOffsets[state->currentInput ^ 1];
+    uint32_t*             lumaSums           = reinterpret_cast<uint32_t*>(scratch + layout.lumaSumsOffset);
+    float*                previousHistograms = reinterpret_cast<float*>(scratch + layout.previousHistogramOffset);
+    OpticalflowCpuVector* searchFlow         = reinterpret_cast<OpticalflowCpuVector*>(scratch + layout.flowOffset[0]);
+    OpticalflowCpuVector* filteredFlow       = reinterpret_cast<OpticalflowCpuVector*>(scratch + layout.flowOffset[1]);
+
+    // Prepare luma
+    for (uint32_t y = 0; y < resolution.height; ++y) {
+        const float* row = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(pDispatchDescription->color) + size_t(y) * pDispatchDescription->colorRowPitch);
+        for (uint32_t x = 0; x < resolution.width; ++x) {
+            currentPyramid[y * resolution.width + x] = prepareLuma(row + 4 * x, pDispatchDescription->backbufferTransferFunction, pDispatchDescription->minMaxLuminance);
+        }
+    }
+
+    // Generate optical flow input pyramid
+    generateLumaPyramid(currentPyramid, lumaSums, layout);
+
+    OpticalflowCpuLuma currentLuma[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    OpticalflowCpuLuma previousLuma[FFX_OPTICALFLOW_CPU_LEVEL_COUNT];
+    for (uint32_t level = 0; level < FFX_OPTICALFLOW_CPU_LEVEL_COUNT; ++level) {
+        currentLuma[level]  = { currentPyramid + layout.lumaOffsets[level], int32_t(layout.lumaSizes[level].width), int32_t(layout.lumaSizes[level].height) };
+        previousLuma[level] = { previousPyramid + layout.lumaOffsets[level], int32_t(layout.lumaSizes[level].width), int32_t(layout.lumaSizes[level].height) };
+    }
+
+    // Generate SCD histogram and compute SCD divergence
+    uint32_t histograms[FFX_OPTICALFLOW_CPU_HISTOGRAM_COUNT * FFX_OPTICALFLOW_CPU_HISTOGRAM_BINS];
+    generateSceneChangeHistograms(currentLuma[0], histograms);
+
+    const float sceneChangeValue = computeSceneChangeValue(histograms, previousHistograms);
+    state->sceneChangeHistory = (state->sceneChangeHistory << 1) | (sceneChangeValue > FFX_OPTICALFLOW_CPU_SCD_THRESHOLD ? 1u : 0u);
+
+    memcpy(&pDispatchDescription->opticalFlowSCD[0], &sceneChangeValue, sizeof(uint32_t));
+    pDispatchDescription->opticalFlowSCD[1] = state->sceneChangeHistory;
+    pDispatchDescription->opticalFlowSCD[2] = 0;
+
+    const bool sceneChanged = state->frameIndex <= FFX_OPTICALFLOW_CPU_WARMUP_FRAMES || (state->sceneChangeHistory & 0xfu) != 0;
+
+    BlockSadFunction blockSad = blockSadScalar;
+#if FFX_OPTICALFLOW_CPU_SSE2
+    if (!pDispatchDescription->forceScalar) {
+        blockSad = blockSadSse2;
+    }
+#endif // #if FFX_OPTICALFLOW_CPU_SSE2
+
+    // Search, filter and scale from the coarsest level down
+    for (int32_t level = FFX_OPTICALFLOW_CPU_LEVEL_COUNT - 1; level >= 0; --level) {
+
+        const FfxDimensions2D flowSize = layout.flowSizes[level];
+        OpticalflowCpuVector* search   = searchFlow + layout.flowOffsets[level];
+        OpticalflowCpuVector* filtered = filteredFlow + layout.flowOffsets[level];
+
+        if (sceneChanged) {
+            memset(search, 0, size_t(flowSize.width) * flowSize.height * sizeof(OpticalflowCpuVector));
+        }
+        else {
+            searchLevel(currentLuma[level], previousLuma[level], flowSize, uint32_t(level), level != FFX_OPTICALFLOW_CPU_LEVEL_COUNT - 1, blockSad, search);
+        }
+
+        filterLevel(search, flowSize, filtered);
+
+        if (level > 0) {
+            OpticalflowCpuVector* nextSearch = searchFlow + layout.flowOffsets[level - 1];
+            if (sceneChanged) {
+                memset(nextSearch, 0, size_t(layout.flowSizes[level - 1].width) * layout.flowSizes[level - 1].height * sizeof(OpticalflowCpuVector));
+            }
+            else {
+                scaleLevel(currentLuma[level], previousLuma[level], filtered, flowSize, nextSearch, layout.flowSizes[level - 1]);
+            }
+        }
+    }
+
+    // R16G16_SINT output
+    const size_t blockCount = size_t(layout.flowSizes[0].width) * layout.flowSizes[0].height;
+    for (size_t i = 0; i < blockCount; ++i) {
+        pDispatchDescription->opticalFlowVector[2 * i + 0] = int16_t(filteredFlow[i].x);
+        pDispatchDescription->opticalFlowVector[2 * i + 1] = int16_t(filteredFlow[i].y);
+    }
+
+    state->currentInput ^= 1;
+
+    return FFX_OK;
+}
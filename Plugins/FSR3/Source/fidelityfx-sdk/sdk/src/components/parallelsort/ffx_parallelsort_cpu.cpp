@@ -0,0 +1,238 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <string.h>     // for memcpy
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <FidelityFX/host/ffx_parallelsort.h>
+#include "ffx_parallelsort_private.h"
+
+// Below this many keys per worker the cost of waking threads outweighs the work, so
+// the CPU sort uses fewer workers (a single worker for small inputs).
+#define FFX_PARALLELSORT_CPU_MIN_KEYS_PER_THREAD   (16384u)
+
+// Upper bound on workers so the per-worker histogram stays small.
+#define FFX_PARALLELSORT_CPU_MAX_THREADS           (64u)
+
+static uint32_t getCpuWorkerCount(uint32_t numKeys, uint32_t maxThreads)
+{
+    uint32_t threadCount = maxThreads;
+    if (threadCount == 0)
+    {
+        threadCount = static_cast<uint32_t>(std::thread::hardware_concurrency());
+    }
+    threadCount = FFX_MAXIMUM(FFX_MINIMUM(threadCount, FFX_PARALLELSORT_CPU_MAX_THREADS), 1u);
+
+    const uint32_t usefulThreadCount = FFX_DIVIDE_ROUNDING_UP(numKeys, FFX_PARALLELSORT_CPU_MIN_KEYS_PER_THREAD);
+    return FFX_MAXIMUM(FFX_MINIMUM(usefulThreadCount, threadCount), 1u);
+}
+
+// Reusable barrier used to separate the count, scan and scatter phases of each pass.
+class ParallelSortCpuBarrier
+{
+public:
+    explicit ParallelSortCpuBarrier(uint32_t count) : threadCount(count), waitingCount(0), generation(0) {}
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const uint32_t currentGeneration = generation;
+        if (++waitingCount == threadCount)
+        {
+            waitingCount = 0;
+            ++generation;
+            condition.notify_all();
+            return;
+        }
+        condition.wait(lock, [&] { return generation != currentGeneration; });
+    }
+
+private:
+    std::mutex              mutex;
+    std::condition_variable condition;
+    const uint32_t          threadCount;
+    uint32_t                waitingCount;
+    uint32_t                generation;
+};
+
+// State shared between all workers of a CPU sort
+typedef struct ParallelSortCpuJob
+{
+    uint32_t*               keys[2];
+    uint32_t*               payloads[2];
+    uint32_t*               histograms;         // FFX_PARALLELSORT_SORT_BIN_COUNT entries per worker, converted in place to scatter offsets
+    uint32_t                numKeys;
+    uint32_t                numWorkers;
+    bool                    skipPass;           // Set by worker 0 when every key shares the same digit for the current pass
+    ParallelSortCpuBarrier* barrier;
+} ParallelSortCpuJob;
+
+static void parallelSortCpuWorker(ParallelSortCpuJob* job, uint32_t workerIndex)
+{
+    const uint32_t keysPerWorker = FFX_DIVIDE_ROUNDING_UP(job->numKeys, job->numWorkers);
+    const uint32_t rangeBegin    = FFX_MINIMUM(workerIndex * keysPerWorker, job->numKeys);
+    const uint32_t rangeEnd      = FFX_MINIMUM(rangeBegin + keysPerWorker, job->numKeys);
+    const bool     hasPayload    = job->payloads[0] != nullptr;
+
+    uint32_t* localHistogram = job->histograms + workerIndex * FFX_PARALLELSORT_SORT_BIN_COUNT;
+    uint32_t  src = 0;
+
+    for (uint32_t shift = 0; shift < 32; shift += FFX_PARALLELSORT_SORT_BITS_PER_PASS)
+    {
+        const uint32_t* srcKeys = job->keys[src];
+
+        // Sum pass - count the occurrences of each digit in this worker's range
+        uint32_t counts[FFX_PARALLELSORT_SORT_BIN_COUNT] = {};
+        for (uint32_t i = rangeBegin; i < rangeEnd; ++i)
+        {
+            ++counts[(srcKeys[i] >> shift) & (FFX_PARALLELSORT_SORT_BIN_COUNT - 1)];
+        }
+        memcpy(localHistogram, counts, sizeof(counts));
+
+        job->barrier->wait();
+
+        // Reduce/scan pass - prefix the counts bin-major across workers into global offsets,
+        // which is the same ordering the GPU reduce, scan and scan-add passes produce
+        if (workerIndex == 0)
+        {
+            uint32_t offset = 0;
+            job->skipPass = false;
+            for (uint32_t bin = 0; bin < FFX_PARALLELSORT_SORT_BIN_COUNT; ++bin)
+            {
+                const uint32_t binStart = offset;
+                for (uint32_t worker = 0; worker < job->numWorkers; ++worker)
+                {
+                    uint32_t& entry = job->histograms[worker * FFX_PARALLELSORT_SORT_BIN_COUNT + bin];
+                    const uint32_t count = entry;
+                    entry = offset;
+                    offset += count;
+                }
+                job->skipPass |= (offset - binStart) == job->numKeys;
+            }
+        }
+
+        job->barrier->wait();
+
+        // A digit shared by all keys leaves the order untouched, so the scatter can be skipped
+        if (job->skipPass)
+        {
+            continue;
+        }
+
+        // Scatter pass - stable write of this worker's range to its global offsets
+        uint32_t* dstKeys = job->keys[src ^ 1];
+        memcpy(counts, localHistogram, sizeof(counts));
+        if (hasPayload)
+        {
+            const uint32_t* srcPayloads = job->payloads[src];
+            uint32_t*       dstPayloads = job->payloads[src ^ 1];
+            for (uint32_t i = rangeBegin; i < rangeEnd; ++i)
+            {
+                const uint32_t key = srcKeys[i];
+                const uint32_t dst = counts[(key >> shift) & (FFX_PARALLELSORT_SORT_BIN_COUNT - 1)]++;
+                dstKeys[dst]     = key;
+                dstPayloads[dst] = srcPayloads[i];
+            }
+        }
+        else
+        {
+            for (uint32_t i = rangeBegin; i < rangeEnd; ++i)
+            {
+                const uint32_t key = srcKeys[i];
+                dstKeys[counts[(key >> shift) & (FFX_PARALLELSORT_SORT_BIN_COUNT - 1)]++] = key;
+            }
+        }
+
+        job->barrier->wait();
+
+        // Swap
+        src ^= 1;
+    }
+
+    // Skipped passes can leave the result in the scratch buffers, copy our range back
+    if (src != 0 && rangeEnd > rangeBegin)
+    {
+        memcpy(job->keys[0] + rangeBegin, job->keys[1] + rangeBegin, (rangeEnd - rangeBegin) * sizeof(uint32_t));
+        if (hasPayload)
+        {
+            memcpy(job->payloads[0] + rangeBegin, job->payloads[1] + rangeBegin, (rangeEnd - rangeBegin) * sizeof(uint32_t));
+        }
+    }
+}
+
+size_t ffxParallelSortCpuGetScratchMemorySize(uint32_t maxEntries, uint32_t flags, uint32_t maxThreads)
+{
+    const size_t bufferCount = (flags & FFX_PARALLELSORT_PAYLOAD_SORT) ? 2 : 1;
+    const size_t workerCount = getCpuWorkerCount(maxEntries, maxThreads);
+    return (bufferCount * maxEntries + workerCount * FFX_PARALLELSORT_SORT_BIN_COUNT) * sizeof(uint32_t);
+}
+
+FfxErrorCode ffxParallelSortCpuDispatch(const FfxParallelSortCpuDispatchDescription* pDispatchDescription)
+{
+    // check pointers are valid.
+    FFX_RETURN_ON_ERROR(pDispatchDescription, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->keyBuffer || !pDispatchDescription->numKeysToSort, FFX_ERROR_INVALID_POINTER);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->scratchMemory || !pDispatchDescription->numKeysToSort, FFX_ERROR_INVALID_POINTER);
+
+    const bool hasPayload = (pDispatchDescription->flags & FFX_PARALLELSORT_PAYLOAD_SORT) != 0;
+    FFX_RETURN_ON_ERROR(!hasPayload || pDispatchDescription->payloadBuffer || !pDispatchDescription->numKeysToSort, FFX_ERROR_INVALID_POINTER);
+
+    const uint32_t numKeys = pDispatchDescription->numKeysToSort;
+    if (numKeys < 2)
+    {
+        return FFX_OK;
+    }
+
+    const size_t requiredScratchSize =
+        ffxParallelSortCpuGetScratchMemorySize(numKeys, pDispatchDescription->flags, pDispatchDescription->maxThreads);
+    FFX_RETURN_ON_ERROR(pDispatchDescription->scratchMemorySize >= requiredScratchSize, FFX_ERROR_INSUFFICIENT_MEMORY);
+
+    ParallelSortCpuJob job;
+    job.numKeys     = numKeys;
+    job.numWorkers  = getCpuWorkerCount(numKeys, pDispatchDescription->maxThreads);
+    job.skipPass    = false;
+    job.keys[0]     = pDispatchDescription->keyBuffer;
+    job.keys[1]     = static_cast<uint32_t*>(pDispatchDescription->scratchMemory);
+    job.payloads[0] = hasPayload ? pDispatchDescription->payloadBuffer : nullptr;
+    job.payloads[1] = hasPayload ? job.keys[1] + numKeys : nullptr;
+    job.histograms  = job.keys[1] + (hasPayload ? 2 : 1) * size_t(numKeys);
+
+    ParallelSortCpuBarrier barrier(job.numWorkers);
+    job.barrier = &barrier;
+
+    // The calling thread acts as worker 0
+    std::thread workers[FFX_PARALLELSORT_CPU_MAX_THREADS];
+    for (uint32_t i = 1; i < job.numWorkers; ++i)
+    {
+        workers[i] = std::thread(parallelSortCpuWorker, &job, i);
+    }
+    parallelSortCpuWorker(&job, 0);
+    for (uint32_t i = 1; i < job.numWorkers; ++i)
+    {
+        workers[i].join();
+    }
+
+    return FFX_OK;
+}
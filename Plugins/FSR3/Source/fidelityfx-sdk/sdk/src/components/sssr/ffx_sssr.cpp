@@ -28,13 +28,52 @@ using namespace std;
 #include <FidelityFX/host/ffx_sssr.h>
 #include <FidelityFX/gpu/sssr/ffx_sssr_resources.h>
 #include <ffx_object_management.h>
+#include <ffx_binding_lookup.h>
 
 #include <FidelityFX/host/ffx_denoiser.h>
 #include "ffx_sssr_private.h"
 
+#include <mutex>
+
 namespace _noiseBuffers
 {
-#include "samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_2d2d2d2d_1spp.cpp"
+#include "ffx_sssr_blue_noise.h"
+}
+
+// Blue noise tables widened to 32 bits for upload, one copy shared by all live SSSR contexts
+typedef struct SssrBlueNoiseTables
+{
+    uint32_t sobol[FFX_ARRAY_ELEMENTS(_noiseBuffers::sobol_256spp_256d)];
+    uint32_t scramblingTile[FFX_ARRAY_ELEMENTS(_noiseBuffers::scramblingTile)];
+} SssrBlueNoiseTables;
+
+static std::mutex           s_BlueNoiseTablesMutex;
+static SssrBlueNoiseTables* s_BlueNoiseTables         = nullptr;
+static uint32_t             s_BlueNoiseTablesRefCount = 0;
+
+static const SssrBlueNoiseTables* acquireBlueNoiseTables()
+{
+    std::lock_guard<std::mutex> lock(s_BlueNoiseTablesMutex);
+    if (s_BlueNoiseTablesRefCount++ == 0)
+    {
+        s_BlueNoiseTables = new SssrBlueNoiseTables;
+        for (size_t i = 0; i < FFX_ARRAY_ELEMENTS(s_BlueNoiseTables->sobol); ++i)
+            s_BlueNoiseTables->sobol[i] = _noiseBuffers::sobol_256spp_256d[i];
+        for (size_t i = 0; i < FFX_ARRAY_ELEMENTS(s_BlueNoiseTables->scramblingTile); ++i)
+            s_BlueNoiseTables->scramblingTile[i] = _noiseBuffers::scramblingTile[i];
+    }
+    return s_BlueNoiseTables;
+}
+
+static void releaseBlueNoiseTables()
+{
+    std::lock_guard<std::mutex> lock(s_BlueNoiseTablesMutex);
+    FFX_ASSERT(s_BlueNoiseTablesRefCount > 0);
+    if (--s_BlueNoiseTablesRefCount == 0)
+    {
+        delete s_BlueNoiseTables;
+        s_BlueNoiseTables = nullptr;
+    }
 }
 
 // lists to map shader resource bindpoint name to resource identifier
@@ -93,62 +132,24 @@ template<typename T> inline T DivideRoundingUp(T a, T b)
 
 static FfxErrorCode patchResourceBindings(FfxPipelineState* inoutPipeline)
 {
-    for (uint32_t srvIndex = 0; srvIndex < inoutPipeline->srvTextureCount; ++srvIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_ARRAY_ELEMENTS(srvTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(srvTextureBindingTable[mapIndex].name, inoutPipeline->srvTextureBindings[srvIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_ARRAY_ELEMENTS(srvTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    // binding name lookups are built once per table on first use
+    static const FfxBindingLookup srvTextureBindingLookup(srvTextureBindingTable);
+    static const FfxBindingLookup uavTextureBindingLookup(uavTextureBindingTable);
+    static const FfxBindingLookup uavBufferBindingLookup(uavBufferBindingTable);
+    static const FfxBindingLookup constantBufferBindingLookup(constantBufferBindingTable);
 
-        inoutPipeline->srvTextureBindings[srvIndex].resourceIdentifier = srvTextureBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavTextureCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_ARRAY_ELEMENTS(uavTextureBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavTextureBindingTable[mapIndex].name, inoutPipeline->uavTextureBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_ARRAY_ELEMENTS(uavTextureBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!srvTextureBindingLookup.resolve(inoutPipeline->srvTextureBindings, inoutPipeline->srvTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->uavTextureBindings[uavIndex].resourceIdentifier = uavTextureBindingTable[mapIndex].index;
-    }
+    if (!uavTextureBindingLookup.resolve(inoutPipeline->uavTextureBindings, inoutPipeline->uavTextureCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     // Buffer uavs
-    for (uint32_t uavIndex = 0; uavIndex < inoutPipeline->uavBufferCount; ++uavIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_ARRAY_ELEMENTS(uavBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(uavBufferBindingTable[mapIndex].name, inoutPipeline->uavBufferBindings[uavIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_ARRAY_ELEMENTS(uavBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
-
-        inoutPipeline->uavBufferBindings[uavIndex].resourceIdentifier = uavBufferBindingTable[mapIndex].index;
-    }
-
-    for (uint32_t cbIndex = 0; cbIndex < inoutPipeline->constCount; ++cbIndex)
-    {
-        int32_t mapIndex = 0;
-        for (mapIndex = 0; mapIndex < FFX_ARRAY_ELEMENTS(constantBufferBindingTable); ++mapIndex)
-        {
-            if (0 == wcscmp(constantBufferBindingTable[mapIndex].name, inoutPipeline->constantBufferBindings[cbIndex].name))
-                break;
-        }
-        if (mapIndex == FFX_ARRAY_ELEMENTS(constantBufferBindingTable))
-            return FFX_ERROR_INVALID_ARGUMENT;
+    if (!uavBufferBindingLookup.resolve(inoutPipeline->uavBufferBindings, inoutPipeline->uavBufferCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
-        inoutPipeline->constantBufferBindings[cbIndex].resourceIdentifier = constantBufferBindingTable[mapIndex].index;
-    }
+    if (!constantBufferBindingLookup.resolve(inoutPipeline->constantBufferBindings, inoutPipeline->constCount))
+        return FFX_ERROR_INVALID_ARGUMENT;
 
     return FFX_OK;
 }
@@ -266,6 +267,8 @@ static FfxErrorCode sssrCreate(FfxSssrContext_Private* context, const FfxSssrCon
 
     const uint32_t elementSize = 4;
     const uint32_t numPixels = contextDescription->renderSize.width * contextDescription->renderSize.height;
+    const SssrBlueNoiseTables* blueNoiseTables = acquireBlueNoiseTables();
+    context->blueNoiseTablesAcquired = true;
     uint32_t depthHierarchyMipCount = (uint32_t)ceil(log2(max(contextDescription->renderSize.width, contextDescription->renderSize.height)));
     depthHierarchyMipCount = min(7u, depthHierarchyMipCount);  // We generate 6 mips from the input depth buffer and keep a copy of it at mip 0 
 
@@ -390,7 +393,7 @@ static FfxErrorCode sssrCreate(FfxSssrContext_Private* context, const FfxSssrCon
          256,
          1,
          FFX_RESOURCE_FLAGS_NONE,
-         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(_noiseBuffers::sobol_256spp_256d), (void*)_noiseBuffers::sobol_256spp_256d}},
+         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(blueNoiseTables->sobol), (void*)blueNoiseTables->sobol}},
 
         {FFX_SSSR_RESOURCE_IDENTIFIER_SCRAMBLING_TILE_BUFFER,
          L"SSSR_ScramblingTileBuffer",
@@ -401,7 +404,7 @@ static FfxErrorCode sssrCreate(FfxSssrContext_Private* context, const FfxSssrCon
          128 * 2,
          1,
          FFX_RESOURCE_FLAGS_NONE,
-         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(_noiseBuffers::scramblingTile), (void*)_noiseBuffers::scramblingTile}},
+         {FFX_RESOURCE_INIT_DATA_TYPE_BUFFER, sizeof(blueNoiseTables->scramblingTile), (void*)blueNoiseTables->scramblingTile}},
 
         {FFX_SSSR_RESOURCE_IDENTIFIER_BLUE_NOISE_TEXTURE,
          L"SSSR_BlueNoiseTexture",
@@ -507,6 +510,12 @@ static FfxErrorCode sssrRelease(FfxSssrContext_Private* context)
 
     FFX_ASSERT(ffxDenoiserContextDestroy(&context->denoiserContext) == FFX_OK);
 
+    if (context->blueNoiseTablesAcquired)
+    {
+        releaseBlueNoiseTables();
+        context->blueNoiseTablesAcquired = false;
+    }
+
     // Destroy the context
     context->contextDescription.backendInterface.fpDestroyBackendContext(&context->contextDescription.backendInterface, context->effectContextId);
 
@@ -82,4 +82,5 @@ typedef struct FfxSssrContext_Private
 
     bool        refreshPipelineStates;
     uint32_t    resourceFrameIndex;
+    bool        blueNoiseTablesAcquired;
 } FfxSssrContext_Private;
@@ -0,0 +1,326 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_assert.h>
+#include "ffx_barrier_planner.h"
+
+static FfxBarrierResourceState* getResourceState(FfxBarrierPlanner* planner, uint32_t resourceIndex)
+{
+    return reinterpret_cast<FfxBarrierResourceState*>(planner->resources + resourceIndex * planner->resourceStride);
+}
+
+static void countBarrier(FfxBarrierPlanner* planner, uint64_t FfxBarrierPlannerStatistics::*counter)
+{
+    if (planner->statistics) {
+        ++(planner->statistics->*counter);
+    }
+}
+
+// Find a plain (non-split) barrier already queued for a resource
+static FfxBarrierRecord* findQueuedBarrier(FfxBarrierPlanner* planner, uint32_t resourceIndex)
+{
+    for (uint32_t i = 0; i < planner->barrierCount; ++i) {
+
+        FfxBarrierRecord* barrier = &planner->barriers[i];
+        if (barrier->flags == FFX_BARRIER_RECORD_FLAG_NONE && barrier->type != FFX_BARRIER_RECORD_ALIASING && barrier->resourceIndex == resourceIndex) {
+            return barrier;
+        }
+    }
+
+    return nullptr;
+}
+
+static FfxBarrierRecord* allocateBarrier(FfxBarrierPlanner* planner, void* commandList)
+{
+    if (planner->barrierCount == FFX_MAX_BARRIERS) {
+        ffxBarrierPlannerFlush(planner, commandList);
+    }
+
+    FfxBarrierRecord* barrier = &planner->barriers[planner->barrierCount++];
+    barrier->flags            = FFX_BARRIER_RECORD_FLAG_NONE;
+    return barrier;
+}
+
+// Issue the end-only half of a split barrier begun by ffxBarrierPlannerBeginSplitBarriers
+static void endSplitBarrier(FfxBarrierPlanner* planner, void* commandList, uint32_t resourceIndex)
+{
+    FfxBarrierResourceState* resource = getResourceState(planner, resourceIndex);
+    FFX_ASSERT(resource->splitBarrierPending);
+
+    FfxBarrierRecord* barrier = allocateBarrier(planner, commandList);
+    barrier->type             = FFX_BARRIER_RECORD_TRANSITION;
+    barrier->flags            = FFX_BARRIER_RECORD_FLAG_END_ONLY;
+    barrier->resourceIndex    = resourceIndex;
+    barrier->stateBefore      = resource->splitBarrierStateBefore;
+    barrier->stateAfter       = resource->currentState;
+
+    resource->splitBarrierPending = false;
+
+    for (uint32_t i = 0; i < planner->splitBarrierCount; ++i) {
+        if (planner->splitBarrierResources[i] == resourceIndex) {
+            planner->splitBarrierResources[i] = planner->splitBarrierResources[--planner->splitBarrierCount];
+            break;
+        }
+    }
+}
+
+void ffxBarrierPlannerInit(FfxBarrierPlanner* planner, FfxBarrierResourceState* resources, size_t resourceStride, FfxBarrierFlushFunc flush, void* flushContext)
+{
+    FFX_ASSERT(planner && resources && flush);
+
+    planner->resources         = reinterpret_cast<uint8_t*>(resources);
+    planner->resourceStride    = resourceStride;
+    planner->flush             = flush;
+    planner->flushContext      = flushContext;
+    planner->barrierCount      = 0;
+    planner->splitBarrierCount = 0;
+    planner->statistics        = nullptr;
+}
+
+void ffxBarrierResourceStateReset(FfxBarrierResourceState* resource, FfxResourceStates state)
+{
+    FFX_ASSERT(resource);
+
+    resource->currentState            = state;
+    resource->splitBarrierStateBefore = state;
+    resource->splitBarrierPending     = false;
+    resource->uavAccessPending        = true;
+}
+
+void ffxBarrierPlannerTransition(FfxBarrierPlanner* planner, void* commandList, uint32_t resourceIndex, FfxResourceStates newState)
+{
+    FFX_ASSERT(planner);
+
+    FfxBarrierResourceState* resource = getResourceState(planner, resourceIndex);
+
+    // complete any split transition begun after the resource was last written
+    if (resource->splitBarrierPending) {
+        endSplitBarrier(planner, commandList, resourceIndex);
+    }
+
+    if ((resource->currentState & newState) != newState) {
+
+        // fold into a barrier already queued for this resource rather than chaining transitions
+        FfxBarrierRecord* queued = findQueuedBarrier(planner, resourceIndex);
+        if (queued && queued->type == FFX_BARRIER_RECORD_TRANSITION) {
+
+            queued->stateAfter = newState;
+            countBarrier(planner, &FfxBarrierPlannerStatistics::mergedBarriers);
+
+            // the merged transition is a no-op, drop it
+            if (queued->stateBefore == queued->stateAfter) {
+                *queued = planner->barriers[--planner->barrierCount];
+            }
+        }
+        else {
+
+            // a transition out of UAV state also waits on prior UAV accesses, so it replaces a queued UAV barrier
+            if (queued) {
+                countBarrier(planner, &FfxBarrierPlannerStatistics::mergedBarriers);
+            }
+            else {
+                queued = allocateBarrier(planner, commandList);
+            }
+
+            queued->type          = FFX_BARRIER_RECORD_TRANSITION;
+            queued->resourceIndex = resourceIndex;
+            queued->stateBefore   = resource->currentState;
+            queued->stateAfter    = newState;
+            countBarrier(planner, &FfxBarrierPlannerStatistics::transitionBarriers);
+        }
+
+        resource->currentState     = newState;
+        resource->uavAccessPending = false;
+    }
+    else if (newState == FFX_RESOURCE_STATE_UNORDERED_ACCESS) {
+
+        if (!resource->uavAccessPending) {
+            // nothing has touched the resource as a UAV since its last barrier
+            countBarrier(planner, &FfxBarrierPlannerStatistics::skippedUavBarriers);
+        }
+        else if (findQueuedBarrier(planner, resourceIndex)) {
+            // e.g. several mips of the same texture bound in one job
+            countBarrier(planner, &FfxBarrierPlannerStatistics::mergedBarriers);
+        }
+        else {
+            FfxBarrierRecord* barrier = allocateBarrier(planner, commandList);
+            barrier->type             = FFX_BARRIER_RECORD_UAV;
+            barrier->resourceIndex    = resourceIndex;
+            barrier->stateBefore      = newState;
+            barrier->stateAfter       = newState;
+            countBarrier(planner, &FfxBarrierPlannerStatistics::uavBarriers);
+        }
+
+        resource->uavAccessPending = false;
+    }
+}
+
+void ffxBarrierPlannerAliasing(FfxBarrierPlanner* planner, void* commandList)
+{
+    FFX_ASSERT(planner);
+
+    FfxBarrierRecord* barrier = allocateBarrier(planner, commandList);
+    barrier->type             = FFX_BARRIER_RECORD_ALIASING;
+    barrier->resourceIndex    = 0;
+    barrier->stateBefore      = FFX_RESOURCE_STATE_COMMON;
+    barrier->stateAfter       = FFX_RESOURCE_STATE_COMMON;
+}
+
+void ffxBarrierPlannerMarkUavAccess(FfxBarrierPlanner* planner, uint32_t resourceIndex)
+{
+    FFX_ASSERT(planner);
+
+    if (resourceIndex) {
+        getResourceState(planner, resourceIndex)->uavAccessPending = true;
+    }
+}
+
+// Returns the state a job will request for a resource (mirroring the transitions the backends queue for each job type),
+// 0 if the job does not touch the resource, or ~0u if the job requests several different states for it.
+static uint32_t getJobResourceState(const FfxGpuJobDescription* job, uint32_t resourceIndex)
+{
+    uint32_t state = 0;
+    auto use = [&](uint32_t index, FfxResourceStates requested) {
+        if (index == resourceIndex) {
+            state = (state == 0 || state == uint32_t(requested)) ? uint32_t(requested) : ~0u;
+        }
+    };
+
+    switch (job->jobType) {
+
+    case FFX_GPU_JOB_COMPUTE: {
+
+        const FfxComputeJobDescription& compute = job->computeJobDescriptor;
+        for (uint32_t i = 0; i < compute.pipeline.uavTextureCount; ++i) {
+            use(compute.uavTextures[i].resource.internalIndex, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        }
+        for (uint32_t i = 0; i < compute.pipeline.uavBufferCount; ++i) {
+            use(compute.uavBuffers[i].resource.internalIndex, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        }
+        for (uint32_t i = 0; i < compute.pipeline.srvTextureCount && compute.srvTextures[i].resource.internalIndex; ++i) {
+            use(compute.srvTextures[i].resource.internalIndex, FFX_RESOURCE_STATE_COMPUTE_READ);
+        }
+        for (uint32_t i = 0; i < compute.pipeline.srvBufferCount; ++i) {
+            use(compute.srvBuffers[i].resource.internalIndex, FFX_RESOURCE_STATE_COMPUTE_READ);
+        }
+        if (compute.pipeline.cmdSignature) {
+            use(compute.cmdArgument.internalIndex, FFX_RESOURCE_STATE_INDIRECT_ARGUMENT);
+        }
+        break;
+    }
+    case FFX_GPU_JOB_COPY:
+        use(job->copyJobDescriptor.src.internalIndex, FFX_RESOURCE_STATE_COPY_SRC);
+        use(job->copyJobDescriptor.dst.internalIndex, FFX_RESOURCE_STATE_COPY_DEST);
+        break;
+    case FFX_GPU_JOB_CLEAR_FLOAT:
+        use(job->clearJobDescriptor.target.internalIndex, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        break;
+    case FFX_GPU_JOB_BARRIER:
+        use(job->barrierDescriptor.resource.internalIndex, job->barrierDescriptor.newState);
+        break;
+    case FFX_GPU_JOB_DISCARD:
+        use(job->discardJobDescriptor.target.internalIndex, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        break;
+    default:
+        break;
+    }
+
+    return state;
+}
+
+void ffxBarrierPlannerBeginSplitBarriers(FfxBarrierPlanner* planner, void* commandList, const FfxGpuJobDescription* jobs, uint32_t jobCount, uint32_t jobIndex)
+{
+    FFX_ASSERT(planner && jobs && jobIndex < jobCount);
+
+    const FfxComputeJobDescription& compute = jobs[jobIndex].computeJobDescriptor;
+
+    auto tryBegin = [&](uint32_t resourceIndex) {
+
+        FfxBarrierResourceState* resource = getResourceState(planner, resourceIndex);
+        if (resourceIndex == 0 || resource->splitBarrierPending || resource->currentState != FFX_RESOURCE_STATE_UNORDERED_ACCESS) {
+            return;
+        }
+
+        // find the next job touching the resource, it must not be the very next job or there is nothing to overlap with
+        uint32_t nextJobIndex = jobIndex + 1;
+        uint32_t nextState    = 0;
+        while (nextJobIndex < jobCount && !(nextState = getJobResourceState(&jobs[nextJobIndex], resourceIndex))) {
+            ++nextJobIndex;
+        }
+
+        if (nextState != FFX_RESOURCE_STATE_COMPUTE_READ || nextJobIndex == jobIndex + 1 || planner->splitBarrierCount >= FFX_MAX_BARRIERS) {
+            return;
+        }
+
+        FfxBarrierRecord* barrier = allocateBarrier(planner, commandList);
+        barrier->type             = FFX_BARRIER_RECORD_TRANSITION;
+        barrier->flags            = FFX_BARRIER_RECORD_FLAG_BEGIN_ONLY;
+        barrier->resourceIndex    = resourceIndex;
+        barrier->stateBefore      = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+        barrier->stateAfter       = FFX_RESOURCE_STATE_COMPUTE_READ;
+        countBarrier(planner, &FfxBarrierPlannerStatistics::splitBarriers);
+
+        resource->splitBarrierStateBefore = FFX_RESOURCE_STATE_UNORDERED_ACCESS;
+        resource->currentState            = FFX_RESOURCE_STATE_COMPUTE_READ;
+        resource->splitBarrierPending     = true;
+        resource->uavAccessPending        = false;
+        planner->splitBarrierResources[planner->splitBarrierCount++] = resourceIndex;
+    };
+
+    for (uint32_t i = 0; i < compute.pipeline.uavTextureCount; ++i) {
+        tryBegin(compute.uavTextures[i].resource.internalIndex);
+    }
+    for (uint32_t i = 0; i < compute.pipeline.uavBufferCount; ++i) {
+        tryBegin(compute.uavBuffers[i].resource.internalIndex);
+    }
+
+    ffxBarrierPlannerFlush(planner, commandList);
+}
+
+void ffxBarrierPlannerEndSplitBarriers(FfxBarrierPlanner* planner, void* commandList)
+{
+    FFX_ASSERT(planner);
+
+    while (planner->splitBarrierCount) {
+        endSplitBarrier(planner, commandList, planner->splitBarrierResources[0]);
+    }
+    ffxBarrierPlannerFlush(planner, commandList);
+}
+
+void ffxBarrierPlannerFlush(FfxBarrierPlanner* planner, void* commandList)
+{
+    FFX_ASSERT(planner);
+
+    if (planner->barrierCount > 0) {
+
+        planner->flush(planner->flushContext, commandList, planner->barriers, planner->barrierCount);
+        planner->barrierCount = 0;
+        countBarrier(planner, &FfxBarrierPlannerStatistics::flushCount);
+    }
+}
+
+void ffxBarrierPlannerReset(FfxBarrierPlanner* planner)
+{
+    FFX_ASSERT(planner);
+
+    planner->barrierCount = 0;
+}
@@ -0,0 +1,129 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_interface.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// Kind of a queued barrier
+typedef enum FfxBarrierRecordType {
+    FFX_BARRIER_RECORD_TRANSITION,
+    FFX_BARRIER_RECORD_UAV,
+    FFX_BARRIER_RECORD_ALIASING,            // Aliasing barrier covering every placed resource, resourceIndex is unused
+} FfxBarrierRecordType;
+
+// Split transition halves, plain transitions have neither
+typedef enum FfxBarrierRecordFlags {
+    FFX_BARRIER_RECORD_FLAG_NONE       = 0,
+    FFX_BARRIER_RECORD_FLAG_BEGIN_ONLY = (1 << 0),
+    FFX_BARRIER_RECORD_FLAG_END_ONLY   = (1 << 1),
+} FfxBarrierRecordFlags;
+
+// One barrier as the backend has to issue it
+typedef struct FfxBarrierRecord {
+    FfxBarrierRecordType    type;
+    uint32_t                flags;              // FfxBarrierRecordFlags
+    uint32_t                resourceIndex;      // Backend internal index of the resource
+    FfxResourceStates       stateBefore;
+    FfxResourceStates       stateAfter;
+} FfxBarrierRecord;
+
+// Barrier tracking of one resource, embedded in the backend resource records
+typedef struct FfxBarrierResourceState {
+    FfxResourceStates       currentState;
+    FfxResourceStates       splitBarrierStateBefore;    // State the in-flight split barrier transitions from
+    bool                    splitBarrierPending;        // A begin-only transition to currentState has been issued
+    bool                    uavAccessPending;           // Accessed as a UAV since the last barrier on the resource
+} FfxBarrierResourceState;
+
+// Counters of the barriers a planner emitted and avoided
+typedef struct FfxBarrierPlannerStatistics {
+    uint64_t    transitionBarriers;         // Full transition barriers emitted.
+    uint64_t    splitBarriers;              // Split (begin-only + end-only) transition pairs emitted.
+    uint64_t    uavBarriers;                // UAV barriers emitted.
+    uint64_t    mergedBarriers;             // Barriers merged into (or dropped in favour of) a barrier already queued for the same resource.
+    uint64_t    skippedUavBarriers;         // UAV barriers dropped because the resource was not accessed as a UAV since its last barrier.
+    uint64_t    flushCount;                 // Flushes handed to the backend.
+} FfxBarrierPlannerStatistics;
+
+// Issues the queued barriers on commandList, the records are only valid during the call
+typedef void (*FfxBarrierFlushFunc)(void* flushContext, void* commandList, const FfxBarrierRecord* barriers, uint32_t barrierCount);
+
+// Planner merging and eliding the resource barriers of a batch of GPU jobs before the backend issues them.
+//
+// - A transition of a resource with a barrier already queued is folded into the queued one, and
+//   dropped when the folded transition is a no-op.
+// - UAV barriers are only queued when the resource was accessed as a UAV since its last barrier,
+//   and only once per flush.
+// - A UAV written by a compute job whose next consumer is a compute read two or more jobs later
+//   gets a begin-only transition after the job, and the end-only half at its consumer.
+//
+// The planner does not touch any API objects: resources are backend internal indices, their tracking
+// state lives in the backend resource records (found through resources and resourceStride), and
+// barriers leave the planner as FfxBarrierRecord through the flush function. At most FFX_MAX_BARRIERS
+// barriers are queued, a full queue is flushed before queuing more.
+typedef struct FfxBarrierPlanner {
+    uint8_t*                        resources;
+    size_t                          resourceStride;
+    FfxBarrierFlushFunc             flush;
+    void*                           flushContext;
+
+    FfxBarrierRecord                barriers[FFX_MAX_BARRIERS];
+    uint32_t                        barrierCount;
+
+    // Resources with a split barrier begun but not yet ended
+    uint32_t                        splitBarrierResources[FFX_MAX_BARRIERS];
+    uint32_t                        splitBarrierCount;
+
+    // Statistics the barriers are counted in, may be NULL
+    FfxBarrierPlannerStatistics*    statistics;
+} FfxBarrierPlanner;
+
+// Initialize an empty planner. The tracking state of resource i is at resources + i * resourceStride.
+void ffxBarrierPlannerInit(FfxBarrierPlanner* planner, FfxBarrierResourceState* resources, size_t resourceStride, FfxBarrierFlushFunc flush, void* flushContext);
+
+// Start tracking a resource in state, e.g. when it is created or registered. It counts as accessed as a UAV.
+void ffxBarrierResourceStateReset(FfxBarrierResourceState* resource, FfxResourceStates state);
+
+// Queue the barriers moving a resource to newState, ending a split barrier in flight on it first.
+void ffxBarrierPlannerTransition(FfxBarrierPlanner* planner, void* commandList, uint32_t resourceIndex, FfxResourceStates newState);
+
+// Queue an aliasing barrier covering all placed resources.
+void ffxBarrierPlannerAliasing(FfxBarrierPlanner* planner, void* commandList);
+
+// Record that a job accessed a resource as a UAV, so its next UAV use needs a UAV barrier.
+void ffxBarrierPlannerMarkUavAccess(FfxBarrierPlanner* planner, uint32_t resourceIndex);
+
+// After compute job jobIndex of jobs, begin transitioning the UAVs it wrote towards their next consumer, then flush.
+void ffxBarrierPlannerBeginSplitBarriers(FfxBarrierPlanner* planner, void* commandList, const FfxGpuJobDescription* jobs, uint32_t jobCount, uint32_t jobIndex);
+
+// End every split barrier still in flight, e.g. whose consumer was never reached, then flush.
+void ffxBarrierPlannerEndSplitBarriers(FfxBarrierPlanner* planner, void* commandList);
+
+// Hand the queued barriers to the flush function.
+void ffxBarrierPlannerFlush(FfxBarrierPlanner* planner, void* commandList);
+
+// Drop the queued barriers without issuing them.
+void ffxBarrierPlannerReset(FfxBarrierPlanner* planner);
@@ -0,0 +1,101 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <stdint.h>
+#include <wchar.h>
+#include <algorithm>
+#include <vector>
+#include <FidelityFX/host/ffx_types.h>
+
+// Name lookup over an effect's static table mapping shader binding names to resource identifiers.
+//
+// Effects resolve every SRV, UAV and constant buffer binding of every pipeline against these tables
+// when a context is created. Building the lookup once per table (as a function-local static) turns
+// each resolution into a binary search over precomputed name hashes instead of a linear wcscmp scan.
+class FfxBindingLookup
+{
+public:
+    template<typename TBinding, size_t N>
+    explicit FfxBindingLookup(const TBinding (&table)[N])
+    {
+        entries.reserve(N);
+        for (size_t i = 0; i < N; ++i)
+        {
+            Entry entry = { hashName(table[i].name), table[i].index, table[i].name };
+            entries.push_back(entry);
+        }
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+    }
+
+    // Look up the resource identifier of a binding name, returns false if the name is not in the table.
+    bool find(const wchar_t* name, uint32_t* outIndex) const
+    {
+        const uint32_t hash = hashName(name);
+        auto it = std::lower_bound(entries.begin(), entries.end(), hash, [](const Entry& entry, uint32_t value) { return entry.hash < value; });
+        for (; it != entries.end() && it->hash == hash; ++it)
+        {
+            if (0 == wcscmp(it->name, name))
+            {
+                *outIndex = it->index;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Set the resource identifier of each binding, offset by its array index when addArrayIndex is set.
+    // Returns false if any binding name is not in the table.
+    bool resolve(FfxResourceBinding* bindings, uint32_t bindingCount, bool addArrayIndex = false) const
+    {
+        for (uint32_t i = 0; i < bindingCount; ++i)
+        {
+            uint32_t index = 0;
+            if (!find(bindings[i].name, &index))
+                return false;
+
+            bindings[i].resourceIdentifier = index + (addArrayIndex ? bindings[i].arrayIndex : 0);
+        }
+        return true;
+    }
+
+private:
+    struct Entry
+    {
+        uint32_t       hash;
+        uint32_t       index;
+        const wchar_t* name;
+    };
+
+    // 32-bit FNV-1a over the UTF-16/32 code units
+    static uint32_t hashName(const wchar_t* name)
+    {
+        uint32_t hash = 2166136261u;
+        for (; *name; ++name)
+            hash = (hash ^ uint32_t(*name)) * 16777619u;
+        return hash;
+    }
+
+    std::vector<Entry> entries;
+};
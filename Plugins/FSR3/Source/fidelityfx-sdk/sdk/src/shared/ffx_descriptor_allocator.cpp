@@ -0,0 +1,155 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <string.h>     // for memmove
+
+#include <FidelityFX/host/ffx_assert.h>
+#include "ffx_descriptor_allocator.h"
+
+void ffxDescriptorAllocatorInit(FfxDescriptorAllocator* allocator, uint32_t base, uint32_t capacity, FfxDescriptorRange* freeRangeStorage, uint32_t maxFreeRanges)
+{
+    FFX_ASSERT(allocator);
+    FFX_ASSERT(freeRangeStorage && maxFreeRanges > 0);
+
+    allocator->base                     = base;
+    allocator->capacity                 = capacity;
+    allocator->freeRanges               = freeRangeStorage;
+    allocator->freeRangeCount           = capacity ? 1 : 0;
+    allocator->maxFreeRanges            = maxFreeRanges;
+    allocator->allocatedDescriptors     = 0;
+    allocator->peakAllocatedDescriptors = 0;
+    allocator->highWaterMark            = 0;
+    allocator->failedAllocations        = 0;
+
+    allocator->freeRanges[0].start = base;
+    allocator->freeRanges[0].size  = capacity;
+}
+
+bool ffxDescriptorAllocatorAllocate(FfxDescriptorAllocator* allocator, uint32_t size, uint32_t* outStart)
+{
+    FFX_ASSERT(allocator && outStart);
+
+    if (size == 0) {
+        *outStart = allocator->base;
+        return true;
+    }
+
+    // Lowest-address fit keeps live ranges packed towards the base, which bounds the high water mark
+    for (uint32_t i = 0; i < allocator->freeRangeCount; ++i) {
+
+        FfxDescriptorRange& range = allocator->freeRanges[i];
+        if (range.size < size) {
+            continue;
+        }
+
+        *outStart = range.start;
+        range.start += size;
+        range.size -= size;
+        if (range.size == 0) {
+            memmove(&allocator->freeRanges[i], &allocator->freeRanges[i + 1], (allocator->freeRangeCount - i - 1) * sizeof(FfxDescriptorRange));
+            --allocator->freeRangeCount;
+        }
+
+        allocator->allocatedDescriptors += size;
+        if (allocator->allocatedDescriptors > allocator->peakAllocatedDescriptors) {
+            allocator->peakAllocatedDescriptors = allocator->allocatedDescriptors;
+        }
+        if (*outStart + size - allocator->base > allocator->highWaterMark) {
+            allocator->highWaterMark = *outStart + size - allocator->base;
+        }
+        return true;
+    }
+
+    ++allocator->failedAllocations;
+    return false;
+}
+
+void ffxDescriptorAllocatorFree(FfxDescriptorAllocator* allocator, uint32_t start, uint32_t size)
+{
+    FFX_ASSERT(allocator);
+
+    if (size == 0) {
+        return;
+    }
+
+    FFX_ASSERT(start >= allocator->base && start + size <= allocator->base + allocator->capacity);
+    FFX_ASSERT(allocator->allocatedDescriptors >= size);
+    allocator->allocatedDescriptors -= size;
+
+    // Find the first free range after the one being returned
+    uint32_t next = 0;
+    while (next < allocator->freeRangeCount && allocator->freeRanges[next].start < start) {
+        ++next;
+    }
+
+    FfxDescriptorRange* prevRange = next > 0 ? &allocator->freeRanges[next - 1] : nullptr;
+    FfxDescriptorRange* nextRange = next < allocator->freeRangeCount ? &allocator->freeRanges[next] : nullptr;
+    FFX_ASSERT_MESSAGE(!prevRange || prevRange->start + prevRange->size <= start, "Descriptor range freed twice");
+    FFX_ASSERT_MESSAGE(!nextRange || start + size <= nextRange->start, "Descriptor range freed twice");
+
+    const bool mergePrev = prevRange && prevRange->start + prevRange->size == start;
+    const bool mergeNext = nextRange && start + size == nextRange->start;
+
+    if (mergePrev && mergeNext) {
+        prevRange->size += size + nextRange->size;
+        memmove(nextRange, nextRange + 1, (allocator->freeRangeCount - next - 1) * sizeof(FfxDescriptorRange));
+        --allocator->freeRangeCount;
+    } else if (mergePrev) {
+        prevRange->size += size;
+    } else if (mergeNext) {
+        nextRange->start = start;
+        nextRange->size += size;
+    } else {
+        FFX_ASSERT_MESSAGE(allocator->freeRangeCount < allocator->maxFreeRanges, "Descriptor allocator free list storage exhausted");
+        if (allocator->freeRangeCount >= allocator->maxFreeRanges) {
+            return;
+        }
+        memmove(&allocator->freeRanges[next + 1], &allocator->freeRanges[next], (allocator->freeRangeCount - next) * sizeof(FfxDescriptorRange));
+        allocator->freeRanges[next].start = start;
+        allocator->freeRanges[next].size  = size;
+        ++allocator->freeRangeCount;
+    }
+}
+
+void ffxDescriptorAllocatorGetStatistics(const FfxDescriptorAllocator* allocator, FfxDescriptorAllocatorStatistics* outStatistics)
+{
+    FFX_ASSERT(allocator && outStatistics);
+
+    uint32_t largestFreeRange = 0;
+    uint32_t freeDescriptors  = 0;
+    for (uint32_t i = 0; i < allocator->freeRangeCount; ++i) {
+        freeDescriptors += allocator->freeRanges[i].size;
+        if (allocator->freeRanges[i].size > largestFreeRange) {
+            largestFreeRange = allocator->freeRanges[i].size;
+        }
+    }
+
+    outStatistics->capacity                 = allocator->capacity;
+    outStatistics->allocatedDescriptors     = allocator->allocatedDescriptors;
+    outStatistics->peakAllocatedDescriptors = allocator->peakAllocatedDescriptors;
+    outStatistics->highWaterMark            = allocator->highWaterMark;
+    outStatistics->freeRangeCount           = allocator->freeRangeCount;
+    outStatistics->largestFreeRange         = largestFreeRange;
+    outStatistics->failedAllocations        = allocator->failedAllocations;
+    outStatistics->fragmentation            = freeDescriptors ? 1.0f - float(largestFreeRange) / float(freeDescriptors) : 0.0f;
+}
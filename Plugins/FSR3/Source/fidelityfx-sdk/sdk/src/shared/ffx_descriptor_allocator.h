@@ -0,0 +1,73 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#pragma once
+
+#include <cstdint>
+
+// A contiguous run of descriptors in a heap
+typedef struct FfxDescriptorRange {
+    uint32_t    start;
+    uint32_t    size;
+} FfxDescriptorRange;
+
+// Statistics reported by a descriptor range allocator
+typedef struct FfxDescriptorAllocatorStatistics {
+    uint32_t    capacity;                   // Number of descriptors managed by the allocator.
+    uint32_t    allocatedDescriptors;       // Number of descriptors currently allocated.
+    uint32_t    peakAllocatedDescriptors;   // Highest number of descriptors allocated at once.
+    uint32_t    highWaterMark;              // Highest descriptor offset (exclusive) ever handed out.
+    uint32_t    freeRangeCount;             // Number of disjoint free ranges.
+    uint32_t    largestFreeRange;           // Size of the largest free range.
+    uint32_t    failedAllocations;          // Number of allocations that could not be satisfied.
+    float       fragmentation;              // 1 - largestFreeRange / free descriptors, 0 when all free space is contiguous.
+} FfxDescriptorAllocatorStatistics;
+
+// First-fit free-list allocator of descriptor ranges which coalesces adjacent ranges on free.
+//
+// The allocator does not touch any API objects: it only hands out offsets in [base, base + capacity)
+// so it can be driven and validated without a device. The free list storage is provided by the
+// caller; a heap with N live allocations never needs more than N + 1 free ranges.
+typedef struct FfxDescriptorAllocator {
+    uint32_t            base;
+    uint32_t            capacity;
+    FfxDescriptorRange* freeRanges;         // Sorted by start, never adjacent
+    uint32_t            freeRangeCount;
+    uint32_t            maxFreeRanges;
+    uint32_t            allocatedDescriptors;
+    uint32_t            peakAllocatedDescriptors;
+    uint32_t            highWaterMark;
+    uint32_t            failedAllocations;
+} FfxDescriptorAllocator;
+
+// Initialize the allocator to manage capacity descriptors starting at base, with every descriptor free.
+void ffxDescriptorAllocatorInit(FfxDescriptorAllocator* allocator, uint32_t base, uint32_t capacity, FfxDescriptorRange* freeRangeStorage, uint32_t maxFreeRanges);
+
+// Allocate size contiguous descriptors. Returns false when no free range is large enough.
+bool ffxDescriptorAllocatorAllocate(FfxDescriptorAllocator* allocator, uint32_t size, uint32_t* outStart);
+
+// Return a range previously obtained from ffxDescriptorAllocatorAllocate.
+void ffxDescriptorAllocatorFree(FfxDescriptorAllocator* allocator, uint32_t start, uint32_t size);
+
+// Gather the occupancy and fragmentation statistics of the allocator.
+void ffxDescriptorAllocatorGetStatistics(const FfxDescriptorAllocator* allocator, FfxDescriptorAllocatorStatistics* outStatistics);
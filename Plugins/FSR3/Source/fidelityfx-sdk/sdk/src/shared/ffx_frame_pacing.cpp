@@ -0,0 +1,213 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include <FidelityFX/host/ffx_assert.h>
+#include <FidelityFX/host/ffx_util.h>
+#include "ffx_frame_pacing.h"
+
+// Frame deltas above this restart the averaging
+#define FFX_FRAME_PACING_RESET_THRESHOLD    (0.1)
+
+// Taken off the delay so pacing does not lock on a lower framerate than necessary
+#define FFX_FRAME_PACING_SAFETY_MARGIN      (0.0001)
+
+void ffxFramePacingEstimatorReset(FfxFramePacingEstimator* estimator)
+{
+    FFX_ASSERT(estimator);
+
+    estimator->index       = 0;
+    estimator->updateCount = 0;
+}
+
+int64_t ffxFramePacingEstimatorUpdate(FfxFramePacingEstimator* estimator, int64_t frameDelta, int64_t frequency, bool reset)
+{
+    FFX_ASSERT(estimator);
+
+    if (reset || double(frameDelta) > double(frequency) * FFX_FRAME_PACING_RESET_THRESHOLD) {
+        ffxFramePacingEstimatorReset(estimator);
+    }
+    else {
+        estimator->history[estimator->index] = double(frameDelta);
+        estimator->index = (estimator->index + 1) % FFX_FRAME_PACING_HISTORY_SIZE;
+        ++estimator->updateCount;
+    }
+
+    if (estimator->updateCount < FFX_FRAME_PACING_HISTORY_SIZE) {
+        return 0;
+    }
+
+    double average = 0.0;
+    for (uint32_t i = 0; i < FFX_FRAME_PACING_HISTORY_SIZE; ++i) {
+        average += estimator->history[i];
+    }
+    average /= FFX_FRAME_PACING_HISTORY_SIZE;
+
+    double variance = 0.0;
+    for (uint32_t i = 0; i < FFX_FRAME_PACING_HISTORY_SIZE; ++i) {
+        variance += (estimator->history[i] - average) * (estimator->history[i] - average);
+    }
+    const double deviation = sqrt(variance / FFX_FRAME_PACING_HISTORY_SIZE);
+
+    // present the interpolated frame halfway between real frames, earlier when frame times vary
+    const int64_t safetyMargin    = int64_t(double(frequency) * FFX_FRAME_PACING_SAFETY_MARGIN);
+    const int64_t conservativeAvg = int64_t(average * 0.5 - deviation * 0.1);
+    return conservativeAvg > safetyMargin ? (conservativeAvg - safetyMargin) : 0;
+}
+
+// Interpolation results waiting for the presenter thread
+typedef struct FramePacingScheduledFrame {
+    int64_t     scheduleTime;
+    int64_t     presentDelta;
+    uint32_t    frameIndex;
+} FramePacingScheduledFrame;
+
+typedef struct FramePacingPresenter {
+    int64_t                     previousPresent;
+    int64_t                     freeTime;
+    int64_t                     presentTime;
+    std::vector<int64_t>        presentTimes;
+    FfxFramePacingSimulationResult* result;
+} FramePacingPresenter;
+
+// Present the interpolated then the real frame, each no earlier than presentDelta after the previous present
+static void presentScheduledFrame(FramePacingPresenter& presenter, const FramePacingScheduledFrame& frame)
+{
+    int64_t time = FFX_MAXIMUM(presenter.freeTime, frame.scheduleTime);
+    for (uint32_t i = 0; i < 2; ++i) {
+
+        time = FFX_MAXIMUM(time, presenter.previousPresent + frame.presentDelta);
+        presenter.previousPresent = time;
+
+        FfxFramePacingSimulationResult* result = presenter.result;
+        if (result->presents && result->presentCount < result->presentCapacity) {
+            FfxFramePacingPresent& present = result->presents[result->presentCount];
+            present.time         = double(time) / FFX_FRAME_PACING_SIMULATION_FREQUENCY;
+            present.frameIndex   = frame.frameIndex;
+            present.interpolated = (i == 0);
+        }
+        ++result->presentCount;
+        presenter.presentTimes.push_back(time);
+
+        time += presenter.presentTime;
+    }
+    presenter.freeTime = time;
+}
+
+bool ffxFramePacingSimulate(const FfxFramePacingSimulationDescription* description, FfxFramePacingSimulationResult* outResult)
+{
+    if (!description || !outResult || (!description->frameTimes && description->frameCount)) {
+        return false;
+    }
+
+    const double toTicks = FFX_FRAME_PACING_SIMULATION_FREQUENCY;
+
+    FfxFramePacingSimulationResult& result = *outResult;
+    result.presentCount          = 0;
+    result.droppedFrames         = 0;
+    result.meanPresentInterval   = 0.0;
+    result.presentIntervalStdDev = 0.0;
+    result.p99IntervalDelta      = 0.0;
+    result.maxIntervalDelta      = 0.0;
+    result.averageFrameTimeMs    = 0.0;
+
+    FramePacingPresenter presenter = {};
+    presenter.presentTime = int64_t(description->presentTime * toTicks);
+    presenter.result      = &result;
+    presenter.presentTimes.reserve(size_t(description->frameCount) * 2);
+
+    FfxFramePacingEstimator estimator = {};
+    ffxFramePacingEstimatorReset(&estimator);
+
+    FramePacingScheduledFrame pending      = {};
+    bool                      hasPending   = false;
+    int64_t                   arrivalTime  = 0;
+    int64_t                   scheduleTime = 0;
+    int64_t                   previousScheduleTime = 0;
+    const int64_t             interpolationTime    = int64_t(description->interpolationTime * toTicks);
+
+    for (uint32_t frameIndex = 0; frameIndex < description->frameCount; ++frameIndex) {
+
+        // the interpolation thread handles one frame at a time and measures the delta once it is done
+        arrivalTime += int64_t(description->frameTimes[frameIndex] * toTicks);
+        scheduleTime = FFX_MAXIMUM(arrivalTime, scheduleTime) + interpolationTime;
+
+        const int64_t frameDelta = frameIndex ? (scheduleTime - previousScheduleTime) : 0;
+        previousScheduleTime     = scheduleTime;
+
+        const bool reset = description->resets && description->resets[frameIndex];
+        FramePacingScheduledFrame frame = { scheduleTime, ffxFramePacingEstimatorUpdate(&estimator, frameDelta, FFX_FRAME_PACING_SIMULATION_FREQUENCY, reset), frameIndex };
+
+        // the presenter picks up the latest scheduled frame once it is done with the previous one
+        if (hasPending && FFX_MAXIMUM(presenter.freeTime, pending.scheduleTime) <= scheduleTime) {
+            presentScheduledFrame(presenter, pending);
+            hasPending = false;
+        }
+        if (hasPending) {
+            ++result.droppedFrames;
+        }
+        pending    = frame;
+        hasPending = true;
+
+        // FFXFrameInterpolation::CalculateFPSTimings
+        const double frameTimeMs = description->frameTimes[frameIndex] * 1000.0;
+        result.averageFrameTimeMs = result.averageFrameTimeMs * 0.75 + frameTimeMs * 0.25;
+    }
+    if (hasPending) {
+        presentScheduledFrame(presenter, pending);
+    }
+
+    // jitter of the present intervals
+    const std::vector<int64_t>& presentTimes = presenter.presentTimes;
+    if (presentTimes.size() > 1) {
+
+        const size_t intervalCount = presentTimes.size() - 1;
+        double       sum           = 0.0;
+        double       sumOfSquares  = 0.0;
+        for (size_t i = 0; i < intervalCount; ++i) {
+            const double interval = double(presentTimes[i + 1] - presentTimes[i]) / toTicks;
+            sum          += interval;
+            sumOfSquares += interval * interval;
+        }
+        result.meanPresentInterval   = sum / double(intervalCount);
+        result.presentIntervalStdDev = sqrt(FFX_MAXIMUM(sumOfSquares / double(intervalCount) - result.meanPresentInterval * result.meanPresentInterval, 0.0));
+
+        if (intervalCount > 1) {
+            std::vector<int64_t> intervalDeltas(intervalCount - 1);
+            for (size_t i = 0; i + 1 < intervalCount; ++i) {
+                const int64_t delta = (presentTimes[i + 2] - presentTimes[i + 1]) - (presentTimes[i + 1] - presentTimes[i]);
+                intervalDeltas[i] = delta < 0 ? -delta : delta;
+            }
+
+            // nearest rank percentile
+            std::sort(intervalDeltas.begin(), intervalDeltas.end());
+            const size_t rank = (intervalDeltas.size() * 99 + 99) / 100;
+            result.p99IntervalDelta = double(intervalDeltas[rank - 1]) / toTicks;
+            result.maxIntervalDelta = double(intervalDeltas.back()) / toTicks;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,82 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+// Number of frame deltas averaged to pace the interpolated frames
+#define FFX_FRAME_PACING_HISTORY_SIZE       (10)
+
+// Tick frequency the pacing simulator works in, the usual QueryPerformanceFrequency
+#define FFX_FRAME_PACING_SIMULATION_FREQUENCY   (10000000)
+
+// Moving average of the time between frames reaching the interpolation thread of the frame
+// interpolation swapchain, which decides how long the presenter waits between the interpolated
+// and the real frame.
+typedef struct FfxFramePacingEstimator {
+    double      history[FFX_FRAME_PACING_HISTORY_SIZE];
+    uint32_t    index;
+    uint32_t    updateCount;
+} FfxFramePacingEstimator;
+
+// Forget all frame deltas.
+void ffxFramePacingEstimatorReset(FfxFramePacingEstimator* estimator);
+
+// Record the ticks since the previous frame and return the delay in ticks the presenter waits before
+// each present. The averaging restarts on reset or when a frame took more than 100ms, and no delay is
+// applied until FFX_FRAME_PACING_HISTORY_SIZE deltas have been recorded.
+int64_t ffxFramePacingEstimatorUpdate(FfxFramePacingEstimator* estimator, int64_t frameDelta, int64_t frequency, bool reset);
+
+// A present issued by the simulated presenter thread
+typedef struct FfxFramePacingPresent {
+    double      time;                       // Seconds since the start of the trace.
+    uint32_t    frameIndex;                 // Index of the frame in the trace.
+    bool        interpolated;               // Interpolated frame presented ahead of the real one.
+} FfxFramePacingPresent;
+
+// A frame time trace to replay through the swapchain pacing
+typedef struct FfxFramePacingSimulationDescription {
+    const double*   frameTimes;             // Seconds between consecutive frames handed to the swapchain.
+    const bool*     resets;                 // Optional per frame reset flags, as set by the frame generation config.
+    uint32_t        frameCount;
+    double          interpolationTime;      // Seconds from a frame being handed over to its interpolated frame being ready.
+    double          presentTime;            // Seconds the presenter thread spends in each Present call.
+} FfxFramePacingSimulationDescription;
+
+// Present schedule and pacing quality of a simulation
+typedef struct FfxFramePacingSimulationResult {
+    FfxFramePacingPresent*  presents;       // Optional array receiving the present schedule.
+    uint32_t                presentCapacity;
+    uint32_t                presentCount;   // Number of presents issued, may exceed presentCapacity.
+    uint32_t                droppedFrames;  // Frames replaced by a newer one before the presenter picked them up.
+    double                  meanPresentInterval;        // Seconds between consecutive presents.
+    double                  presentIntervalStdDev;
+    double                  p99IntervalDelta;           // 99th percentile of the change between consecutive present intervals.
+    double                  maxIntervalDelta;
+    double                  averageFrameTimeMs;         // Smoothed real frame time, as reported by the Unreal plugin.
+} FfxFramePacingSimulationResult;
+
+// Replay a frame time trace through the pacing of the frame interpolation swapchain. The simulation
+// runs the interpolation and presenter threads on a virtual clock, so it is deterministic and needs
+// neither a GPU nor a display. Returns false when the description is invalid.
+bool ffxFramePacingSimulate(const FfxFramePacingSimulationDescription* description, FfxFramePacingSimulationResult* outResult);
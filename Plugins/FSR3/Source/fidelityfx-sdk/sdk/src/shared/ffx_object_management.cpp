@@ -23,6 +23,9 @@
 #include <FidelityFX/host/ffx_interface.h>
 #include "ffx_object_management.h"
 
+#include <stdlib.h>  // for calloc
+#include <string.h>  // for memset
+
 void ffxSafeReleasePipeline(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId)
 {
     FFX_ASSERT(pipeline);
@@ -46,3 +49,68 @@ void ffxSafeReleaseResource(FfxInterface* backendInterface, FfxResourceInternal
 
     backendInterface->fpDestroyResource(backendInterface, resource, effectContextId);
 }
+
+FfxErrorCode ffxScheduleGpuJobs(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount)
+{
+    FFX_ASSERT(backendInterface->fpScheduleGpuJob);
+    FFX_ASSERT(jobs || !jobCount);
+
+    if (backendInterface->fpScheduleGpuJobs)
+    {
+        return backendInterface->fpScheduleGpuJobs(backendInterface, jobs, jobCount);
+    }
+
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+    {
+        FFX_VALIDATE(backendInterface->fpScheduleGpuJob(backendInterface, &jobs[jobIndex]));
+    }
+
+    return FFX_OK;
+}
+
+FfxErrorCode ffxGpuJobBatchCreate(FfxGpuJobBatch* batch, uint32_t jobCapacity)
+{
+    FFX_ASSERT(batch);
+    FFX_ASSERT(jobCapacity);
+
+    batch->jobs        = (FfxGpuJobDescription*)calloc(jobCapacity, sizeof(FfxGpuJobDescription));
+    batch->jobCapacity = batch->jobs ? jobCapacity : 0;
+    batch->jobCount    = 0;
+
+    return batch->jobs ? FFX_OK : FFX_ERROR_OUT_OF_MEMORY;
+}
+
+void ffxGpuJobBatchDestroy(FfxGpuJobBatch* batch)
+{
+    FFX_ASSERT(batch);
+
+    free(batch->jobs);
+    batch->jobs        = nullptr;
+    batch->jobCapacity = 0;
+    batch->jobCount    = 0;
+}
+
+FfxGpuJobDescription* ffxGpuJobBatchAdd(FfxInterface* backendInterface, FfxGpuJobBatch* batch, FfxGpuJobType jobType)
+{
+    FFX_ASSERT(batch->jobs);
+
+    if (batch->jobCount == batch->jobCapacity)
+    {
+        ffxGpuJobBatchSchedule(backendInterface, batch);
+    }
+
+    FfxGpuJobDescription* job = &batch->jobs[batch->jobCount++];
+    job->jobType              = jobType;
+    memset(job, 0, ffxGetGpuJobDescriptionSize(job));
+    job->jobType = jobType;
+
+    return job;
+}
+
+FfxErrorCode ffxGpuJobBatchSchedule(FfxInterface* backendInterface, FfxGpuJobBatch* batch)
+{
+    const uint32_t jobCount = batch->jobCount;
+    batch->jobCount         = 0;
+
+    return ffxScheduleGpuJobs(backendInterface, batch->jobs, jobCount);
+}
@@ -33,6 +33,19 @@ FFX_API void ffxSafeReleasePipeline(FfxInterface* backendInterface, FfxPipelineS
 FFX_API void ffxSafeReleaseCopyResource(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
 FFX_API void ffxSafeReleaseResource(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId);
 
+// Schedules jobs through fpScheduleGpuJobs, or one at a time on backends which don't provide it
+FFX_API FfxErrorCode ffxScheduleGpuJobs(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount);
+
+// FfxGpuJobBatch storage is allocated once with the effect context, as each job is sized for a compute dispatch
+FFX_API FfxErrorCode ffxGpuJobBatchCreate(FfxGpuJobBatch* batch, uint32_t jobCapacity);
+FFX_API void ffxGpuJobBatchDestroy(FfxGpuJobBatch* batch);
+
+// Returns the next job of the batch, zeroed up to the size of its type. A full batch is scheduled first so job order is kept.
+FFX_API FfxGpuJobDescription* ffxGpuJobBatchAdd(FfxInterface* backendInterface, FfxGpuJobBatch* batch, FfxGpuJobType jobType);
+
+// Schedules the recorded jobs and empties the batch
+FFX_API FfxErrorCode ffxGpuJobBatchSchedule(FfxInterface* backendInterface, FfxGpuJobBatch* batch);
+
 #if defined(__cplusplus)
 }
 #endif  // #if defined(__cplusplus)
@@ -0,0 +1,143 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_assert.h>
+#include <FidelityFX/host/ffx_util.h>
+#include "ffx_transient_heap_planner.h"
+
+static uint64_t alignPlacement(uint64_t offset, uint64_t alignment)
+{
+    return alignment ? ((offset + alignment - 1) / alignment) * alignment : offset;
+}
+
+void ffxTransientHeapPlannerInit(FfxTransientHeapPlanner* planner, uint64_t minimumHeapSize)
+{
+    FFX_ASSERT(planner);
+
+    planner->minimumHeapSize  = minimumHeapSize;
+    planner->heapCount        = 0;
+    planner->placementCount   = 0;
+    planner->placedBytes      = 0;
+    planner->peakPlacedBytes  = 0;
+    planner->failedPlacements = 0;
+}
+
+void ffxTransientHeapCursorReset(FfxTransientHeapCursor* cursor)
+{
+    FFX_ASSERT(cursor);
+
+    cursor->heapIndex      = 0;
+    cursor->placementCount = 0;
+    cursor->offset         = 0;
+}
+
+bool ffxTransientHeapPlannerPlace(FfxTransientHeapPlanner* planner, FfxTransientHeapCursor* cursor, uint64_t size, uint64_t alignment,
+                                  uint32_t* outHeapIndex, uint64_t* outOffset, uint64_t* outNewHeapSize)
+{
+    FFX_ASSERT(planner && cursor);
+    FFX_ASSERT(outHeapIndex && outOffset && outNewHeapSize);
+
+    *outNewHeapSize = 0;
+
+    // Heaps before the cursor may hold earlier placements of the same context, so only look forward
+    for (uint32_t heapIndex = cursor->heapIndex; heapIndex < planner->heapCount; ++heapIndex) {
+
+        const uint64_t offset = alignPlacement(heapIndex == cursor->heapIndex ? cursor->offset : 0, alignment);
+        if (offset + size <= planner->heapSizes[heapIndex]) {
+
+            cursor->heapIndex = heapIndex;
+            cursor->offset    = offset + size;
+            ++cursor->placementCount;
+
+            ++planner->placementCount;
+            planner->placedBytes    += size;
+            planner->peakPlacedBytes = FFX_MAXIMUM(planner->peakPlacedBytes, planner->placedBytes);
+
+            *outHeapIndex = heapIndex;
+            *outOffset    = offset;
+            return true;
+        }
+    }
+
+    if (planner->heapCount < FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS) {
+
+        // Grow geometrically so the number of heaps stays small when many contexts stack up
+        uint64_t heapBytes = 0;
+        for (uint32_t heapIndex = 0; heapIndex < planner->heapCount; ++heapIndex) {
+            heapBytes += planner->heapSizes[heapIndex];
+        }
+        *outNewHeapSize = alignPlacement(FFX_MAXIMUM(FFX_MAXIMUM(size, heapBytes), planner->minimumHeapSize), alignment);
+    }
+    else {
+        ++planner->failedPlacements;
+    }
+
+    return false;
+}
+
+uint32_t ffxTransientHeapPlannerAddHeap(FfxTransientHeapPlanner* planner, uint64_t heapSize)
+{
+    FFX_ASSERT(planner);
+    FFX_ASSERT(planner->heapCount < FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS);
+
+    planner->heapSizes[planner->heapCount] = heapSize;
+    return planner->heapCount++;
+}
+
+void ffxTransientHeapPlannerRelease(FfxTransientHeapPlanner* planner, FfxTransientHeapCursor* cursor, uint64_t size)
+{
+    FFX_ASSERT(planner && cursor);
+    FFX_ASSERT(planner->placementCount > 0 && cursor->placementCount > 0);
+    FFX_ASSERT(planner->placedBytes >= size);
+
+    --planner->placementCount;
+    planner->placedBytes -= size;
+
+    // Resources recreated by a live context (e.g. on resize) start packing from the first heap again
+    if (--cursor->placementCount == 0) {
+        ffxTransientHeapCursorReset(cursor);
+    }
+}
+
+void ffxTransientHeapPlannerReset(FfxTransientHeapPlanner* planner)
+{
+    FFX_ASSERT(planner);
+    FFX_ASSERT(planner->placementCount == 0);
+
+    planner->heapCount = 0;
+}
+
+void ffxTransientHeapPlannerGetStatistics(const FfxTransientHeapPlanner* planner, FfxTransientHeapPlannerStatistics* outStatistics)
+{
+    FFX_ASSERT(planner && outStatistics);
+
+    outStatistics->heapCount        = planner->heapCount;
+    outStatistics->placementCount   = planner->placementCount;
+    outStatistics->heapBytes        = 0;
+    outStatistics->placedBytes      = planner->placedBytes;
+    outStatistics->peakPlacedBytes  = planner->peakPlacedBytes;
+    outStatistics->failedPlacements = planner->failedPlacements;
+
+    for (uint32_t heapIndex = 0; heapIndex < planner->heapCount; ++heapIndex) {
+        outStatistics->heapBytes += planner->heapSizes[heapIndex];
+    }
+}
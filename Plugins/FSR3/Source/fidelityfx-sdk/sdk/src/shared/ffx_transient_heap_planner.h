@@ -0,0 +1,89 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+
+// Maximum number of shared heaps a planner hands out placements in
+#define FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS    (16)
+
+// Position of the next placement of one effect context. Placements made through the same cursor
+// never overlap, placements made through different cursors alias each other.
+typedef struct FfxTransientHeapCursor {
+    uint32_t    heapIndex;
+    uint32_t    placementCount;             // Live placements made through the cursor
+    uint64_t    offset;
+} FfxTransientHeapCursor;
+
+// Statistics reported by a transient heap planner
+typedef struct FfxTransientHeapPlannerStatistics {
+    uint32_t    heapCount;                  // Number of shared heaps.
+    uint32_t    placementCount;             // Number of live placements.
+    uint64_t    heapBytes;                  // Size of all shared heaps.
+    uint64_t    placedBytes;                // Size of all live placements, i.e. the memory they would need without aliasing.
+    uint64_t    peakPlacedBytes;            // Highest placedBytes seen.
+    uint32_t    failedPlacements;           // Number of placements that did not fit in any heap.
+} FfxTransientHeapPlannerStatistics;
+
+// Planner aliasing the per-dispatch resources of several effect contexts in a set of shared heaps.
+//
+// Effects declare resources whose contents do not outlive a single dispatch (FFX_RESOURCE_FLAGS_DISPATCH_TRANSIENT).
+// Effect contexts sharing a backend dispatch one after the other, so each context packs its transient
+// resources linearly through its own cursor starting at the first heap, and the contexts overlap each
+// other. The backend must issue an aliasing barrier before executing the jobs of a context.
+//
+// The planner does not touch any API objects: it only hands out (heap, offset) pairs, the backend
+// creates a heap whenever ffxTransientHeapPlannerPlace asks for one.
+typedef struct FfxTransientHeapPlanner {
+    uint64_t    minimumHeapSize;
+    uint64_t    heapSizes[FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS];
+    uint32_t    heapCount;
+    uint32_t    placementCount;
+    uint64_t    placedBytes;
+    uint64_t    peakPlacedBytes;
+    uint32_t    failedPlacements;
+} FfxTransientHeapPlanner;
+
+// Initialize the planner without any heap. New heaps are at least minimumHeapSize bytes.
+void ffxTransientHeapPlannerInit(FfxTransientHeapPlanner* planner, uint64_t minimumHeapSize);
+
+// Rewind a cursor to the start of the first heap.
+void ffxTransientHeapCursorReset(FfxTransientHeapCursor* cursor);
+
+// Place size bytes aligned to alignment after the cursor. When no existing heap has room, outNewHeapSize
+// receives the size of the heap the caller has to create before calling ffxTransientHeapPlannerAddHeap
+// and placing again, and false is returned. outNewHeapSize is 0 when the planner is out of heaps.
+bool ffxTransientHeapPlannerPlace(FfxTransientHeapPlanner* planner, FfxTransientHeapCursor* cursor, uint64_t size, uint64_t alignment,
+                                  uint32_t* outHeapIndex, uint64_t* outOffset, uint64_t* outNewHeapSize);
+
+// Register a heap of heapSize bytes created for a failed placement. Returns its index.
+uint32_t ffxTransientHeapPlannerAddHeap(FfxTransientHeapPlanner* planner, uint64_t heapSize);
+
+// Return a placement of size bytes made through cursor. The cursor is rewound once its last placement is returned.
+void ffxTransientHeapPlannerRelease(FfxTransientHeapPlanner* planner, FfxTransientHeapCursor* cursor, uint64_t size);
+
+// Forget all heaps, only valid once every placement has been released.
+void ffxTransientHeapPlannerReset(FfxTransientHeapPlanner* planner);
+
+// Gather the occupancy statistics of the planner.
+void ffxTransientHeapPlannerGetStatistics(const FfxTransientHeapPlanner* planner, FfxTransientHeapPlannerStatistics* outStatistics);
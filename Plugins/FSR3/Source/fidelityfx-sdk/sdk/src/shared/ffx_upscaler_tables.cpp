@@ -0,0 +1,108 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <cmath>        // for fabsf, sinf, roundf, floorf
+
+#include <FidelityFX/host/ffx_util.h>
+#include "ffx_upscaler_tables.h"
+
+float ffxHalton(int32_t index, int32_t base)
+{
+    float f = 1.0f, result = 0.0f;
+
+    for (int32_t currentIndex = index; currentIndex > 0;) {
+
+        f /= (float)base;
+        result = result + f * (float)(currentIndex % base);
+        currentIndex = (uint32_t)(floorf((float)(currentIndex) / (float)(base)));
+    }
+
+    return result;
+}
+
+float ffxLanczos2(float value)
+{
+    return fabsf(value) < FFX_EPSILON ? 1.f : (sinf(FFX_PI * value) / (FFX_PI * value)) * (sinf(0.5f * FFX_PI * value) / (0.5f * FFX_PI * value));
+}
+
+// Same operations as ffxHalton, the integer division matches floorf for the table indices
+static constexpr float haltonStep(int32_t index, int32_t base, float f, float result)
+{
+    return index > 0 ? haltonStep(index / base, base, f / (float)base, result + (f / (float)base) * (float)(index % base)) : result;
+}
+
+static constexpr float jitterOffset(int32_t index, int32_t base)
+{
+    return haltonStep(index, base, 1.0f, 0.0f) - 0.5f;
+}
+
+typedef struct JitterOffset {
+    float x;
+    float y;
+} JitterOffset;
+
+#define FFX_JITTER_ENTRY(i)         { jitterOffset((i) + 1, 2), jitterOffset((i) + 1, 3) }
+#define FFX_JITTER_ENTRIES_8(i)     FFX_JITTER_ENTRY(i), FFX_JITTER_ENTRY(i + 1), FFX_JITTER_ENTRY(i + 2), FFX_JITTER_ENTRY(i + 3), \
+                                    FFX_JITTER_ENTRY(i + 4), FFX_JITTER_ENTRY(i + 5), FFX_JITTER_ENTRY(i + 6), FFX_JITTER_ENTRY(i + 7)
+#define FFX_JITTER_ENTRIES_32(i)    FFX_JITTER_ENTRIES_8(i), FFX_JITTER_ENTRIES_8(i + 8), FFX_JITTER_ENTRIES_8(i + 16), FFX_JITTER_ENTRIES_8(i + 24)
+
+static constexpr JitterOffset s_JitterTable[FFX_JITTER_TABLE_SIZE] = {
+    FFX_JITTER_ENTRIES_32(0), FFX_JITTER_ENTRIES_32(32), FFX_JITTER_ENTRIES_32(64), FFX_JITTER_ENTRIES_32(96)
+};
+
+#undef FFX_JITTER_ENTRIES_32
+#undef FFX_JITTER_ENTRIES_8
+#undef FFX_JITTER_ENTRY
+
+void ffxGetJitterOffsetFromTable(float* outX, float* outY, int32_t index, int32_t phaseCount)
+{
+    // the phase only depends on index % phaseCount, so one table serves every phase count
+    const int32_t phase = index % phaseCount;
+    if (phase >= 0 && phase < FFX_JITTER_TABLE_SIZE) {
+        *outX = s_JitterTable[phase].x;
+        *outY = s_JitterTable[phase].y;
+    }
+    else {
+        *outX = ffxHalton(phase + 1, 2) - 0.5f;
+        *outY = ffxHalton(phase + 1, 3) - 0.5f;
+    }
+}
+
+typedef struct Lanczos2Lut {
+    int16_t weights[FFX_LANCZOS2_LUT_WIDTH];
+
+    Lanczos2Lut()
+    {
+        for (uint32_t currentLanczosWidthIndex = 0; currentLanczosWidthIndex < FFX_LANCZOS2_LUT_WIDTH; currentLanczosWidthIndex++) {
+
+            const float x = 2.0f * currentLanczosWidthIndex / float(FFX_LANCZOS2_LUT_WIDTH - 1);
+            const float y = ffxLanczos2(x);
+            weights[currentLanczosWidthIndex] = int16_t(roundf(y * 32767.0f));
+        }
+    }
+} Lanczos2Lut;
+
+const int16_t* ffxGetLanczos2Lut()
+{
+    static const Lanczos2Lut lut;
+    return lut.weights;
+}
@@ -0,0 +1,44 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <FidelityFX/host/ffx_types.h>
+
+// Jitter phases served from the precomputed table, covers upscaling ratios up to 4x (8 * 4^2 phases)
+#define FFX_JITTER_TABLE_SIZE       (128)
+
+// Width of the R16_SNORM Lanczos 2 lookup texture
+#define FFX_LANCZOS2_LUT_WIDTH      (128)
+
+// Halton sequence value for index and base.
+FFX_API float ffxHalton(int32_t index, int32_t base);
+
+// Lanczos 2 kernel.
+FFX_API float ffxLanczos2(float value);
+
+// Sub-pixel jitter of a frame, i.e. the Halton (2, 3) sequence centered on the pixel. Phases below
+// FFX_JITTER_TABLE_SIZE come from a table generated at compile time, phaseCount must be positive.
+FFX_API void ffxGetJitterOffsetFromTable(float* outX, float* outY, int32_t index, int32_t phaseCount);
+
+// Lanczos 2 weights over [0, 2] in R16_SNORM, generated once and shared by every upscaler context.
+FFX_API const int16_t* ffxGetLanczos2Lut();
@@ -0,0 +1,283 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_api/ffx_api.hpp>
+#include <ffx_provider.h>
+#include <ffx_provider_cache.h>
+#include <backends.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <mutex>
+
+// Made up descriptor types, two versions of one effect and a second effect
+static constexpr ffxStructType_t kCreateDescEffectA = 0x00fe0000u;
+static constexpr ffxStructType_t kCreateDescEffectB = 0x00fd0000u;
+static constexpr ffxStructType_t kQueryDescEffectA  = 0x00fe0001u;
+static constexpr ffxStructType_t kDispatchDescA     = 0x00fe0002u;
+
+// Provider that only counts what is asked of it
+class StubProvider final : public ffxProvider
+{
+public:
+    StubProvider(uint64_t id, ffxStructType_t effectMask) : id(id), effectMask(effectMask) {}
+
+    bool CanProvide(uint64_t type) const override
+    {
+        ++canProvideCalls;
+        return (type & FFX_API_EFFECT_MASK) == effectMask;
+    }
+
+    uint64_t GetId() const override
+    {
+        return id;
+    }
+
+    const char* GetVersionName() const override
+    {
+        return "stub";
+    }
+
+    ffxReturnCode_t CreateContext(ffxContext* context, ffxCreateContextDescHeader*, Allocator& alloc) const override
+    {
+        InternalContextHeader* header = alloc.construct<InternalContextHeader>();
+        header->provider = this;
+        *context = header;
+        return FFX_API_RETURN_OK;
+    }
+
+    ffxReturnCode_t DestroyContext(ffxContext* context, Allocator& alloc) const override
+    {
+        alloc.dealloc(*context);
+        *context = nullptr;
+        return FFX_API_RETURN_OK;
+    }
+
+    ffxReturnCode_t Configure(ffxContext*, const ffxConfigureDescHeader*) const override
+    {
+        return FFX_API_RETURN_OK;
+    }
+
+    ffxReturnCode_t Query(ffxContext*, ffxQueryDescHeader*) const override
+    {
+        ++queries;
+        return FFX_API_RETURN_OK;
+    }
+
+    ffxReturnCode_t Dispatch(ffxContext*, const ffxDispatchDescHeader*) const override
+    {
+        ++dispatches;
+        return FFX_API_RETURN_OK;
+    }
+
+    const uint64_t          id;
+    const ffxStructType_t   effectMask;
+    mutable uint32_t        canProvideCalls = 0;
+    mutable uint32_t        queries         = 0;
+    mutable uint32_t        dispatches      = 0;
+};
+
+// A newer and an older version of effect A, and effect B, in the order ffx_provider.cpp lists them
+static StubProvider s_effectANew(0xa2, kCreateDescEffectA & FFX_API_EFFECT_MASK);
+static StubProvider s_effectAOld(0xa1, kCreateDescEffectA & FFX_API_EFFECT_MASK);
+static StubProvider s_effectB(0xb1, kCreateDescEffectB & FFX_API_EFFECT_MASK);
+
+static std::mutex       s_providerCacheMutex;
+static ffxProviderCache s_providerCache;
+
+// The registry ffx_api.cpp resolves through, standing in for ffx_provider.cpp and its D3D12 driver extension
+const ffxProvider* GetffxProvider(ffxStructType_t descType, uint64_t overrideId, void*)
+{
+    std::lock_guard<std::mutex> lock(s_providerCacheMutex);
+    return s_providerCache.Find(descType, overrideId);
+}
+
+uint64_t GetProviderVersions(ffxStructType_t descType, void*, uint64_t capacity, uint64_t* versionIds, const char** versionNames)
+{
+    std::lock_guard<std::mutex> lock(s_providerCacheMutex);
+
+    uint64_t count = 0;
+    for (const ffxProvider* provider : s_providerCache.GetProviders())
+    {
+        if (count < capacity && provider->CanProvide(descType))
+        {
+            if (versionIds)
+                versionIds[count] = provider->GetId();
+            if (versionNames)
+                versionNames[count] = provider->GetVersionName();
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint64_t GetProviderCount(ffxStructType_t descType, void* device)
+{
+    return GetProviderVersions(descType, device, UINT64_MAX, nullptr, nullptr);
+}
+
+void* GetDevice(const ffxApiHeader*)
+{
+    return nullptr;
+}
+
+static void setProviders(const ffxProvider* const* providers, size_t providerCount)
+{
+    std::lock_guard<std::mutex> lock(s_providerCacheMutex);
+    s_providerCache.SetProviders(providers, providerCount);
+}
+
+static const ffxProvider* createContext(ffxContext* context, uint64_t overrideId)
+{
+    ffxOverrideVersion          overrideVersion = {{FFX_API_DESC_TYPE_OVERRIDE_VERSION, nullptr}, overrideId};
+    ffxCreateContextDescHeader  createDesc      = {kCreateDescEffectA, overrideId ? &overrideVersion.header : nullptr};
+
+    if (ffxCreateContext(context, &createDesc, nullptr) != FFX_API_RETURN_OK)
+        return nullptr;
+    return GetAssociatedProvider(context);
+}
+
+static void testOverrideResolution()
+{
+    const ffxProvider* providers[] = {&s_effectANew, &s_effectAOld, &s_effectB};
+    setProviders(providers, 3);
+
+    // the first matching provider without an override, the requested version with one, in either lookup order
+    for (int pass = 0; pass < 2; ++pass) {
+        ffxContext context = nullptr;
+        FFX_TEST_EXPECT(createContext(&context, 0) == &s_effectANew);
+        FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+
+        FFX_TEST_EXPECT(createContext(&context, s_effectAOld.id) == &s_effectAOld);
+        FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+
+        FFX_TEST_EXPECT(createContext(&context, s_effectANew.id) == &s_effectANew);
+        FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+
+        // an unknown version is not replaced by the default one once that is cached
+        FFX_TEST_EXPECT(createContext(&context, 0xdead) == nullptr);
+        FFX_TEST_EXPECT(context == nullptr);
+    }
+
+    // context-less queries go through the same resolution
+    ffxOverrideVersion overrideVersion = {{FFX_API_DESC_TYPE_OVERRIDE_VERSION, nullptr}, s_effectAOld.id};
+    ffxQueryDescHeader query           = {kQueryDescEffectA, &overrideVersion.header};
+    const uint32_t     oldQueries      = s_effectAOld.queries;
+    const uint32_t     newQueries      = s_effectANew.queries;
+    FFX_TEST_EXPECT(ffxQuery(nullptr, &query) == FFX_API_RETURN_OK);
+    FFX_TEST_EXPECT(s_effectAOld.queries == oldQueries + 1);
+    query.pNext = nullptr;
+    FFX_TEST_EXPECT(ffxQuery(nullptr, &query) == FFX_API_RETURN_OK);
+    FFX_TEST_EXPECT(s_effectANew.queries == newQueries + 1);
+
+    // the cached result of every pair is the one an uncached walk of the list gives
+    const ffxStructType_t descTypes[]   = {kCreateDescEffectA, kQueryDescEffectA, kCreateDescEffectB, 0x00fc0000u};
+    const uint64_t        overrideIds[] = {0, s_effectANew.id, s_effectAOld.id, s_effectB.id, 0xdead};
+    for (ffxStructType_t descType : descTypes) {
+        for (uint64_t overrideId : overrideIds) {
+            FFX_TEST_EXPECT(GetffxProvider(descType, overrideId, nullptr) == s_providerCache.Resolve(descType, overrideId));
+        }
+    }
+
+    ffxQueryDescGetVersions getVersions = {};
+    uint64_t                versionCount = 0;
+    getVersions.header.type    = FFX_API_QUERY_DESC_TYPE_GET_VERSIONS;
+    getVersions.createDescType = kCreateDescEffectA;
+    getVersions.outputCount    = &versionCount;
+    FFX_TEST_EXPECT(ffxQuery(nullptr, &getVersions.header) == FFX_API_RETURN_OK);
+    FFX_TEST_EXPECT(versionCount == 2);
+}
+
+static void testCacheInvalidation()
+{
+    const ffxProvider* providers[] = {&s_effectANew, &s_effectAOld, &s_effectB};
+    setProviders(providers, 3);
+
+    ffxContext context = nullptr;
+    FFX_TEST_EXPECT(createContext(&context, 0) == &s_effectANew);
+    FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+
+    // a resolved pair does not ask the providers again
+    const uint32_t canProvideCalls = s_effectANew.canProvideCalls;
+    for (int i = 0; i < 4; ++i) {
+        FFX_TEST_EXPECT(createContext(&context, 0) == &s_effectANew);
+        FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+    }
+    FFX_TEST_EXPECT(s_effectANew.canProvideCalls == canProvideCalls);
+
+    // a new provider list, as when the driver adds an external provider in front, drops the cached results
+    const ffxProvider* reordered[] = {&s_effectAOld, &s_effectANew, &s_effectB};
+    setProviders(reordered, 3);
+    FFX_TEST_EXPECT(createContext(&context, 0) == &s_effectAOld);
+    FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+    FFX_TEST_EXPECT(createContext(&context, s_effectANew.id) == &s_effectANew);
+    FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+}
+
+template<typename Call>
+static double nanosecondsPerCall(Call call)
+{
+    const uint32_t iterations = 1000000;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        call();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+// Per call cost of the entry points against a stub provider, so all of it is ffx-api overhead
+static void benchmarkEntryPoints()
+{
+    // as many providers as a DX12 build with a few driver-side versions
+    StubProvider       external[4] = {{0xe4, 0x00f00000u}, {0xe3, 0x00f10000u}, {0xe2, 0x00f20000u}, {0xe1, 0x00f30000u}};
+    const ffxProvider* providers[] = {&external[0], &external[1], &external[2], &external[3], &s_effectB, &s_effectANew, &s_effectAOld};
+    setProviders(providers, 7);
+
+    ffxContext context = nullptr;
+    FFX_TEST_EXPECT(createContext(&context, 0) == &s_effectANew);
+
+    ffxDispatchDescHeader dispatch = {kDispatchDescA, nullptr};
+    ffxQueryDescHeader    query    = {kQueryDescEffectA, nullptr};
+
+    const uint32_t dispatches = s_effectANew.dispatches;
+    const double dispatchNs       = nanosecondsPerCall([&] { ffxDispatch(&context, &dispatch); });
+    const double contextQueryNs   = nanosecondsPerCall([&] { ffxQuery(&context, &query); });
+    const double resolvedQueryNs  = nanosecondsPerCall([&] { ffxQuery(nullptr, &query); });
+    const double cachedNs         = nanosecondsPerCall([&] { s_providerCache.Find(kQueryDescEffectA, 0); });
+    const double uncachedNs       = nanosecondsPerCall([&] { s_providerCache.Resolve(kQueryDescEffectA, 0); });
+    FFX_TEST_EXPECT(s_effectANew.dispatches == dispatches + 1000000);
+
+    printf("ffxDispatch %.1f ns, ffxQuery on a context %.1f ns, context-less ffxQuery %.1f ns per call\n", dispatchNs, contextQueryNs, resolvedQueryNs);
+    printf("provider resolution over %zu providers: cached %.1f ns, uncached %.1f ns\n", s_providerCache.GetProviders().size(), cachedNs, uncachedNs);
+
+    FFX_TEST_EXPECT(ffxDestroyContext(&context, nullptr) == FFX_API_RETURN_OK);
+}
+
+int main()
+{
+    testOverrideResolution();
+    testCacheInvalidation();
+    benchmarkEntryPoints();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,262 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_barrier_planner.h>
+#include "ffx_test.h"
+
+#include <vector>
+
+// Backend resource record with the tracking state embedded after other fields, like the DX12 backend
+typedef struct MockResource {
+    void*                   apiResource;
+    FfxBarrierResourceState barrierState;
+} MockResource;
+
+static const uint32_t MockResourceCount = FFX_MAX_BARRIERS * 2;
+
+// Mock command list recording every flush the planner hands to the backend
+typedef struct MockCommandList {
+    std::vector<std::vector<FfxBarrierRecord>> flushes;
+} MockCommandList;
+
+static void recordBarriers(void* flushContext, void* commandList, const FfxBarrierRecord* barriers, uint32_t barrierCount)
+{
+    FFX_TEST_EXPECT(flushContext != nullptr);
+    FFX_TEST_EXPECT(barrierCount > 0 && barrierCount <= FFX_MAX_BARRIERS);
+
+    MockCommandList* mockCommandList = (MockCommandList*)commandList;
+    mockCommandList->flushes.emplace_back(barriers, barriers + barrierCount);
+}
+
+typedef struct PlannerFixture {
+    MockResource                resources[MockResourceCount];
+    FfxBarrierPlanner           planner;
+    FfxBarrierPlannerStatistics statistics;
+    MockCommandList             commandList;
+} PlannerFixture;
+
+static void initFixture(PlannerFixture& fixture)
+{
+    for (uint32_t i = 0; i < MockResourceCount; ++i) {
+        fixture.resources[i].apiResource = &fixture.resources[i];
+        ffxBarrierResourceStateReset(&fixture.resources[i].barrierState, FFX_RESOURCE_STATE_COMPUTE_READ);
+    }
+
+    ffxBarrierPlannerInit(&fixture.planner, &fixture.resources[0].barrierState, sizeof(MockResource), recordBarriers, &fixture);
+    fixture.statistics         = {};
+    fixture.planner.statistics = &fixture.statistics;
+    fixture.commandList.flushes.clear();
+}
+
+static bool isRecord(const FfxBarrierRecord& record, FfxBarrierRecordType type, uint32_t flags, uint32_t resourceIndex, FfxResourceStates before, FfxResourceStates after)
+{
+    return record.type == type && record.flags == flags && record.resourceIndex == resourceIndex &&
+           (type != FFX_BARRIER_RECORD_TRANSITION || (record.stateBefore == before && record.stateAfter == after));
+}
+
+static void testMergedUavBarriers()
+{
+    PlannerFixture* fixture = new PlannerFixture;
+    initFixture(*fixture);
+    FfxBarrierPlanner* planner = &fixture->planner;
+    void* commandList = &fixture->commandList;
+
+    ffxBarrierResourceStateReset(&fixture->resources[1].barrierState, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    // several mips of one texture bound in a job need a single UAV barrier
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerMarkUavAccess(planner, 1);
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerFlush(planner, commandList);
+
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 1);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[0].size() == 1);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[0][0], FFX_BARRIER_RECORD_UAV, FFX_BARRIER_RECORD_FLAG_NONE, 1,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_UNORDERED_ACCESS));
+    FFX_TEST_EXPECT(fixture->statistics.uavBarriers == 1);
+    FFX_TEST_EXPECT(fixture->statistics.skippedUavBarriers == 1);
+    FFX_TEST_EXPECT(fixture->statistics.mergedBarriers == 1);
+
+    // not accessed since the last barrier, nothing to wait for
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 1);
+    FFX_TEST_EXPECT(fixture->statistics.skippedUavBarriers == 2);
+
+    // a transition out of UAV state also waits on the UAV accesses, it replaces the queued UAV barrier
+    ffxBarrierPlannerMarkUavAccess(planner, 1);
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerTransition(planner, commandList, 1, FFX_RESOURCE_STATE_COMPUTE_READ);
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 2);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[1].size() == 1);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[1][0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_NONE, 1,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_COMPUTE_READ));
+
+    delete fixture;
+}
+
+static void testDroppedTransitions()
+{
+    PlannerFixture* fixture = new PlannerFixture;
+    initFixture(*fixture);
+    FfxBarrierPlanner* planner = &fixture->planner;
+    void* commandList = &fixture->commandList;
+
+    // there and back again before a flush is a no-op
+    ffxBarrierPlannerTransition(planner, commandList, 2, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerTransition(planner, commandList, 2, FFX_RESOURCE_STATE_COMPUTE_READ);
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.empty());
+    FFX_TEST_EXPECT(fixture->statistics.flushCount == 0);
+    FFX_TEST_EXPECT(fixture->resources[2].barrierState.currentState == FFX_RESOURCE_STATE_COMPUTE_READ);
+
+    // a state the resource is already in needs no barrier
+    ffxBarrierPlannerTransition(planner, commandList, 2, FFX_RESOURCE_STATE_COMPUTE_READ);
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.empty());
+
+    // chained transitions fold into one
+    ffxBarrierPlannerTransition(planner, commandList, 2, FFX_RESOURCE_STATE_COPY_DEST);
+    ffxBarrierPlannerTransition(planner, commandList, 2, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerTransition(planner, commandList, 3, FFX_RESOURCE_STATE_COPY_SRC);
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 1);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[0].size() == 2);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[0][0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_NONE, 2,
+                             FFX_RESOURCE_STATE_COMPUTE_READ, FFX_RESOURCE_STATE_UNORDERED_ACCESS));
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[0][1], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_NONE, 3,
+                             FFX_RESOURCE_STATE_COMPUTE_READ, FFX_RESOURCE_STATE_COPY_SRC));
+    FFX_TEST_EXPECT(fixture->statistics.mergedBarriers == 2);
+
+    delete fixture;
+}
+
+// A compute job writing uavIndex (if not 0) and reading srvIndex (if not 0)
+static void setComputeJob(FfxGpuJobDescription& job, uint32_t uavIndex, uint32_t srvIndex)
+{
+    job.jobType = FFX_GPU_JOB_COMPUTE;
+    FfxComputeJobDescription& compute = job.computeJobDescriptor;
+    compute.pipeline.uavTextureCount = uavIndex ? 1 : 0;
+    compute.pipeline.srvTextureCount = srvIndex ? 1 : 0;
+    compute.uavTextures[0].resource.internalIndex = uavIndex;
+    compute.srvTextures[0].resource.internalIndex = srvIndex;
+}
+
+static void testSplitBarriers()
+{
+    PlannerFixture* fixture = new PlannerFixture;
+    initFixture(*fixture);
+    FfxBarrierPlanner* planner = &fixture->planner;
+    void* commandList = &fixture->commandList;
+
+    // job 0 writes 4 and 5, job 1 reads 5 right away, job 2 is unrelated, job 3 reads 4
+    std::vector<FfxGpuJobDescription> jobs(4);
+    setComputeJob(jobs[0], 4, 0);
+    jobs[0].computeJobDescriptor.pipeline.uavTextureCount = 2;
+    jobs[0].computeJobDescriptor.uavTextures[1].resource.internalIndex = 5;
+    setComputeJob(jobs[1], 0, 5);
+    setComputeJob(jobs[2], 6, 0);
+    setComputeJob(jobs[3], 0, 4);
+
+    ffxBarrierPlannerTransition(planner, commandList, 4, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerTransition(planner, commandList, 5, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerFlush(planner, commandList);
+    ffxBarrierPlannerBeginSplitBarriers(planner, commandList, jobs.data(), uint32_t(jobs.size()), 0);
+
+    // only 4 has jobs in between to overlap with
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 2);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[1].size() == 1);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[1][0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_BEGIN_ONLY, 4,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_COMPUTE_READ));
+    FFX_TEST_EXPECT(fixture->resources[4].barrierState.splitBarrierPending);
+    FFX_TEST_EXPECT(!fixture->resources[5].barrierState.splitBarrierPending);
+
+    // job 1 reads 5 with a plain transition, job 3 ends the split barrier of 4 without another transition
+    ffxBarrierPlannerTransition(planner, commandList, 5, FFX_RESOURCE_STATE_COMPUTE_READ);
+    ffxBarrierPlannerFlush(planner, commandList);
+    ffxBarrierPlannerTransition(planner, commandList, 4, FFX_RESOURCE_STATE_COMPUTE_READ);
+    ffxBarrierPlannerFlush(planner, commandList);
+
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 4);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[2][0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_NONE, 5,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_COMPUTE_READ));
+    FFX_TEST_EXPECT(fixture->commandList.flushes[3].size() == 1);
+    FFX_TEST_EXPECT(isRecord(fixture->commandList.flushes[3][0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_END_ONLY, 4,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_COMPUTE_READ));
+    FFX_TEST_EXPECT(fixture->statistics.splitBarriers == 1);
+    FFX_TEST_EXPECT(planner->splitBarrierCount == 0);
+
+    // a split barrier whose consumer is never reached is ended at the end of the batch
+    ffxBarrierPlannerTransition(planner, commandList, 4, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+    ffxBarrierPlannerBeginSplitBarriers(planner, commandList, jobs.data(), uint32_t(jobs.size()), 0);
+    ffxBarrierPlannerEndSplitBarriers(planner, commandList);
+    const std::vector<FfxBarrierRecord>& lastFlush = fixture->commandList.flushes.back();
+    FFX_TEST_EXPECT(lastFlush.size() == 1);
+    FFX_TEST_EXPECT(isRecord(lastFlush[0], FFX_BARRIER_RECORD_TRANSITION, FFX_BARRIER_RECORD_FLAG_END_ONLY, 4,
+                             FFX_RESOURCE_STATE_UNORDERED_ACCESS, FFX_RESOURCE_STATE_COMPUTE_READ));
+    FFX_TEST_EXPECT(!fixture->resources[4].barrierState.splitBarrierPending);
+
+    delete fixture;
+}
+
+static void testBarrierCap()
+{
+    PlannerFixture* fixture = new PlannerFixture;
+    initFixture(*fixture);
+    FfxBarrierPlanner* planner = &fixture->planner;
+    void* commandList = &fixture->commandList;
+
+    // a full queue is flushed before queuing more, nothing is lost or written past the end
+    const uint32_t transitionCount = FFX_MAX_BARRIERS + 5;
+    for (uint32_t i = 1; i <= transitionCount; ++i) {
+        ffxBarrierPlannerTransition(planner, commandList, i, FFX_RESOURCE_STATE_UNORDERED_ACCESS);
+        FFX_TEST_EXPECT(planner->barrierCount <= FFX_MAX_BARRIERS);
+    }
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 1);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[0].size() == FFX_MAX_BARRIERS);
+
+    ffxBarrierPlannerFlush(planner, commandList);
+    FFX_TEST_EXPECT(fixture->commandList.flushes.size() == 2);
+    FFX_TEST_EXPECT(fixture->commandList.flushes[1].size() == 5);
+    FFX_TEST_EXPECT(fixture->statistics.transitionBarriers == transitionCount);
+    FFX_TEST_EXPECT(fixture->statistics.flushCount == 2);
+
+    uint32_t transitioned = 0;
+    for (uint32_t i = 1; i <= transitionCount; ++i) {
+        transitioned += fixture->resources[i].barrierState.currentState == FFX_RESOURCE_STATE_UNORDERED_ACCESS ? 1 : 0;
+    }
+    FFX_TEST_EXPECT(transitioned == transitionCount);
+
+    delete fixture;
+}
+
+int main()
+{
+    testMergedUavBarriers();
+    testDroppedTransitions();
+    testSplitBarriers();
+    testBarrierCap();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,275 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_interface.h>
+#include <FidelityFX/host/ffx_opticalflow.h>
+#include <FidelityFX/gpu/fsr3upscaler/ffx_fsr3upscaler_resources.h>
+#include <FidelityFX/gpu/frameinterpolation/ffx_frameinterpolation_resources.h>
+#include <opticalflow/ffx_opticalflow_private.h>
+#include <ffx_binding_lookup.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// The binding tables the effects resolve against, each in its own namespace as they share type and table names
+namespace fsr3upscaler {
+#include <fsr3upscaler/ffx_fsr3upscaler_bindings.h>
+}
+namespace frameinterpolation {
+#include <frameinterpolation/ffx_frameinterpolation_bindings.h>
+}
+namespace opticalflow {
+#include <opticalflow/ffx_opticalflow_bindings.h>
+}
+
+// One name table of an effect, with the linear wcscmp scan patchResourceBindings did before FfxBindingLookup
+struct BindingTable
+{
+    template<typename TBinding, size_t N>
+    BindingTable(const TBinding (&table)[N]) : lookup(table)
+    {
+        for (size_t i = 0; i < N; ++i) {
+            names.push_back(table[i].name);
+            indices.push_back(table[i].index);
+        }
+    }
+
+    bool linearFind(const wchar_t* name, uint32_t* outIndex) const
+    {
+        for (size_t mapIndex = 0; mapIndex < names.size(); ++mapIndex) {
+            if (0 == wcscmp(names[mapIndex], name)) {
+                *outIndex = indices[mapIndex];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool linearResolve(FfxResourceBinding* bindings, uint32_t bindingCount) const
+    {
+        for (uint32_t i = 0; i < bindingCount; ++i) {
+            uint32_t index = 0;
+            if (!linearFind(bindings[i].name, &index))
+                return false;
+            bindings[i].resourceIdentifier = index;
+        }
+        return true;
+    }
+
+    FfxBindingLookup            lookup;
+    std::vector<const wchar_t*> names;
+    std::vector<uint32_t>       indices;
+};
+
+enum BindingType {
+    BindingSrv,
+    BindingUav,
+    BindingCb,
+    BindingTypeCount
+};
+
+// Binding names of one pass, as the shipped FFXRHIBackend pass reflects them (GetBoundSRVNames and friends)
+struct ShippedPass
+{
+    std::string                     file;
+    std::vector<std::wstring>       names[BindingTypeCount];
+};
+
+struct Effect
+{
+    const char*                     name;
+    const char*                     passDirectory;
+    const char*                     passPrefix;
+    const BindingTable*             tables[BindingTypeCount];
+    std::vector<ShippedPass>        passes;
+};
+
+// The wide string literals of every GetBound*Names() array in a pass source
+static std::vector<std::wstring> readBoundNames(const std::string& source, const char* function)
+{
+    std::vector<std::wstring> names;
+    for (size_t start = source.find(function); start != std::string::npos; start = source.find(function, start + 1)) {
+        const size_t end = source.find("return", start);
+        for (size_t literal = source.find("L\"", start); literal < end; literal = source.find("L\"", literal + 2)) {
+            const size_t close = source.find('"', literal + 2);
+            const std::string name = source.substr(literal + 2, close - literal - 2);
+            names.push_back(std::wstring(name.begin(), name.end()));
+        }
+    }
+    return names;
+}
+
+static void loadShippedPasses(Effect& effect)
+{
+    const std::filesystem::path directory = std::filesystem::path(FFX_PLUGIN_SOURCE_PATH) / effect.passDirectory;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        const std::string file = entry.path().filename().string();
+        if (file.rfind(effect.passPrefix, 0) != 0 || entry.path().extension() != ".cpp")
+            continue;
+
+        std::ifstream      stream(entry.path());
+        std::stringstream  source;
+        source << stream.rdbuf();
+
+        // the shader declarations next to the passes reflect nothing
+        if (source.str().find("GetBoundSRVNames()") == std::string::npos)
+            continue;
+
+        ShippedPass pass;
+        pass.file                 = file;
+        pass.names[BindingSrv]    = readBoundNames(source.str(), "GetBoundSRVNames()");
+        pass.names[BindingUav]    = readBoundNames(source.str(), "GetBoundUAVNames()");
+        pass.names[BindingCb]     = readBoundNames(source.str(), "GetBoundCBNames()");
+        effect.passes.push_back(pass);
+    }
+}
+
+// The bindings a pipeline of the pass arrives with at patchResourceBindings, identifiers not resolved yet
+static std::vector<FfxResourceBinding> makeBindings(const std::vector<std::wstring>& names)
+{
+    std::vector<FfxResourceBinding> bindings(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        memset(&bindings[i], 0, sizeof(FfxResourceBinding));
+        bindings[i].slotIndex = uint32_t(i);
+        wcsncpy(bindings[i].name, names[i].c_str(), FFX_RESOURCE_NAME_SIZE - 1);
+    }
+    return bindings;
+}
+
+static void testTable(const BindingTable& table)
+{
+    // every name of the table resolves to the entry the linear scan finds first
+    for (const wchar_t* name : table.names) {
+        uint32_t linearIndex = ~0u;
+        uint32_t lookupIndex = ~0u;
+        FFX_TEST_EXPECT(table.linearFind(name, &linearIndex));
+        FFX_TEST_EXPECT(table.lookup.find(name, &lookupIndex));
+        FFX_TEST_EXPECT(lookupIndex == linearIndex);
+    }
+
+    // names outside the table fail in both
+    uint32_t index = 0;
+    FFX_TEST_EXPECT(!table.lookup.find(L"", &index));
+    FFX_TEST_EXPECT(!table.lookup.find(L"r_not_a_binding", &index));
+    const std::wstring prefix = std::wstring(table.names[0]).substr(0, wcslen(table.names[0]) - 1);
+    FFX_TEST_EXPECT(table.lookup.find(prefix.c_str(), &index) == table.linearFind(prefix.c_str(), &index));
+}
+
+static void testShippedPasses(const Effect& effect)
+{
+    FFX_TEST_EXPECT(!effect.passes.empty());
+
+    for (const ShippedPass& pass : effect.passes) {
+        uint32_t bindingCount = 0;
+        for (int type = 0; type < BindingTypeCount; ++type) {
+            std::vector<FfxResourceBinding> linearBindings = makeBindings(pass.names[type]);
+            std::vector<FfxResourceBinding> lookupBindings = makeBindings(pass.names[type]);
+            const uint32_t                  count          = uint32_t(pass.names[type].size());
+
+            const bool linearResolved = effect.tables[type]->linearResolve(linearBindings.data(), count);
+            const bool lookupResolved = effect.tables[type]->lookup.resolve(lookupBindings.data(), count);
+            if (!linearResolved || !lookupResolved) {
+                fprintf(stderr, "%s: %s bindings do not all resolve\n", pass.file.c_str(), effect.name);
+            }
+            FFX_TEST_EXPECT(linearResolved && lookupResolved);
+
+            for (uint32_t i = 0; i < count; ++i) {
+                FFX_TEST_EXPECT(lookupBindings[i].resourceIdentifier == linearBindings[i].resourceIdentifier);
+            }
+            bindingCount += count;
+        }
+
+        // every shipped pass binds at least one resource and its constants
+        FFX_TEST_EXPECT(bindingCount > 0);
+        FFX_TEST_EXPECT(!pass.names[BindingCb].empty());
+    }
+}
+
+// Binding resolution of createPipelineStates for all shipped passes of an effect, with the wcscmp scan and with the lookup
+static void benchmarkEffect(const Effect& effect)
+{
+    const uint32_t iterations = 2000;
+
+    std::vector<std::vector<FfxResourceBinding>> bindings;
+    std::vector<const BindingTable*>             tables;
+    for (const ShippedPass& pass : effect.passes) {
+        for (int type = 0; type < BindingTypeCount; ++type) {
+            bindings.push_back(makeBindings(pass.names[type]));
+            tables.push_back(effect.tables[type]);
+        }
+    }
+
+    const auto linearStart = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        for (size_t i = 0; i < bindings.size(); ++i) {
+            tables[i]->linearResolve(bindings[i].data(), uint32_t(bindings[i].size()));
+        }
+    }
+    const double linearUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - linearStart).count() / iterations;
+
+    const auto lookupStart = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        for (size_t i = 0; i < bindings.size(); ++i) {
+            tables[i]->lookup.resolve(bindings[i].data(), uint32_t(bindings[i].size()));
+        }
+    }
+    const double lookupUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - lookupStart).count() / iterations;
+
+    printf("%s: %zu shipped passes, binding resolution per createPipelineStates %.2f us with wcscmp scans, %.2f us with lookups\n",
+           effect.name, effect.passes.size(), linearUs, lookupUs);
+}
+
+int main()
+{
+    const BindingTable fsr3upscalerSrv(fsr3upscaler::srvTextureBindingTable);
+    const BindingTable fsr3upscalerUav(fsr3upscaler::uavTextureBindingTable);
+    const BindingTable fsr3upscalerCb(fsr3upscaler::constantBufferBindingTable);
+    const BindingTable frameinterpolationSrv(frameinterpolation::srvResourceBindingTable);
+    const BindingTable frameinterpolationUav(frameinterpolation::uavResourceBindingTable);
+    const BindingTable frameinterpolationCb(frameinterpolation::cbResourceBindingTable);
+    const BindingTable opticalflowSrv(opticalflow::srvBindingNames);
+    const BindingTable opticalflowUav(opticalflow::uavBindingNames);
+    const BindingTable opticalflowCb(opticalflow::cbBindingNames);
+
+    Effect effects[] = {
+        {"FSR3 upscaler", "FFXFSR3TemporalUpscaling/Private", "FFXRHIBackendFSR", {&fsr3upscalerSrv, &fsr3upscalerUav, &fsr3upscalerCb}, {}},
+        {"Frame interpolation", "FFXFrameInterpolation/Private", "FFXRHIBackendFI", {&frameinterpolationSrv, &frameinterpolationUav, &frameinterpolationCb}, {}},
+        {"Optical flow", "FFXFrameInterpolation/Private", "FFXRHIBackendOpticalFlow", {&opticalflowSrv, &opticalflowUav, &opticalflowCb}, {}},
+    };
+
+    for (Effect& effect : effects) {
+        for (const BindingTable* table : effect.tables) {
+            testTable(*table);
+        }
+        loadShippedPasses(effect);
+        testShippedPasses(effect);
+        benchmarkEffect(effect);
+    }
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,307 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_cacao.h>
+#include "ffx_cacao_private.h"
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Mock backend which creates no GPU objects, it only tracks the bytes of every internal resource CACAO creates
+typedef struct MockCacaoBackend {
+    std::vector<uint64_t> resourceBytes;     // indexed by FfxResourceInternal::internalIndex, 0 is never handed out
+    uint64_t              liveBytes;
+    uint64_t              peakBytes;
+    uint32_t              resourcesCreated;
+    uint32_t              pipelinesCreated;
+} MockCacaoBackend;
+
+static uint32_t surfaceFormatBytes(FfxSurfaceFormat format)
+{
+    switch (format) {
+    case FFX_SURFACE_FORMAT_R32_UINT:
+    case FFX_SURFACE_FORMAT_R8G8B8A8_SNORM:
+        return 4;
+    case FFX_SURFACE_FORMAT_R16_FLOAT:
+    case FFX_SURFACE_FORMAT_R8G8_UNORM:
+        return 2;
+    case FFX_SURFACE_FORMAT_R8_UNORM:
+        return 1;
+    default:
+        FFX_TEST_EXPECT(!"surface format without a size in the mock backend");
+        return 0;
+    }
+}
+
+static MockCacaoBackend* getMockBackend(FfxInterface* backendInterface)
+{
+    return (MockCacaoBackend*)backendInterface->scratchBuffer;
+}
+
+static FfxVersionNumber mockGetSDKVersion(FfxInterface* backendInterface)
+{
+    return FFX_SDK_MAKE_VERSION(1, 1, 1);
+}
+
+static FfxErrorCode mockGetDeviceCapabilities(FfxInterface* backendInterface, FfxDeviceCapabilities* outDeviceCapabilities)
+{
+    memset(outDeviceCapabilities, 0, sizeof(FfxDeviceCapabilities));
+    outDeviceCapabilities->maximumSupportedShaderModel = FFX_SHADER_MODEL_6_6;
+    outDeviceCapabilities->waveLaneCountMin            = 32;
+    outDeviceCapabilities->waveLaneCountMax            = 64;
+    outDeviceCapabilities->fp16Supported               = true;
+    return FFX_OK;
+}
+
+static FfxErrorCode mockCreateBackendContext(FfxInterface* backendInterface, FfxEffect effect, FfxEffectBindlessConfig* bindlessConfig, FfxUInt32* effectContextId)
+{
+    *effectContextId = 0;
+    return FFX_OK;
+}
+
+static FfxErrorCode mockDestroyBackendContext(FfxInterface* backendInterface, FfxUInt32 effectContextId)
+{
+    return FFX_OK;
+}
+
+static FfxErrorCode mockCreateResource(FfxInterface* backendInterface, const FfxCreateResourceDescription* createResourceDescription, FfxUInt32 effectContextId, FfxResourceInternal* outResource)
+{
+    MockCacaoBackend*             backend     = getMockBackend(backendInterface);
+    const FfxResourceDescription& description = createResourceDescription->resourceDescription;
+
+    // every mip of every slice, the way the backends size the committed resource
+    uint64_t bytes = 0;
+    for (uint32_t mip = 0; mip < description.mipCount; ++mip) {
+        const uint64_t width  = (description.width >> mip) ? (description.width >> mip) : 1;
+        const uint64_t height = (description.height >> mip) ? (description.height >> mip) : 1;
+        bytes += width * height;
+    }
+    bytes *= description.depth * surfaceFormatBytes(description.format);
+
+    outResource->internalIndex = int32_t(backend->resourceBytes.size());
+    backend->resourceBytes.push_back(bytes);
+    backend->liveBytes += bytes;
+    backend->peakBytes = (backend->liveBytes > backend->peakBytes) ? backend->liveBytes : backend->peakBytes;
+    ++backend->resourcesCreated;
+    return FFX_OK;
+}
+
+static FfxErrorCode mockDestroyResource(FfxInterface* backendInterface, FfxResourceInternal resource, FfxUInt32 effectContextId)
+{
+    MockCacaoBackend* backend = getMockBackend(backendInterface);
+
+    // CACAO releases every slot of its texture table, including the ones it never created
+    if (resource.internalIndex > 0 && size_t(resource.internalIndex) < backend->resourceBytes.size()) {
+        backend->liveBytes -= backend->resourceBytes[resource.internalIndex];
+        backend->resourceBytes[resource.internalIndex] = 0;
+    }
+    return FFX_OK;
+}
+
+static FfxErrorCode mockCreatePipeline(FfxInterface* backendInterface, FfxEffect effect, FfxPass pass, uint32_t permutationOptions, const FfxPipelineDescription* pipelineDescription, FfxUInt32 effectContextId, FfxPipelineState* outPipeline)
+{
+    memset(outPipeline, 0, sizeof(FfxPipelineState));
+    ++getMockBackend(backendInterface)->pipelinesCreated;
+    return FFX_OK;
+}
+
+static FfxErrorCode mockDestroyPipeline(FfxInterface* backendInterface, FfxPipelineState* pipeline, FfxUInt32 effectContextId)
+{
+    return FFX_OK;
+}
+
+static void initMockBackend(FfxInterface* backendInterface, MockCacaoBackend* backend)
+{
+    memset(backendInterface, 0, sizeof(FfxInterface));
+    backendInterface->fpGetSDKVersion         = mockGetSDKVersion;
+    backendInterface->fpGetDeviceCapabilities = mockGetDeviceCapabilities;
+    backendInterface->fpCreateBackendContext  = mockCreateBackendContext;
+    backendInterface->fpDestroyBackendContext = mockDestroyBackendContext;
+    backendInterface->fpCreateResource        = mockCreateResource;
+    backendInterface->fpDestroyResource       = mockDestroyResource;
+    backendInterface->fpCreatePipeline        = mockCreatePipeline;
+    backendInterface->fpDestroyPipeline       = mockDestroyPipeline;
+    backendInterface->scratchBuffer           = backend;
+    backendInterface->scratchBufferSize       = sizeof(MockCacaoBackend);
+
+    backend->resourceBytes.assign(1, 0);
+    backend->liveBytes        = 0;
+    backend->peakBytes        = 0;
+    backend->resourcesCreated = 0;
+    backend->pipelinesCreated = 0;
+}
+
+static FfxCacaoContextDescription makeContextDescription(MockCacaoBackend* backend, uint32_t width, uint32_t height, bool useDownsampledSsao, bool allowSsaoResolutionSwitch)
+{
+    FfxCacaoContextDescription contextDescription = {};
+    initMockBackend(&contextDescription.backendInterface, backend);
+    contextDescription.width                     = width;
+    contextDescription.height                    = height;
+    contextDescription.useDownsampledSsao        = useDownsampledSsao;
+    contextDescription.allowSsaoResolutionSwitch = allowSsaoResolutionSwitch;
+    return contextDescription;
+}
+
+// Bytes of all internal resources of a context created at one SSAO resolution, with or without the other resolution's set
+static uint64_t contextBytes(uint32_t width, uint32_t height, bool useDownsampledSsao, bool allowSsaoResolutionSwitch)
+{
+    MockCacaoBackend                 backend;
+    const FfxCacaoContextDescription contextDescription = makeContextDescription(&backend, width, height, useDownsampledSsao, allowSsaoResolutionSwitch);
+
+    std::unique_ptr<FfxCacaoContext> context(new FfxCacaoContext);
+    FFX_TEST_EXPECT(ffxCacaoContextCreate(context.get(), &contextDescription) == FFX_OK);
+    const uint64_t bytes = backend.liveBytes;
+    FFX_TEST_EXPECT(ffxCacaoContextDestroy(context.get()) == FFX_OK);
+    FFX_TEST_EXPECT(backend.liveBytes == 0);
+
+    return bytes;
+}
+
+static void testResolutionSwitchMemory()
+{
+    const uint32_t width  = 1920;
+    const uint32_t height = 1080;
+
+    const uint64_t nativeBytes      = contextBytes(width, height, false, false);
+    const uint64_t downsampledBytes = contextBytes(width, height, true, false);
+    FFX_TEST_EXPECT(downsampledBytes < nativeBytes);
+
+    // a switchable context holds both resolution dependent sets, whichever resolution it starts at, and nothing more
+    const uint64_t loadCounterBytes = 4;
+    const uint64_t switchableBytes  = nativeBytes + downsampledBytes - loadCounterBytes;
+    FFX_TEST_EXPECT(contextBytes(width, height, false, true) == switchableBytes);
+    FFX_TEST_EXPECT(contextBytes(width, height, true, true) == switchableBytes);
+
+    printf("CACAO %ux%u internal resources: native %.1f MB, downsampled %.1f MB, switchable %.1f MB (+%.0f%% over native)\n",
+           width, height, nativeBytes / 1048576.0, downsampledBytes / 1048576.0, switchableBytes / 1048576.0,
+           100.0 * double(switchableBytes - nativeBytes) / double(nativeBytes));
+}
+
+static void testResolutionSwitch()
+{
+    MockCacaoBackend                 backend;
+    const FfxCacaoContextDescription contextDescription = makeContextDescription(&backend, 1280, 720, false, true);
+
+    std::unique_ptr<FfxCacaoContext> context(new FfxCacaoContext);
+    FFX_TEST_EXPECT(ffxCacaoContextCreate(context.get(), &contextDescription) == FFX_OK);
+
+    const FfxCacaoContext_Private* contextPrivate   = (const FfxCacaoContext_Private*)context.get();
+    const uint32_t                 resourcesCreated = backend.resourcesCreated;
+    const uint32_t                 pipelinesCreated = backend.pipelinesCreated;
+    const FfxCacaoBufferSizeInfo   nativeSizeInfo   = contextPrivate->bufferSizeInfo;
+    const int32_t                  nativePing       = contextPrivate->textures[FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING].internalIndex;
+    const int32_t                  downsampledPing  = contextPrivate->alternateTextures[FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING].internalIndex;
+    FFX_TEST_EXPECT(nativePing != downsampledPing);
+
+    // switching swaps the texture sets and the size info, it creates nothing
+    FFX_TEST_EXPECT(ffxCacaoUpdateSettings(context.get(), &FFX_CACAO_DEFAULT_SETTINGS, true) == FFX_OK);
+    FFX_TEST_EXPECT(contextPrivate->useDownsampledSsao);
+    FFX_TEST_EXPECT(contextPrivate->textures[FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING].internalIndex == downsampledPing);
+    FFX_TEST_EXPECT(contextPrivate->alternateTextures[FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING].internalIndex == nativePing);
+    FFX_TEST_EXPECT(contextPrivate->bufferSizeInfo.ssaoBufferWidth < nativeSizeInfo.ssaoBufferWidth);
+
+    FFX_TEST_EXPECT(ffxCacaoUpdateSettings(context.get(), &FFX_CACAO_DEFAULT_SETTINGS, false) == FFX_OK);
+    FFX_TEST_EXPECT(contextPrivate->textures[FFX_CACAO_RESOURCE_IDENTIFIER_SSAO_BUFFER_PING].internalIndex == nativePing);
+    FFX_TEST_EXPECT(memcmp(&contextPrivate->bufferSizeInfo, &nativeSizeInfo, sizeof(nativeSizeInfo)) == 0);
+
+    FFX_TEST_EXPECT(backend.resourcesCreated == resourcesCreated);
+    FFX_TEST_EXPECT(backend.pipelinesCreated == pipelinesCreated);
+
+    // both sets are released with the context
+    FFX_TEST_EXPECT(ffxCacaoContextDestroy(context.get()) == FFX_OK);
+    FFX_TEST_EXPECT(backend.liveBytes == 0);
+}
+
+static void testResolutionSwitchNotAllowed()
+{
+    MockCacaoBackend                 backend;
+    const FfxCacaoContextDescription contextDescription = makeContextDescription(&backend, 1280, 720, false, false);
+
+    std::unique_ptr<FfxCacaoContext> context(new FfxCacaoContext);
+    FFX_TEST_EXPECT(ffxCacaoContextCreate(context.get(), &contextDescription) == FFX_OK);
+
+    const FfxCacaoContext_Private* contextPrivate = (const FfxCacaoContext_Private*)context.get();
+    FFX_TEST_EXPECT(ffxCacaoUpdateSettings(context.get(), &FFX_CACAO_DEFAULT_SETTINGS, true) == FfxErrorCode(FFX_ERROR_INVALID_ARGUMENT));
+    FFX_TEST_EXPECT(!contextPrivate->useDownsampledSsao);
+
+    // other settings still update at the creation resolution
+    FFX_TEST_EXPECT(ffxCacaoUpdateSettings(context.get(), &FFX_CACAO_DEFAULT_SETTINGS, false) == FFX_OK);
+
+    FFX_TEST_EXPECT(ffxCacaoContextDestroy(context.get()) == FFX_OK);
+    FFX_TEST_EXPECT(backend.liveBytes == 0);
+}
+
+// Cost of one SSAO resolution change: swapping through ffxCacaoUpdateSettings, and recreating the context at the other
+// resolution as callers had to before. Against the mock backend this is CPU time only, a real backend adds the GPU
+// allocations and the pipeline creation of every recreate on top.
+static void benchmarkResolutionSwitch()
+{
+    const uint32_t width  = 1920;
+    const uint32_t height = 1080;
+
+    MockCacaoBackend           backend;
+    FfxCacaoContextDescription contextDescription = makeContextDescription(&backend, width, height, false, true);
+
+    std::unique_ptr<FfxCacaoContext> context(new FfxCacaoContext);
+    FFX_TEST_EXPECT(ffxCacaoContextCreate(context.get(), &contextDescription) == FFX_OK);
+
+    const uint32_t switchIterations = 200000;
+    auto           start            = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < switchIterations; ++iteration) {
+        ffxCacaoUpdateSettings(context.get(), &FFX_CACAO_DEFAULT_SETTINGS, (iteration & 1) == 0);
+    }
+    const double switchNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / switchIterations;
+    const uint32_t switchResources = backend.resourcesCreated;
+    FFX_TEST_EXPECT(ffxCacaoContextDestroy(context.get()) == FFX_OK);
+
+    contextDescription = makeContextDescription(&backend, width, height, false, false);
+    FFX_TEST_EXPECT(ffxCacaoContextCreate(context.get(), &contextDescription) == FFX_OK);
+
+    const uint32_t recreateIterations = 200;
+    start                             = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < recreateIterations; ++iteration) {
+        ffxCacaoContextDestroy(context.get());
+        contextDescription.useDownsampledSsao = (iteration & 1) == 0;
+        ffxCacaoContextCreate(context.get(), &contextDescription);
+    }
+    const double recreateNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / recreateIterations;
+    const double recreateResources = double(backend.resourcesCreated) / (recreateIterations + 1);
+    const double recreatePipelines = double(backend.pipelinesCreated) / (recreateIterations + 1);
+    FFX_TEST_EXPECT(ffxCacaoContextDestroy(context.get()) == FFX_OK);
+
+    printf("CACAO SSAO resolution change at %ux%u: ffxCacaoUpdateSettings %.1f ns (%u resources created at context creation, none after), "
+           "recreating the context %.1f us (%.0f resources and %.0f pipelines created each time)\n",
+           width, height, switchNs, switchResources, recreateNs / 1000.0, recreateResources, recreatePipelines);
+}
+
+int main()
+{
+    testResolutionSwitchMemory();
+    testResolutionSwitch();
+    testResolutionSwitchNotAllowed();
+    benchmarkResolutionSwitch();
+
+    return FFX_TEST_RESULT();
+}
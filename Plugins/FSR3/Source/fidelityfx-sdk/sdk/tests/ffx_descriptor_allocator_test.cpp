@@ -0,0 +1,177 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_descriptor_allocator.h>
+#include "ffx_test.h"
+
+#include <vector>
+
+static void testLowestFitAndCoalescing()
+{
+    FfxDescriptorRange storage[4];
+    FfxDescriptorAllocator allocator;
+    ffxDescriptorAllocatorInit(&allocator, 100, 64, storage, 4);
+
+    uint32_t a = 0, b = 0, c = 0;
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 16, &a) && a == 100);
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 16, &b) && b == 116);
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 16, &c) && c == 132);
+
+    // a hole in the middle is reused before the tail
+    ffxDescriptorAllocatorFree(&allocator, b, 16);
+    FfxDescriptorAllocatorStatistics statistics = {};
+    ffxDescriptorAllocatorGetStatistics(&allocator, &statistics);
+    FFX_TEST_EXPECT(statistics.freeRangeCount == 2);
+    FFX_TEST_EXPECT(statistics.largestFreeRange == 16);
+    FFX_TEST_EXPECT(statistics.fragmentation > 0.0f);
+
+    uint32_t d = 0;
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 8, &d) && d == 116);
+
+    // freeing every neighbour merges everything back into one range
+    ffxDescriptorAllocatorFree(&allocator, a, 16);
+    ffxDescriptorAllocatorFree(&allocator, c, 16);
+    ffxDescriptorAllocatorFree(&allocator, d, 8);
+    ffxDescriptorAllocatorGetStatistics(&allocator, &statistics);
+    FFX_TEST_EXPECT(statistics.freeRangeCount == 1);
+    FFX_TEST_EXPECT(statistics.largestFreeRange == 64);
+    FFX_TEST_EXPECT(statistics.allocatedDescriptors == 0);
+    FFX_TEST_EXPECT(statistics.peakAllocatedDescriptors == 48);
+    FFX_TEST_EXPECT(statistics.highWaterMark == 48);
+    FFX_TEST_EXPECT(statistics.fragmentation == 0.0f);
+}
+
+static void testExhaustion()
+{
+    FfxDescriptorRange storage[2];
+    FfxDescriptorAllocator allocator;
+    ffxDescriptorAllocatorInit(&allocator, 0, 32, storage, 2);
+
+    uint32_t start = 0;
+    FFX_TEST_EXPECT(!ffxDescriptorAllocatorAllocate(&allocator, 33, &start));
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 32, &start) && start == 0);
+    FFX_TEST_EXPECT(!ffxDescriptorAllocatorAllocate(&allocator, 1, &start));
+
+    FfxDescriptorAllocatorStatistics statistics = {};
+    ffxDescriptorAllocatorGetStatistics(&allocator, &statistics);
+    FFX_TEST_EXPECT(statistics.failedAllocations == 2);
+    FFX_TEST_EXPECT(statistics.freeRangeCount == 0);
+
+    // zero sized blocks (contexts without bindless resources) always succeed and take nothing
+    FFX_TEST_EXPECT(ffxDescriptorAllocatorAllocate(&allocator, 0, &start));
+    ffxDescriptorAllocatorFree(&allocator, start, 0);
+}
+
+// Create/destroy churn like repeated context resizes, checked against a brute-force occupancy map
+static void testChurnAgainstOccupancyModel()
+{
+    const uint32_t base       = 1000;
+    const uint32_t capacity   = 4096;
+    const uint32_t maxLive    = 16;
+
+    // the backend sizes the free list for maxContexts + 1 ranges
+    std::vector<FfxDescriptorRange> storage(maxLive + 1);
+    FfxDescriptorAllocator allocator;
+    ffxDescriptorAllocatorInit(&allocator, base, capacity, storage.data(), maxLive + 1);
+
+    struct Block { uint32_t start; uint32_t size; };
+    std::vector<Block> live;
+    std::vector<bool>  occupied(capacity, false);
+
+    uint32_t random = 12345;
+    auto next = [&random]() { random = random * 1664525u + 1013904223u; return random >> 8; };
+
+    for (uint32_t iteration = 0; iteration < 20000; ++iteration) {
+
+        const bool allocate = live.empty() || (live.size() < maxLive && (next() & 1));
+        if (allocate) {
+
+            const uint32_t size = 1 + next() % 512;
+            uint32_t start = 0;
+            const bool allocated = ffxDescriptorAllocatorAllocate(&allocator, size, &start);
+
+            // the lowest free run of the model that fits must be what the allocator returned
+            uint32_t expectedStart = UINT32_MAX;
+            for (uint32_t offset = 0, run = 0; offset < capacity; ++offset) {
+                run = occupied[offset] ? 0 : run + 1;
+                if (run == size) {
+                    expectedStart = offset + 1 - size;
+                    break;
+                }
+            }
+
+            FFX_TEST_EXPECT(allocated == (expectedStart != UINT32_MAX));
+            if (allocated) {
+                FFX_TEST_EXPECT(start == base + expectedStart);
+                for (uint32_t offset = start - base; offset < start - base + size; ++offset) {
+                    FFX_TEST_EXPECT(!occupied[offset]);
+                    occupied[offset] = true;
+                }
+                live.push_back({ start, size });
+            }
+        }
+        else {
+
+            const size_t index = next() % live.size();
+            ffxDescriptorAllocatorFree(&allocator, live[index].start, live[index].size);
+            for (uint32_t offset = live[index].start - base; offset < live[index].start - base + live[index].size; ++offset) {
+                occupied[offset] = false;
+            }
+            live[index] = live.back();
+            live.pop_back();
+        }
+
+        // free ranges are sorted, disjoint, never adjacent and match the model
+        uint32_t freeDescriptors = 0;
+        for (uint32_t i = 0; i < allocator.freeRangeCount; ++i) {
+            const FfxDescriptorRange& range = allocator.freeRanges[i];
+            FFX_TEST_EXPECT(range.size > 0);
+            FFX_TEST_EXPECT(i == 0 || allocator.freeRanges[i - 1].start + allocator.freeRanges[i - 1].size < range.start);
+            freeDescriptors += range.size;
+        }
+        FFX_TEST_EXPECT(allocator.freeRangeCount <= live.size() + 1);
+        FFX_TEST_EXPECT(freeDescriptors + allocator.allocatedDescriptors == capacity);
+
+        if (s_ffxTestFailures) {
+            return;
+        }
+    }
+
+    for (const Block& block : live) {
+        ffxDescriptorAllocatorFree(&allocator, block.start, block.size);
+    }
+
+    FfxDescriptorAllocatorStatistics statistics = {};
+    ffxDescriptorAllocatorGetStatistics(&allocator, &statistics);
+    FFX_TEST_EXPECT(statistics.freeRangeCount == 1);
+    FFX_TEST_EXPECT(statistics.largestFreeRange == capacity);
+    FFX_TEST_EXPECT(statistics.highWaterMark <= capacity);
+}
+
+int main()
+{
+    testLowestFitAndCoalescing();
+    testExhaustion();
+    testChurnAgainstOccupancyModel();
+
+    return FFX_TEST_RESULT();
+}
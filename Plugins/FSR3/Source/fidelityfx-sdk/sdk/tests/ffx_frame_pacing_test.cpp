@@ -0,0 +1,169 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_frame_pacing.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+static const double s_interpolationTime = 0.002;
+static const double s_presentTime       = 0.0005;
+
+static FfxFramePacingSimulationResult simulate(const std::vector<double>& frameTimes, const bool* resets, double presentTime, std::vector<FfxFramePacingPresent>* outPresents)
+{
+    FfxFramePacingSimulationDescription description = {};
+    description.frameTimes        = frameTimes.data();
+    description.resets            = resets;
+    description.frameCount        = uint32_t(frameTimes.size());
+    description.interpolationTime = s_interpolationTime;
+    description.presentTime       = presentTime;
+
+    FfxFramePacingSimulationResult result = {};
+    if (outPresents) {
+        outPresents->resize(frameTimes.size() * 2);
+        result.presents        = outPresents->data();
+        result.presentCapacity = uint32_t(outPresents->size());
+    }
+    FFX_TEST_EXPECT(ffxFramePacingSimulate(&description, &result));
+    return result;
+}
+
+// Frame times around frameTime with a deterministic noise of +-noise
+static std::vector<double> makeTrace(uint32_t frameCount, double frameTime, double noise)
+{
+    std::vector<double> frameTimes(frameCount);
+    uint32_t random = 42;
+    for (double& time : frameTimes) {
+        random = random * 1664525u + 1013904223u;
+        time   = frameTime + noise * (double(random >> 8) / double(1u << 24) * 2.0 - 1.0);
+    }
+    return frameTimes;
+}
+
+static void testEstimator()
+{
+    const int64_t frequency = FFX_FRAME_PACING_SIMULATION_FREQUENCY;
+    const int64_t delta     = frequency / 30;
+
+    FfxFramePacingEstimator estimator = {};
+    ffxFramePacingEstimatorReset(&estimator);
+    for (uint32_t i = 0; i + 1 < FFX_FRAME_PACING_HISTORY_SIZE; ++i) {
+        FFX_TEST_EXPECT(ffxFramePacingEstimatorUpdate(&estimator, delta, frequency, false) == 0);
+    }
+
+    // half the frame time, less the safety margin
+    const int64_t expectedDelay = delta / 2 - frequency / 10000;
+    FFX_TEST_EXPECT(ffxFramePacingEstimatorUpdate(&estimator, delta, frequency, false) == expectedDelay);
+
+    // a hitch above 100ms and a reset both restart the averaging
+    FFX_TEST_EXPECT(ffxFramePacingEstimatorUpdate(&estimator, frequency / 5, frequency, false) == 0);
+    for (uint32_t i = 0; i < FFX_FRAME_PACING_HISTORY_SIZE; ++i) {
+        ffxFramePacingEstimatorUpdate(&estimator, delta, frequency, false);
+    }
+    FFX_TEST_EXPECT(ffxFramePacingEstimatorUpdate(&estimator, delta, frequency, true) == 0);
+}
+
+static void testSteadyTrace()
+{
+    const std::vector<double> frameTimes = makeTrace(600, 1.0 / 30.0, 0.0);
+
+    std::vector<FfxFramePacingPresent> presents;
+    const FfxFramePacingSimulationResult result = simulate(frameTimes, nullptr, s_presentTime, &presents);
+
+    // every frame is presented with its interpolated frame, halfway between the real ones
+    FFX_TEST_EXPECT(result.presentCount == 1200);
+    FFX_TEST_EXPECT(result.droppedFrames == 0);
+    FFX_TEST_EXPECT(fabs(result.meanPresentInterval - 1.0 / 60.0) < 0.0002);
+    FFX_TEST_EXPECT(fabs(result.averageFrameTimeMs - 1000.0 / 30.0) < 0.001);
+    FFX_TEST_EXPECT(presents[0].interpolated && !presents[1].interpolated && presents[1].frameIndex == 0);
+
+    // once the averaging has warmed up the interpolated frame sits in the middle
+    for (uint32_t frame = FFX_FRAME_PACING_HISTORY_SIZE + 1; frame < 600; ++frame) {
+        const double interpolatedToReal = presents[2 * frame + 1].time - presents[2 * frame].time;
+        FFX_TEST_EXPECT(fabs(interpolatedToReal - 1.0 / 60.0) < 0.0002);
+    }
+
+    // the same trace always produces the same schedule
+    std::vector<FfxFramePacingPresent> replay;
+    simulate(frameTimes, nullptr, s_presentTime, &replay);
+    FFX_TEST_EXPECT(replay.size() == presents.size());
+    FFX_TEST_EXPECT(memcmp(replay.data(), presents.data(), presents.size() * sizeof(FfxFramePacingPresent)) == 0);
+}
+
+static void testJitterAndDrops()
+{
+    // long enough for the unpaced warm-up frames to stay out of the 99th percentile
+    const FfxFramePacingSimulationResult steady = simulate(makeTrace(6000, 1.0 / 30.0, 0.0), nullptr, s_presentTime, nullptr);
+    FFX_TEST_EXPECT(steady.p99IntervalDelta < 0.0005);    // only the safety margin taken off the delay
+
+    // noisy frame times show up in the present jitter
+    const FfxFramePacingSimulationResult noisy = simulate(makeTrace(6000, 1.0 / 30.0, 0.004), nullptr, s_presentTime, nullptr);
+    FFX_TEST_EXPECT(noisy.presentIntervalStdDev > steady.presentIntervalStdDev);
+    FFX_TEST_EXPECT(noisy.p99IntervalDelta > steady.p99IntervalDelta);
+    FFX_TEST_EXPECT(noisy.maxIntervalDelta >= noisy.p99IntervalDelta);
+
+    // a presenter slower than the frames replaces the frames it cannot keep up with
+    const FfxFramePacingSimulationResult overloaded = simulate(makeTrace(600, 1.0 / 120.0, 0.0), nullptr, 0.006, nullptr);
+    FFX_TEST_EXPECT(overloaded.droppedFrames > 0);
+    FFX_TEST_EXPECT(overloaded.presentCount == 2 * (600 - overloaded.droppedFrames));
+
+    // resets restart the pacing, so the frames after them are presented back to back
+    std::vector<double> frameTimes = makeTrace(100, 1.0 / 30.0, 0.0);
+    bool resets[100] = {};
+    resets[50] = true;
+    std::vector<FfxFramePacingPresent> presents;
+    simulate(frameTimes, resets, s_presentTime, &presents);
+    FFX_TEST_EXPECT(fabs(presents[2 * 50 + 1].time - presents[2 * 50].time - s_presentTime) < 1e-6);
+
+    FFX_TEST_EXPECT(!ffxFramePacingSimulate(nullptr, nullptr));
+}
+
+// Cost of replaying a long capture, so pacing changes can be compared on CI
+static void benchmarkSimulation()
+{
+    const std::vector<double> frameTimes = makeTrace(100000, 1.0 / 45.0, 0.006);
+
+    const uint32_t iterations = 10;
+    FfxFramePacingSimulationResult result = {};
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        result = simulate(frameTimes, nullptr, s_presentTime, nullptr);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("pacing simulation: %.1f ns per frame, %u presents, %u dropped, interval stddev %.3f ms, p99 delta %.3f ms\n",
+           seconds * 1e9 / (double(iterations) * frameTimes.size()), result.presentCount, result.droppedFrames,
+           result.presentIntervalStdDev * 1000.0, result.p99IntervalDelta * 1000.0);
+}
+
+int main()
+{
+    testEstimator();
+    testSteadyTrace();
+    testJitterAndDrops();
+    benchmarkSimulation();
+
+    return FFX_TEST_RESULT();
+}
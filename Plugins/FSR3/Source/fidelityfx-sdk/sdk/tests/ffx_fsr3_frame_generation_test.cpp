@@ -0,0 +1,262 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Several FSR3 contexts with frame generation enabled, dispatched concurrently from one thread each.
+// ffx_fsr3.cpp is linked against mocks of the backend interface and of the upscaler, optical flow and
+// frame interpolation components, which record the command lists they are dispatched with.
+
+#include <FidelityFX/host/ffx_fsr3.h>
+#include "ffx_fsr3_private.h"
+#include "ffx_test.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+static const uint32_t s_contextCount       = 4;
+static const uint32_t s_dispatchesPerFrame = 2;      // optical flow and frame interpolation
+static const uint32_t s_frameCount         = 2000;
+static const uint32_t s_workPerDispatch    = 20000;
+
+// State the component mocks keep in the opaque storage of their context
+struct MockEffectContext
+{
+    FfxCommandList  commandList;                    // the command list of the first dispatch
+    uint32_t        dispatchCount;
+    uint32_t        foreignDispatchCount;           // dispatches recorded into another context's command list
+    uint32_t        workResult;
+};
+static_assert(sizeof(MockEffectContext) <= sizeof(FfxOpticalflowContext), "mock state does not fit the context storage");
+static_assert(sizeof(MockEffectContext) <= sizeof(FfxFrameInterpolationContext), "mock state does not fit the context storage");
+
+// Stands in for the CPU side of recording a dispatch
+static void mockDispatch(void* contextStorage, FfxCommandList commandList)
+{
+    MockEffectContext* mock = reinterpret_cast<MockEffectContext*>(contextStorage);
+    if (!mock->commandList) {
+        mock->commandList = commandList;
+    }
+    mock->foreignDispatchCount += (mock->commandList != commandList) ? 1 : 0;
+    ++mock->dispatchCount;
+
+    uint32_t hash = mock->workResult;
+    for (uint32_t i = 0; i < s_workPerDispatch; ++i) {
+        hash = hash * 2654435761u + i;
+    }
+    mock->workResult = hash;
+}
+
+// Backend interface mock
+static std::atomic<uint32_t> s_nextBackendContextId{ 0 };
+static std::atomic<uint32_t> s_liveBackendContexts{ 0 };
+static std::atomic<int32_t>  s_nextResource{ 1 };
+
+static FfxVersionNumber mockGetSDKVersion(FfxInterface*) { return FFX_SDK_MAKE_VERSION(1, 1, 0); }
+static FfxErrorCode mockGetDeviceCapabilities(FfxInterface*, FfxDeviceCapabilities*) { return FFX_OK; }
+static FfxErrorCode mockCreateBackendContext(FfxInterface*, FfxEffect, FfxEffectBindlessConfig*, FfxUInt32* effectContextId)
+{
+    *effectContextId = s_nextBackendContextId++;
+    ++s_liveBackendContexts;
+    return FFX_OK;
+}
+static FfxErrorCode mockDestroyBackendContext(FfxInterface*, FfxUInt32)
+{
+    --s_liveBackendContexts;
+    return FFX_OK;
+}
+static FfxErrorCode mockCreateResource(FfxInterface*, const FfxCreateResourceDescription*, FfxUInt32, FfxResourceInternal* outResource)
+{
+    outResource->internalIndex = s_nextResource++;
+    return FFX_OK;
+}
+static FfxErrorCode mockDestroyResource(FfxInterface*, FfxResourceInternal, FfxUInt32) { return FFX_OK; }
+static FfxResource mockGetResource(FfxInterface*, FfxResourceInternal resource)
+{
+    FfxResource result = {};
+    result.resource = reinterpret_cast<void*>(intptr_t(resource.internalIndex));
+    return result;
+}
+static FfxErrorCode mockSwapChainConfigureFrameGeneration(FfxFrameGenerationConfig const*) { return FFX_OK; }
+
+// Component mocks, replacing the effects ffx_fsr3.cpp builds on
+FfxErrorCode ffxFsr3UpscalerContextCreate(FfxFsr3UpscalerContext* pContext, const FfxFsr3UpscalerContextDescription*) { memset(pContext, 0, sizeof(*pContext)); return FFX_OK; }
+FfxErrorCode ffxFsr3UpscalerContextDestroy(FfxFsr3UpscalerContext*) { return FFX_OK; }
+FfxErrorCode ffxFsr3UpscalerContextDispatch(FfxFsr3UpscalerContext*, const FfxFsr3UpscalerDispatchDescription*) { return FFX_OK; }
+FfxErrorCode ffxFsr3UpscalerContextGenerateReactiveMask(FfxFsr3UpscalerContext*, const FfxFsr3UpscalerGenerateReactiveDescription*) { return FFX_OK; }
+FfxErrorCode ffxFsr3UpscalerContextGetGpuMemoryUsage(FfxFsr3UpscalerContext*, FfxEffectMemoryUsage*) { return FFX_OK; }
+FfxErrorCode ffxFsr3UpscalerGetJitterOffset(float* pOutX, float* pOutY, int32_t, int32_t) { *pOutX = *pOutY = 0.0f; return FFX_OK; }
+int32_t ffxFsr3UpscalerGetJitterPhaseCount(int32_t, int32_t) { return 8; }
+FfxErrorCode ffxFsr3UpscalerGetRenderResolutionFromQualityMode(uint32_t* pRenderWidth, uint32_t* pRenderHeight, uint32_t displayWidth, uint32_t displayHeight, FfxFsr3UpscalerQualityMode)
+{
+    *pRenderWidth  = displayWidth;
+    *pRenderHeight = displayHeight;
+    return FFX_OK;
+}
+FfxErrorCode ffxFsr3UpscalerGetSharedResourceDescriptions(FfxFsr3UpscalerContext*, FfxFsr3UpscalerSharedResourceDescriptions* SharedResources)
+{
+    memset(SharedResources, 0, sizeof(*SharedResources));
+    SharedResources->dilatedDepth.name                  = L"DilatedDepth";
+    SharedResources->dilatedMotionVectors.name          = L"DilatedMotionVectors";
+    SharedResources->reconstructedPrevNearestDepth.name = L"ReconstructedPrevNearestDepth";
+    return FFX_OK;
+}
+float ffxFsr3UpscalerGetUpscaleRatioFromQualityMode(FfxFsr3UpscalerQualityMode) { return 1.0f; }
+bool ffxFsr3UpscalerResourceIsNull(FfxResource resource) { return resource.resource == nullptr; }
+
+FfxErrorCode ffxOpticalflowContextCreate(FfxOpticalflowContext* context, FfxOpticalflowContextDescription*) { memset(context, 0, sizeof(*context)); return FFX_OK; }
+FfxErrorCode ffxOpticalflowContextDestroy(FfxOpticalflowContext*) { return FFX_OK; }
+FfxErrorCode ffxOpticalflowContextDispatch(FfxOpticalflowContext* context, const FfxOpticalflowDispatchDescription* dispatchDescription)
+{
+    mockDispatch(context, dispatchDescription->commandList);
+    return FFX_OK;
+}
+FfxErrorCode ffxOpticalflowContextGetGpuMemoryUsage(FfxOpticalflowContext*, FfxEffectMemoryUsage*) { return FFX_OK; }
+FfxErrorCode ffxOpticalflowGetSharedResourceDescriptions(FfxOpticalflowContext*, FfxOpticalflowSharedResourceDescriptions* SharedResources)
+{
+    memset(SharedResources, 0, sizeof(*SharedResources));
+    return FFX_OK;
+}
+
+FfxErrorCode ffxFrameInterpolationContextCreate(FfxFrameInterpolationContext* context, FfxFrameInterpolationContextDescription*) { memset(context, 0, sizeof(*context)); return FFX_OK; }
+FfxErrorCode ffxFrameInterpolationContextDestroy(FfxFrameInterpolationContext*) { return FFX_OK; }
+FfxErrorCode ffxFrameInterpolationContextGetGpuMemoryUsage(FfxFrameInterpolationContext*, FfxEffectMemoryUsage*) { return FFX_OK; }
+FfxErrorCode ffxFrameInterpolationPrepare(FfxFrameInterpolationContext*, const FfxFrameInterpolationPrepareDescription*) { return FFX_OK; }
+FfxErrorCode ffxFrameInterpolationDispatch(FfxFrameInterpolationContext* context, const FfxFrameInterpolationDispatchDescription* params)
+{
+    mockDispatch(context, params->commandList);
+    return FFX_OK;
+}
+
+static FfxInterface makeMockInterface()
+{
+    FfxInterface backendInterface = {};
+    backendInterface.fpGetSDKVersion                     = mockGetSDKVersion;
+    backendInterface.fpGetDeviceCapabilities             = mockGetDeviceCapabilities;
+    backendInterface.fpCreateBackendContext              = mockCreateBackendContext;
+    backendInterface.fpDestroyBackendContext             = mockDestroyBackendContext;
+    backendInterface.fpCreateResource                    = mockCreateResource;
+    backendInterface.fpDestroyResource                   = mockDestroyResource;
+    backendInterface.fpGetResource                       = mockGetResource;
+    backendInterface.fpSwapChainConfigureFrameGeneration = mockSwapChainConfigureFrameGeneration;
+    return backendInterface;
+}
+
+static const MockEffectContext& opticalFlowMock(FfxFsr3Context& context)
+{
+    return *reinterpret_cast<const MockEffectContext*>(&reinterpret_cast<FfxFsr3Context_Private*>(&context)->ofContext);
+}
+
+static const MockEffectContext& frameInterpolationMock(FfxFsr3Context& context)
+{
+    return *reinterpret_cast<const MockEffectContext*>(&reinterpret_cast<FfxFsr3Context_Private*>(&context)->fiContext);
+}
+
+static FfxCommandList commandListOf(uint32_t contextIndex)
+{
+    return reinterpret_cast<FfxCommandList>(uintptr_t(0x1000 + contextIndex));
+}
+
+// Each swapchain dispatches its own context through the callback user data, the frames of one swapchain run on one thread
+static void presentFrames(FfxFsr3Context* context, uint32_t contextIndex, uint32_t frameCount)
+{
+    FfxFrameGenerationDispatchDescription dispatchDescription = {};
+    dispatchDescription.commandList = commandListOf(contextIndex);
+    for (uint32_t frame = 0; frame < frameCount; ++frame) {
+        dispatchDescription.frameID = frame;
+        FFX_TEST_EXPECT(ffxFsr3DispatchFrameGenerationCallback(&dispatchDescription, context) == FFX_OK);
+    }
+}
+
+int main()
+{
+    std::vector<FfxFsr3Context> contexts(s_contextCount);
+
+    FfxFsr3ContextDescription contextDescription = {};
+    contextDescription.maxRenderSize                      = { 1920, 1080 };
+    contextDescription.maxUpscaleSize                     = { 1920, 1080 };
+    contextDescription.displaySize                        = { 1920, 1080 };
+    contextDescription.backendInterfaceSharedResources    = makeMockInterface();
+    contextDescription.backendInterfaceUpscaling          = makeMockInterface();
+    contextDescription.backendInterfaceFrameInterpolation = makeMockInterface();
+
+    FfxFrameGenerationConfig frameGenerationConfig = {};
+    frameGenerationConfig.frameGenerationEnabled = true;
+    for (FfxFsr3Context& context : contexts) {
+        FFX_TEST_EXPECT(ffxFsr3ContextCreate(&context, &contextDescription) == FFX_OK);
+        FFX_TEST_EXPECT(ffxFsr3ConfigureFrameGeneration(&context, &frameGenerationConfig) == FFX_OK);
+    }
+
+    // the process-wide entry point cannot tell which of several contexts to dispatch
+    FfxFrameGenerationDispatchDescription dispatchDescription = {};
+    FFX_TEST_EXPECT(ffxFsr3DispatchFrameGeneration(&dispatchDescription) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+
+    // the same work, once from a single thread and once from a thread per context
+    const auto serialStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < s_contextCount; ++i) {
+        presentFrames(&contexts[i], i, s_frameCount / 2);
+    }
+    const auto serialEnd = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < s_contextCount; ++i) {
+        threads.emplace_back(presentFrames, &contexts[i], i, s_frameCount / 2);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const auto concurrentEnd = std::chrono::steady_clock::now();
+
+    // every dispatch reached the components of its own context, recorded into its own command list
+    for (uint32_t i = 0; i < s_contextCount; ++i) {
+        for (const MockEffectContext* mock : { &opticalFlowMock(contexts[i]), &frameInterpolationMock(contexts[i]) }) {
+            FFX_TEST_EXPECT(mock->dispatchCount == s_frameCount);
+            FFX_TEST_EXPECT(mock->commandList == commandListOf(i));
+            FFX_TEST_EXPECT(mock->foreignDispatchCount == 0);
+        }
+    }
+
+    const double serialMs     = std::chrono::duration<double, std::milli>(serialEnd - serialStart).count();
+    const double concurrentMs = std::chrono::duration<double, std::milli>(concurrentEnd - serialEnd).count();
+    printf("%u contexts, %u frame generation dispatches each: serial %.2f ms, one thread per context %.2f ms (%.2fx, %u hardware threads)\n",
+           s_contextCount, s_frameCount / 2 * s_dispatchesPerFrame, serialMs, concurrentMs, serialMs / concurrentMs, std::thread::hardware_concurrency());
+
+    // once a single context is left with frame generation, the process-wide entry point routes to it
+    frameGenerationConfig.frameGenerationEnabled = false;
+    for (uint32_t i = 1; i < s_contextCount; ++i) {
+        FFX_TEST_EXPECT(ffxFsr3ConfigureFrameGeneration(&contexts[i], &frameGenerationConfig) == FFX_OK);
+    }
+    dispatchDescription.commandList = commandListOf(0);
+    FFX_TEST_EXPECT(ffxFsr3DispatchFrameGeneration(&dispatchDescription) == FFX_OK);
+    FFX_TEST_EXPECT(opticalFlowMock(contexts[0]).dispatchCount == s_frameCount + 1);
+    FFX_TEST_EXPECT(opticalFlowMock(contexts[1]).dispatchCount == s_frameCount);
+
+    // a destroyed context is no longer routed to
+    for (FfxFsr3Context& context : contexts) {
+        FFX_TEST_EXPECT(ffxFsr3ContextDestroy(&context) == FFX_OK);
+    }
+    FFX_TEST_EXPECT(ffxFsr3DispatchFrameGeneration(&dispatchDescription) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+    FFX_TEST_EXPECT(s_liveBackendContexts == 0);
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,253 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_interface.h>
+#include <ffx_object_management.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+// Job queue of a mock backend, copied the way the DX12 and Vulkan backends do
+typedef struct MockJobQueue {
+    std::vector<FfxGpuJobDescription> jobs;
+    uint32_t                          jobCount;
+    uint32_t                          singleCalls;
+    uint32_t                          batchCalls;
+    bool                              copyWholeJob;
+} MockJobQueue;
+
+static FfxErrorCode mockScheduleGpuJob(FfxInterface* backendInterface, const FfxGpuJobDescription* job)
+{
+    MockJobQueue* queue = (MockJobQueue*)backendInterface->scratchBuffer;
+    FFX_TEST_EXPECT(queue->jobCount < queue->jobs.size());
+
+    // copyWholeJob is how jobs were queued before ffxGetGpuJobDescriptionSize
+    if (queue->copyWholeJob) {
+        queue->jobs[queue->jobCount] = *job;
+    }
+    else {
+        memcpy(&queue->jobs[queue->jobCount], job, ffxGetGpuJobDescriptionSize(job));
+    }
+    ++queue->jobCount;
+    ++queue->singleCalls;
+
+    return FFX_OK;
+}
+
+static FfxErrorCode mockScheduleGpuJobs(FfxInterface* backendInterface, const FfxGpuJobDescription* jobs, uint32_t jobCount)
+{
+    MockJobQueue* queue = (MockJobQueue*)backendInterface->scratchBuffer;
+    FFX_TEST_EXPECT(queue->jobCount + jobCount <= queue->jobs.size());
+
+    FfxGpuJobDescription* dstJobs = &queue->jobs[queue->jobCount];
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        memcpy(&dstJobs[jobIndex], &jobs[jobIndex], ffxGetGpuJobDescriptionSize(&jobs[jobIndex]));
+    }
+    queue->jobCount += jobCount;
+    ++queue->batchCalls;
+
+    return FFX_OK;
+}
+
+static void initMockInterface(FfxInterface* backendInterface, MockJobQueue* queue, uint32_t capacity, bool batched)
+{
+    memset(backendInterface, 0, sizeof(FfxInterface));
+    backendInterface->fpScheduleGpuJob  = mockScheduleGpuJob;
+    backendInterface->fpScheduleGpuJobs = batched ? mockScheduleGpuJobs : nullptr;
+    backendInterface->scratchBuffer     = queue;
+    backendInterface->scratchBufferSize = sizeof(MockJobQueue);
+
+    queue->jobs.resize(capacity);
+    queue->jobCount     = 0;
+    queue->singleCalls  = 0;
+    queue->batchCalls   = 0;
+    queue->copyWholeJob = false;
+}
+
+// The same mix of small jobs an effect queues when it resets its history
+static void fillClearJobs(std::vector<FfxGpuJobDescription>& jobs)
+{
+    for (uint32_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex) {
+        FfxGpuJobDescription& job = jobs[jobIndex];
+        memset(&job, 0, sizeof(job));
+        job.jobType = (jobIndex % 4 == 3) ? FFX_GPU_JOB_BARRIER : FFX_GPU_JOB_CLEAR_FLOAT;
+        if (job.jobType == FFX_GPU_JOB_BARRIER) {
+            job.barrierDescriptor.resource.internalIndex = int32_t(jobIndex);
+        }
+        else {
+            job.clearJobDescriptor.target.internalIndex = int32_t(jobIndex);
+            job.clearJobDescriptor.color[0]             = float(jobIndex);
+        }
+    }
+}
+
+static bool jobsMatch(const FfxGpuJobDescription& queued, const FfxGpuJobDescription& scheduled)
+{
+    return memcmp(&queued, &scheduled, ffxGetGpuJobDescriptionSize(&scheduled)) == 0;
+}
+
+static void testDescriptionSize()
+{
+    FfxGpuJobDescription job = {};
+
+    job.jobType = FFX_GPU_JOB_CLEAR_FLOAT;
+    FFX_TEST_EXPECT(ffxGetGpuJobDescriptionSize(&job) < sizeof(FfxGpuJobDescription));
+    FFX_TEST_EXPECT(ffxGetGpuJobDescriptionSize(&job) >= offsetof(FfxGpuJobDescription, clearJobDescriptor) + sizeof(FfxClearFloatJobDescription));
+
+    job.jobType = FFX_GPU_JOB_BARRIER;
+    FFX_TEST_EXPECT(ffxGetGpuJobDescriptionSize(&job) < sizeof(FfxGpuJobDescription));
+
+    job.jobType = FFX_GPU_JOB_COMPUTE;
+    FFX_TEST_EXPECT(ffxGetGpuJobDescriptionSize(&job) == sizeof(FfxGpuJobDescription));
+}
+
+static void testScheduling(bool batched)
+{
+    const uint32_t jobCount = 12;
+
+    std::vector<FfxGpuJobDescription> jobs(jobCount);
+    fillClearJobs(jobs);
+
+    FfxInterface backendInterface;
+    MockJobQueue queue;
+    initMockInterface(&backendInterface, &queue, jobCount, batched);
+
+    FFX_TEST_EXPECT(ffxScheduleGpuJobs(&backendInterface, jobs.data(), jobCount) == FFX_OK);
+    FFX_TEST_EXPECT(queue.jobCount == jobCount);
+
+    // a batch goes through fpScheduleGpuJobs once, or through fpScheduleGpuJob per job on backends without it
+    FFX_TEST_EXPECT(queue.batchCalls == (batched ? 1u : 0u));
+    FFX_TEST_EXPECT(queue.singleCalls == (batched ? 0u : jobCount));
+
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        FFX_TEST_EXPECT(jobsMatch(queue.jobs[jobIndex], jobs[jobIndex]));
+    }
+
+    // an empty batch queues nothing
+    FFX_TEST_EXPECT(ffxScheduleGpuJobs(&backendInterface, nullptr, 0) == FFX_OK);
+    FFX_TEST_EXPECT(queue.jobCount == jobCount);
+}
+
+static void testJobBatch()
+{
+    const uint32_t batchCapacity = 4;
+    const uint32_t jobCount      = 10;
+
+    FfxInterface backendInterface;
+    MockJobQueue queue;
+    initMockInterface(&backendInterface, &queue, jobCount, true);
+
+    FfxGpuJobBatch batch;
+    FFX_TEST_EXPECT(ffxGpuJobBatchCreate(&batch, batchCapacity) == FFX_OK);
+
+    // dirty the storage, a job handed out again has to come back zeroed
+    memset(batch.jobs, 0xff, batchCapacity * sizeof(FfxGpuJobDescription));
+
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        FfxGpuJobDescription* job = ffxGpuJobBatchAdd(&backendInterface, &batch, FFX_GPU_JOB_CLEAR_FLOAT);
+        FFX_TEST_EXPECT(job->jobType == FFX_GPU_JOB_CLEAR_FLOAT);
+        FFX_TEST_EXPECT(job->clearJobDescriptor.color[3] == 0.0f);
+        FFX_TEST_EXPECT(job->clearJobDescriptor.target.internalIndex == 0);
+        job->clearJobDescriptor.target.internalIndex = int32_t(jobIndex);
+    }
+
+    // a full batch is scheduled before the next job is recorded
+    FFX_TEST_EXPECT(queue.batchCalls == jobCount / batchCapacity);
+    FFX_TEST_EXPECT(batch.jobCount == jobCount % batchCapacity);
+
+    FFX_TEST_EXPECT(ffxGpuJobBatchSchedule(&backendInterface, &batch) == FFX_OK);
+    FFX_TEST_EXPECT(batch.jobCount == 0);
+    FFX_TEST_EXPECT(queue.jobCount == jobCount);
+    FFX_TEST_EXPECT(queue.singleCalls == 0);
+
+    // jobs reach the backend in the order they were recorded
+    for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+        FFX_TEST_EXPECT(queue.jobs[jobIndex].clearJobDescriptor.target.internalIndex == int32_t(jobIndex));
+    }
+
+    // scheduling an empty batch queues nothing
+    FFX_TEST_EXPECT(ffxGpuJobBatchSchedule(&backendInterface, &batch) == FFX_OK);
+    FFX_TEST_EXPECT(queue.jobCount == jobCount);
+
+    ffxGpuJobBatchDestroy(&batch);
+    FFX_TEST_EXPECT(batch.jobs == nullptr);
+}
+
+// Cost of queueing a batch of small jobs: whole struct copies per job as before, trimmed copies per job and one batched call
+enum ScheduleMode {
+    ScheduleWholeJobs,
+    ScheduleTrimmedJobs,
+    ScheduleBatch,
+};
+
+static double nanosecondsPerJob(ScheduleMode mode, const std::vector<FfxGpuJobDescription>& jobs)
+{
+    const uint32_t jobCount   = uint32_t(jobs.size());
+    const uint32_t iterations = 20000;
+
+    FfxInterface backendInterface;
+    MockJobQueue queue;
+    initMockInterface(&backendInterface, &queue, jobCount, mode == ScheduleBatch);
+    queue.copyWholeJob = (mode == ScheduleWholeJobs);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+        queue.jobCount = 0;
+        if (mode == ScheduleBatch) {
+            ffxScheduleGpuJobs(&backendInterface, jobs.data(), jobCount);
+        }
+        else {
+            for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex) {
+                backendInterface.fpScheduleGpuJob(&backendInterface, &jobs[jobIndex]);
+            }
+        }
+    }
+    const double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    FFX_TEST_EXPECT(queue.jobCount == jobCount);
+    return nanoseconds / (double(iterations) * jobCount);
+}
+
+static void benchmarkScheduling()
+{
+    std::vector<FfxGpuJobDescription> jobs(16);
+    fillClearJobs(jobs);
+
+    const double wholeNs   = nanosecondsPerJob(ScheduleWholeJobs, jobs);
+    const double trimmedNs = nanosecondsPerJob(ScheduleTrimmedJobs, jobs);
+    const double batchNs   = nanosecondsPerJob(ScheduleBatch, jobs);
+    printf("%u clear/barrier jobs (%zu byte descriptions): whole copies %.1f ns, trimmed copies %.1f ns, batched %.1f ns per job\n",
+           uint32_t(jobs.size()), sizeof(FfxGpuJobDescription), wholeNs, trimmedNs, batchNs);
+}
+
+int main()
+{
+    testDescriptionSize();
+    testScheduling(false);
+    testScheduling(true);
+    testJobBatch();
+    benchmarkScheduling();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,277 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_opticalflow.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+static const FfxDimensions2D kResolution = { 256, 192 };
+static const uint32_t        kBlockSize  = 8;
+
+// Smooth value noise with detail at every pyramid level, defined for any pixel so shifted frames have no borders
+static float latticeValue(int32_t x, int32_t y, uint32_t seed)
+{
+    uint32_t hash = uint32_t(x) * 0x8da6b343u ^ uint32_t(y) * 0xd8163841u ^ seed * 0xcb1ab31fu;
+    hash = (hash ^ (hash >> 13)) * 0x5bd1e995u;
+    hash ^= hash >> 15;
+    return float(hash & 0xffffu) / 65535.0f;
+}
+
+static float valueNoise(float x, float y, uint32_t seed)
+{
+    const int32_t x0 = int32_t(std::floor(x));
+    const int32_t y0 = int32_t(std::floor(y));
+    const float   fx = x - float(x0);
+    const float   fy = y - float(y0);
+
+    const float top    = latticeValue(x0, y0, seed) + (latticeValue(x0 + 1, y0, seed) - latticeValue(x0, y0, seed)) * fx;
+    const float bottom = latticeValue(x0, y0 + 1, seed) + (latticeValue(x0 + 1, y0 + 1, seed) - latticeValue(x0, y0 + 1, seed)) * fx;
+    return top + (bottom - top) * fy;
+}
+
+static float pattern(int32_t x, int32_t y, uint32_t seed)
+{
+    float value = 0.0f;
+    float scale = 0.5f;
+    for (float period = 64.0f; period >= 2.0f; period *= 0.5f) {
+        value += scale * valueNoise(float(x) / period, float(y) / period, seed);
+        scale *= 0.5f;
+    }
+    return value;
+}
+
+// Grey RGBA frame of the pattern seen through a window at (originX, originY), scaled by brightness
+static void renderFrame(std::vector<float>& color, int32_t originX, int32_t originY, uint32_t seed, float brightness)
+{
+    color.resize(size_t(kResolution.width) * kResolution.height * 4);
+    for (uint32_t y = 0; y < kResolution.height; ++y) {
+        for (uint32_t x = 0; x < kResolution.width; ++x) {
+            const float value = brightness * pattern(originX + int32_t(x), originY + int32_t(y), seed);
+            float*      pixel = &color[(size_t(y) * kResolution.width + x) * 4];
+            pixel[0] = pixel[1] = pixel[2] = value;
+            pixel[3] = 1.0f;
+        }
+    }
+}
+
+// One CPU optical flow instance with the scratch memory it keeps between frames
+struct CpuOpticalflow
+{
+    explicit CpuOpticalflow(bool forceScalar)
+        : scratch(ffxOpticalflowCpuGetScratchMemorySize(kResolution))
+        , vectors(size_t(blockCountX()) * blockCountY() * 2)
+        , scd(3)
+        , forceScalar(forceScalar)
+    {
+    }
+
+    static uint32_t blockCountX() { return (kResolution.width + kBlockSize - 1) / kBlockSize; }
+    static uint32_t blockCountY() { return (kResolution.height + kBlockSize - 1) / kBlockSize; }
+
+    FfxErrorCode dispatch(const std::vector<float>& color, bool reset)
+    {
+        FfxOpticalflowCpuDispatchDescription description = {};
+        description.color             = color.data();
+        description.colorRowPitch     = kResolution.width * 4 * sizeof(float);
+        description.opticalFlowVector = vectors.data();
+        description.opticalFlowSCD    = scd.data();
+        description.scratchMemory     = scratch.data();
+        description.scratchMemorySize = scratch.size();
+        description.resolution        = kResolution;
+        description.reset             = reset;
+        description.forceScalar       = forceScalar;
+        return ffxOpticalflowCpuDispatch(&description);
+    }
+
+    bool sceneChangeDetected() const { return (scd[1] & 1u) != 0; }
+
+    std::vector<char>     scratch;
+    std::vector<int16_t>  vectors;
+    std::vector<uint32_t> scd;
+    bool                  forceScalar;
+};
+
+static const int32_t kShiftX = 3;
+static const int32_t kShiftY = 2;
+
+// The pattern moves by (-3, -2) pixels per frame, so each block is found (3, 2) pixels away in the previous frame
+static void renderMovingFrame(std::vector<float>& color, uint32_t frame)
+{
+    renderFrame(color, int32_t(frame) * kShiftX, int32_t(frame) * kShiftY, 1, 1.0f);
+}
+
+static void testScalarMatchesSimd()
+{
+    CpuOpticalflow     scalar(true);
+    CpuOpticalflow     simd(false);
+    std::vector<float> color;
+
+    for (uint32_t frame = 0; frame < 12; ++frame) {
+        // a cut at frame 8 exercises the scene change path of both too
+        if (frame < 8) {
+            renderMovingFrame(color, frame);
+        }
+        else {
+            renderFrame(color, int32_t(frame) * 5, -int32_t(frame), 7, 0.4f);
+        }
+
+        FFX_TEST_EXPECT(scalar.dispatch(color, frame == 0) == FFX_OK);
+        FFX_TEST_EXPECT(simd.dispatch(color, frame == 0) == FFX_OK);
+        FFX_TEST_EXPECT(memcmp(scalar.vectors.data(), simd.vectors.data(), scalar.vectors.size() * sizeof(int16_t)) == 0);
+        FFX_TEST_EXPECT(memcmp(scalar.scd.data(), simd.scd.data(), scalar.scd.size() * sizeof(uint32_t)) == 0);
+    }
+}
+
+static void testKnownShift()
+{
+    CpuOpticalflow     opticalflow(false);
+    std::vector<float> color;
+
+    // vectors stay zero while the scene change history warms up after a reset
+    const uint32_t warmupFrames = 6;
+    for (uint32_t frame = 0; frame < warmupFrames; ++frame) {
+        renderMovingFrame(color, frame);
+        FFX_TEST_EXPECT(opticalflow.dispatch(color, frame == 0) == FFX_OK);
+
+        bool allZero = true;
+        for (int16_t component : opticalflow.vectors) {
+            allZero = allZero && component == 0;
+        }
+        FFX_TEST_EXPECT(allZero);
+    }
+
+    for (uint32_t frame = warmupFrames; frame < warmupFrames + 4; ++frame) {
+        renderMovingFrame(color, frame);
+        FFX_TEST_EXPECT(opticalflow.dispatch(color, false) == FFX_OK);
+        FFX_TEST_EXPECT(!opticalflow.sceneChangeDetected());
+
+        // blocks at the right and bottom edge look for content outside the previous frame, skip them
+        uint32_t blocks  = 0;
+        uint32_t matches = 0;
+        for (uint32_t blockY = 1; blockY + 1 < CpuOpticalflow::blockCountY(); ++blockY) {
+            for (uint32_t blockX = 1; blockX + 1 < CpuOpticalflow::blockCountX(); ++blockX) {
+                const int16_t* vector = &opticalflow.vectors[(size_t(blockY) * CpuOpticalflow::blockCountX() + blockX) * 2];
+                matches += (vector[0] == kShiftX && vector[1] == kShiftY) ? 1 : 0;
+                ++blocks;
+            }
+        }
+        FFX_TEST_EXPECT(matches == blocks);
+    }
+}
+
+static void testSceneChange()
+{
+    CpuOpticalflow     opticalflow(false);
+    std::vector<float> color;
+
+    for (uint32_t frame = 0; frame < 10; ++frame) {
+        renderMovingFrame(color, frame);
+        FFX_TEST_EXPECT(opticalflow.dispatch(color, frame == 0) == FFX_OK);
+    }
+    FFX_TEST_EXPECT(!opticalflow.sceneChangeDetected());
+
+    // cut to darker, unrelated content
+    renderFrame(color, 1000, 1000, 7, 0.4f);
+    FFX_TEST_EXPECT(opticalflow.dispatch(color, false) == FFX_OK);
+    FFX_TEST_EXPECT(opticalflow.sceneChangeDetected());
+
+    float sceneChangeValue = 0.0f;
+    memcpy(&sceneChangeValue, &opticalflow.scd[0], sizeof(float));
+    FFX_TEST_EXPECT(sceneChangeValue > 0.45f);
+
+    // no motion is reported across the cut
+    bool allZero = true;
+    for (int16_t component : opticalflow.vectors) {
+        allZero = allZero && component == 0;
+    }
+    FFX_TEST_EXPECT(allZero);
+
+    // the history keeps the cut for the next frames, still without motion
+    renderFrame(color, 1003, 1002, 7, 0.4f);
+    FFX_TEST_EXPECT(opticalflow.dispatch(color, false) == FFX_OK);
+    FFX_TEST_EXPECT(!opticalflow.sceneChangeDetected());
+    FFX_TEST_EXPECT((opticalflow.scd[1] & 0x2u) != 0);
+}
+
+static void testErrors()
+{
+    std::vector<float> color;
+    renderMovingFrame(color, 0);
+
+    CpuOpticalflow opticalflow(false);
+    FFX_TEST_EXPECT(ffxOpticalflowCpuDispatch(nullptr) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+
+    FfxOpticalflowCpuDispatchDescription description = {};
+    description.color             = color.data();
+    description.colorRowPitch     = kResolution.width * 4 * sizeof(float);
+    description.opticalFlowVector = opticalflow.vectors.data();
+    description.opticalFlowSCD    = opticalflow.scd.data();
+    description.scratchMemory     = nullptr;
+    description.scratchMemorySize = opticalflow.scratch.size();
+    description.resolution        = kResolution;
+    description.reset             = true;
+    FFX_TEST_EXPECT(ffxOpticalflowCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+
+    description.scratchMemory     = opticalflow.scratch.data();
+    description.scratchMemorySize = opticalflow.scratch.size() - 1;
+    FFX_TEST_EXPECT(ffxOpticalflowCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INSUFFICIENT_MEMORY));
+
+    // the 7 level pyramid needs at least 64 pixels in each dimension
+    description.scratchMemorySize = opticalflow.scratch.size();
+    description.resolution        = { 32, 32 };
+    FFX_TEST_EXPECT(ffxOpticalflowCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INVALID_ARGUMENT));
+
+    FFX_TEST_EXPECT(ffxOpticalflowCpuGetScratchMemorySize({ 64, 64 }) < ffxOpticalflowCpuGetScratchMemorySize(kResolution));
+}
+
+static double millisecondsPerFrame(bool forceScalar)
+{
+    const uint32_t     frames = 8;
+    CpuOpticalflow     opticalflow(forceScalar);
+    std::vector<float> color;
+
+    double milliseconds = 0.0;
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        renderMovingFrame(color, frame);
+        const auto start = std::chrono::steady_clock::now();
+        opticalflow.dispatch(color, frame == 0);
+        milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    return milliseconds / frames;
+}
+
+int main()
+{
+    testScalarMatchesSimd();
+    testKnownShift();
+    testSceneChange();
+    testErrors();
+
+    printf("%ux%u CPU optical flow: scalar %.2f ms, SIMD %.2f ms per frame\n",
+           kResolution.width, kResolution.height, millisecondsPerFrame(true), millisecondsPerFrame(false));
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,161 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <FidelityFX/host/ffx_parallelsort.h>
+#include "ffx_test.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+static FfxErrorCode cpuSort(std::vector<uint32_t>& keys, std::vector<uint32_t>* payloads, uint32_t flags, uint32_t maxThreads)
+{
+    const uint32_t    numKeys = uint32_t(keys.size());
+    std::vector<char> scratch(ffxParallelSortCpuGetScratchMemorySize(numKeys, flags, maxThreads));
+
+    FfxParallelSortCpuDispatchDescription description = {};
+    description.keyBuffer         = keys.data();
+    description.payloadBuffer     = payloads ? payloads->data() : nullptr;
+    description.scratchMemory     = scratch.data();
+    description.scratchMemorySize = scratch.size();
+    description.numKeysToSort     = numKeys;
+    description.flags             = flags;
+    description.maxThreads        = maxThreads;
+    return ffxParallelSortCpuDispatch(&description);
+}
+
+// Keys and payloads against std::stable_sort of the pairs, payloads are unique so a
+// non-stable scatter shows up as a mismatch among equal keys
+static void testAgainstStableSort(uint32_t numKeys, uint32_t keyMask, uint32_t flags, uint32_t maxThreads, uint32_t seed)
+{
+    std::mt19937 random(seed);
+
+    std::vector<uint32_t> keys(numKeys);
+    std::vector<uint32_t> payloads(numKeys);
+    std::vector<std::pair<uint32_t, uint32_t>> reference(numKeys);
+    for (uint32_t i = 0; i < numKeys; ++i) {
+        keys[i]      = random() & keyMask;
+        payloads[i]  = random();
+        reference[i] = std::make_pair(keys[i], payloads[i]);
+    }
+    std::stable_sort(reference.begin(), reference.end(), [](const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b) {
+        return a.first < b.first;
+    });
+
+    const bool hasPayload = (flags & FFX_PARALLELSORT_PAYLOAD_SORT) != 0;
+    FFX_TEST_EXPECT(cpuSort(keys, hasPayload ? &payloads : nullptr, flags, maxThreads) == FFX_OK);
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < numKeys; ++i) {
+        mismatches += keys[i] == reference[i].first ? 0 : 1;
+        if (hasPayload) {
+            mismatches += payloads[i] == reference[i].second ? 0 : 1;
+        }
+    }
+    FFX_TEST_EXPECT(mismatches == 0);
+}
+
+static void testSort()
+{
+    const uint32_t payloadSort  = FFX_PARALLELSORT_PAYLOAD_SORT;
+    const uint32_t indirectSort = FFX_PARALLELSORT_PAYLOAD_SORT | FFX_PARALLELSORT_INDIRECT_SORT;
+
+    for (uint32_t numKeys : { 0u, 1u, 2u, 255u, 4096u, 100003u, 1u << 18 }) {
+        for (uint32_t maxThreads : { 1u, 4u, 0u }) {
+            testAgainstStableSort(numKeys, 0xffffffffu, 0, maxThreads, numKeys);
+            testAgainstStableSort(numKeys, 0xffffffffu, payloadSort, maxThreads, numKeys + 1);
+
+            // the CPU sort takes the element count directly, the indirect flag must not change the result
+            testAgainstStableSort(numKeys, 0xffffffffu, indirectSort, maxThreads, numKeys + 1);
+
+            // few distinct keys test stability, keys within one digit skip every other pass
+            testAgainstStableSort(numKeys, 0x7u, payloadSort, maxThreads, numKeys + 2);
+            testAgainstStableSort(numKeys, 0xf0f000u, payloadSort, maxThreads, numKeys + 3);
+        }
+    }
+}
+
+static void testErrors()
+{
+    uint32_t keys[4] = { 3, 2, 1, 0 };
+
+    FfxParallelSortCpuDispatchDescription description = {};
+    description.keyBuffer     = keys;
+    description.numKeysToSort = 4;
+    FFX_TEST_EXPECT(ffxParallelSortCpuDispatch(nullptr) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+    FFX_TEST_EXPECT(ffxParallelSortCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+
+    uint32_t scratch[4] = {};
+    description.scratchMemory     = scratch;
+    description.scratchMemorySize = sizeof(scratch);
+    FFX_TEST_EXPECT(ffxParallelSortCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INSUFFICIENT_MEMORY));
+
+    description.flags = FFX_PARALLELSORT_PAYLOAD_SORT;
+    FFX_TEST_EXPECT(ffxParallelSortCpuDispatch(&description) == FfxErrorCode(FFX_ERROR_INVALID_POINTER));
+}
+
+// Keys only, random 32 bit keys, best of a few runs of the radix sort against std::sort
+static void benchmarkSort(uint32_t maxKeys)
+{
+    std::mt19937 random(26);
+
+    for (uint32_t numKeys = 1u << 10; numKeys <= maxKeys; numKeys <<= 2) {
+
+        std::vector<uint32_t> source(numKeys);
+        for (uint32_t& key : source) {
+            key = random();
+        }
+
+        const uint32_t runs = numKeys <= (1u << 20) ? 5 : 1;
+        double         stdMs = 1e30, radixMs = 1e30;
+        std::vector<uint32_t> keys;
+        for (uint32_t run = 0; run < runs; ++run) {
+            keys = source;
+            auto start = std::chrono::steady_clock::now();
+            std::sort(keys.begin(), keys.end());
+            stdMs = std::min(stdMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+            keys = source;
+            start = std::chrono::steady_clock::now();
+            cpuSort(keys, nullptr, 0, 0);
+            radixMs = std::min(radixMs, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        FFX_TEST_EXPECT(std::is_sorted(keys.begin(), keys.end()));
+
+        printf("%8u keys: std::sort %.3f ms, radix sort %.3f ms (%.1fx)\n", numKeys, stdMs, radixMs, stdMs / radixMs);
+    }
+}
+
+// --benchmark runs the full 1K - 16M range, CTest stops at 64K to stay quick
+int main(int argc, char** argv)
+{
+    const bool fullBenchmark = argc > 1 && strcmp(argv[1], "--benchmark") == 0;
+
+    testSort();
+    testErrors();
+    benchmarkSort(fullBenchmark ? (1u << 24) : (1u << 16));
+
+    return FFX_TEST_RESULT();
+}
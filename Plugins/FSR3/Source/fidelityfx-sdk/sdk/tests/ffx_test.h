@@ -0,0 +1,40 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <cstdio>
+
+// Minimal expectation helpers for the host-only tests, a failed expectation is reported and the test carries on
+static int s_ffxTestFailures = 0;
+
+#define FFX_TEST_EXPECT(condition)                                                      \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(condition)) {                                                             \
+            fprintf(stderr, "%s(%d): expected %s\n", __FILE__, __LINE__, #condition);   \
+            ++s_ffxTestFailures;                                                        \
+        }                                                                               \
+    } while (0)
+
+// Exit code of a test executable
+#define FFX_TEST_RESULT() (s_ffxTestFailures ? 1 : 0)
@@ -0,0 +1,44 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Effect contexts are opaque uint32_t arrays sized for the 2 byte wchar_t of the SDK's Windows targets, and an
+// effect's private context holds wchar_t names in every pipeline state. Tests which create a real effect context
+// build it with -fshort-wchar and force-include this header, which supplies the MSVC string helper the effects use.
+// Only the effect's own code may handle wide strings in such a test, the C library still expects 4 byte wchar_t.
+#if !defined(_WIN32)
+
+#include <cstddef>
+
+template <size_t N>
+inline int wcscpy_s(wchar_t (&dst)[N], const wchar_t* src)
+{
+    size_t index = 0;
+    for (; index + 1 < N && src[index]; ++index) {
+        dst[index] = src[index];
+    }
+    dst[index] = 0;
+    return 0;
+}
+
+#endif // #if !defined(_WIN32)
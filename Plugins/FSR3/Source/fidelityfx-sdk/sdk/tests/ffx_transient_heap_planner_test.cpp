@@ -0,0 +1,196 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_transient_heap_planner.h>
+#include "ffx_test.h"
+
+#include <vector>
+
+// Mock of the device side of the DX12 backend: heaps are plain byte counts, each heap is charged to the
+// effect context which created it and uncharged when the last placement is released, like createTransientResource
+// and releaseTransientResource do.
+struct MockDevice
+{
+    FfxTransientHeapPlanner planner;
+    uint32_t                heapOwners[FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS];
+    uint64_t                allocatedHeapBytes = 0;
+    uint32_t                committedFallbacks = 0;
+
+    struct Context
+    {
+        FfxTransientHeapCursor  cursor;
+        uint64_t                totalUsageInBytes = 0;
+        struct Placement { uint32_t heapIndex; uint64_t offset; uint64_t size; };
+        std::vector<Placement>  placements;
+    };
+    std::vector<Context> contexts;
+
+    explicit MockDevice(uint32_t contextCount, uint64_t minimumHeapSize)
+        : contexts(contextCount)
+    {
+        ffxTransientHeapPlannerInit(&planner, minimumHeapSize);
+        for (Context& context : contexts) {
+            ffxTransientHeapCursorReset(&context.cursor);
+        }
+    }
+
+    bool place(uint32_t contextId, uint64_t size, uint64_t alignment)
+    {
+        Context& context = contexts[contextId];
+
+        uint32_t heapIndex   = 0;
+        uint64_t offset      = 0;
+        uint64_t newHeapSize = 0;
+        while (!ffxTransientHeapPlannerPlace(&planner, &context.cursor, size, alignment, &heapIndex, &offset, &newHeapSize)) {
+            if (!newHeapSize) {
+                ++committedFallbacks;
+                return false;
+            }
+            heapOwners[ffxTransientHeapPlannerAddHeap(&planner, newHeapSize)] = contextId;
+            allocatedHeapBytes        += newHeapSize;
+            context.totalUsageInBytes += newHeapSize;
+        }
+
+        FFX_TEST_EXPECT(alignment == 0 || offset % alignment == 0);
+        FFX_TEST_EXPECT(offset + size <= planner.heapSizes[heapIndex]);
+        context.placements.push_back({ heapIndex, offset, size });
+        return true;
+    }
+
+    void releaseAll(uint32_t contextId)
+    {
+        Context& context = contexts[contextId];
+        for (const Context::Placement& placement : context.placements) {
+            ffxTransientHeapPlannerRelease(&planner, &context.cursor, placement.size);
+        }
+        context.placements.clear();
+
+        if (!planner.placementCount) {
+            for (uint32_t i = 0; i < planner.heapCount; ++i) {
+                allocatedHeapBytes -= planner.heapSizes[i];
+                contexts[heapOwners[i]].totalUsageInBytes -= planner.heapSizes[i];
+            }
+            ffxTransientHeapPlannerReset(&planner);
+        }
+    }
+
+    // placements of one context are live at the same time, so they must never overlap
+    void expectNoOverlapWithinContexts() const
+    {
+        for (const Context& context : contexts) {
+            for (size_t i = 0; i < context.placements.size(); ++i) {
+                for (size_t j = i + 1; j < context.placements.size(); ++j) {
+                    const Context::Placement& a = context.placements[i];
+                    const Context::Placement& b = context.placements[j];
+                    FFX_TEST_EXPECT(a.heapIndex != b.heapIndex || a.offset + a.size <= b.offset || b.offset + b.size <= a.offset);
+                }
+            }
+        }
+    }
+};
+
+// Several effects with the same transient footprint share one set of heaps
+static void testContextsAlias()
+{
+    const uint64_t sizes[] = { 8u << 20, 4u << 20, 16u << 20, 65536 };
+
+    MockDevice device(4, 1u << 20);
+    for (uint32_t contextId = 0; contextId < 4; ++contextId) {
+        for (uint64_t size : sizes) {
+            FFX_TEST_EXPECT(device.place(contextId, size, 65536));
+        }
+    }
+    device.expectNoOverlapWithinContexts();
+
+    FfxTransientHeapPlannerStatistics statistics = {};
+    ffxTransientHeapPlannerGetStatistics(&device.planner, &statistics);
+    FFX_TEST_EXPECT(statistics.placementCount == 16);
+    FFX_TEST_EXPECT(statistics.placedBytes == 4 * (28ull << 20) + 4 * 65536);
+    FFX_TEST_EXPECT(statistics.heapBytes == device.allocatedHeapBytes);
+
+    // the heaps only hold one context's worth plus the slack of geometric growth, which at most doubles the total per heap
+    FFX_TEST_EXPECT(statistics.heapBytes <= 4 * ((28ull << 20) + 65536));
+    FFX_TEST_EXPECT(statistics.heapBytes < statistics.placedBytes);
+
+    // the first context created every heap, the others reuse them without being charged
+    FFX_TEST_EXPECT(device.contexts[0].totalUsageInBytes == statistics.heapBytes);
+    FFX_TEST_EXPECT(device.contexts[1].totalUsageInBytes == 0);
+
+    for (uint32_t contextId = 0; contextId < 4; ++contextId) {
+        device.releaseAll(contextId);
+    }
+    FFX_TEST_EXPECT(device.planner.heapCount == 0);
+    FFX_TEST_EXPECT(device.allocatedHeapBytes == 0);
+    FFX_TEST_EXPECT(device.contexts[0].totalUsageInBytes == 0);
+}
+
+// A context resized while others keep their placements packs from the first heap again and grows the set if needed
+static void testResizeRepacks()
+{
+    MockDevice device(2, 1u << 20);
+    FFX_TEST_EXPECT(device.place(0, 4u << 20, 65536));
+    FFX_TEST_EXPECT(device.place(1, 2u << 20, 65536));
+
+    device.releaseAll(0);
+    FFX_TEST_EXPECT(device.planner.heapCount == 1);
+    FFX_TEST_EXPECT(device.contexts[0].cursor.placementCount == 0 && device.contexts[0].cursor.offset == 0);
+
+    // twice as large after the resize, which needs a second heap
+    FFX_TEST_EXPECT(device.place(0, 4u << 20, 65536));
+    FFX_TEST_EXPECT(device.place(0, 4u << 20, 65536));
+    FFX_TEST_EXPECT(device.planner.heapCount == 2);
+    device.expectNoOverlapWithinContexts();
+
+    device.releaseAll(1);
+    device.releaseAll(0);
+    FFX_TEST_EXPECT(device.allocatedHeapBytes == 0);
+    FFX_TEST_EXPECT(device.contexts[0].totalUsageInBytes == 0 && device.contexts[1].totalUsageInBytes == 0);
+}
+
+// Once every heap slot is used placements fail and the resource has to be committed
+static void testOutOfHeaps()
+{
+    MockDevice device(1, 4096);
+    uint32_t placed = 0;
+    for (uint32_t i = 0; i < 64; ++i) {
+        placed += device.place(0, 1ull << i % 40, 0) ? 1 : 0;
+    }
+    device.expectNoOverlapWithinContexts();
+
+    FfxTransientHeapPlannerStatistics statistics = {};
+    ffxTransientHeapPlannerGetStatistics(&device.planner, &statistics);
+    FFX_TEST_EXPECT(statistics.heapCount <= FFX_TRANSIENT_HEAP_PLANNER_MAX_HEAPS);
+    FFX_TEST_EXPECT(statistics.failedPlacements == device.committedFallbacks);
+    FFX_TEST_EXPECT(placed + device.committedFallbacks == 64);
+
+    device.releaseAll(0);
+    FFX_TEST_EXPECT(device.planner.heapCount == 0);
+}
+
+int main()
+{
+    testContextsAlias();
+    testResizeRepacks();
+    testOutOfHeaps();
+
+    return FFX_TEST_RESULT();
+}
@@ -0,0 +1,134 @@
+// This file is part of the FidelityFX SDK.
+//
+// Copyright (C) 2024 Advanced Micro Devices, Inc.
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <ffx_upscaler_tables.h>
+#include <FidelityFX/host/ffx_util.h>
+#include "ffx_test.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+// The per-context implementations the shared tables replaced, kept as the reference. They called an
+// unqualified abs on the float, which MSVC resolves to the float overload; spelled out here so the
+// reference does not depend on the compiler either.
+static float referenceHalton(int32_t index, int32_t base)
+{
+    float f = 1.0f, result = 0.0f;
+
+    for (int32_t currentIndex = index; currentIndex > 0;) {
+
+        f /= (float)base;
+        result = result + f * (float)(currentIndex % base);
+        currentIndex = (uint32_t)(floorf((float)(currentIndex) / (float)(base)));
+    }
+
+    return result;
+}
+
+static float referenceLanczos2(float value)
+{
+    return fabsf(value) < FFX_EPSILON ? 1.f : (sinf(FFX_PI * value) / (FFX_PI * value)) * (sinf(0.5f * FFX_PI * value) / (0.5f * FFX_PI * value));
+}
+
+static void referenceJitterOffset(float* outX, float* outY, int32_t index, int32_t phaseCount)
+{
+    *outX = referenceHalton((index % phaseCount) + 1, 2) - 0.5f;
+    *outY = referenceHalton((index % phaseCount) + 1, 3) - 0.5f;
+}
+
+static bool bitIdentical(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+static void testJitterIdentity()
+{
+    // phase counts past the table exercise the fallback, negative indices the negative phases
+    uint32_t mismatches = 0;
+    for (int32_t phaseCount = 1; phaseCount < 300; ++phaseCount) {
+        for (int32_t index = -5; index < 700; ++index) {
+
+            float x = 0.0f, y = 0.0f, referenceX = 0.0f, referenceY = 0.0f;
+            ffxGetJitterOffsetFromTable(&x, &y, index, phaseCount);
+            referenceJitterOffset(&referenceX, &referenceY, index, phaseCount);
+            mismatches += (bitIdentical(x, referenceX) && bitIdentical(y, referenceY)) ? 0 : 1;
+        }
+    }
+    FFX_TEST_EXPECT(mismatches == 0);
+
+    for (int32_t index = 0; index < 1000; ++index) {
+        FFX_TEST_EXPECT(bitIdentical(ffxHalton(index, 2), referenceHalton(index, 2)));
+        FFX_TEST_EXPECT(bitIdentical(ffxHalton(index, 3), referenceHalton(index, 3)));
+    }
+}
+
+static void testLanczosIdentity()
+{
+    const int16_t* lut = ffxGetLanczos2Lut();
+    FFX_TEST_EXPECT(lut == ffxGetLanczos2Lut());
+
+    for (uint32_t currentLanczosWidthIndex = 0; currentLanczosWidthIndex < FFX_LANCZOS2_LUT_WIDTH; currentLanczosWidthIndex++) {
+
+        const float x = 2.0f * currentLanczosWidthIndex / float(FFX_LANCZOS2_LUT_WIDTH - 1);
+        FFX_TEST_EXPECT(bitIdentical(ffxLanczos2(x), referenceLanczos2(x)));
+        FFX_TEST_EXPECT(lut[currentLanczosWidthIndex] == int16_t(roundf(referenceLanczos2(x) * 32767.0f)));
+    }
+}
+
+// Per-frame cost of the jitter offset, the loop it replaced and the table
+template<typename JitterFunc>
+static double nanosecondsPerCall(JitterFunc jitter, int32_t phaseCount, float* sink)
+{
+    const int32_t iterations = 10000000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int32_t index = 0; index < iterations; ++index) {
+        float x = 0.0f, y = 0.0f;
+        jitter(&x, &y, index, phaseCount);
+        *sink += x + y;
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static void benchmarkJitter()
+{
+    // sinks through a volatile so the calls are not optimized out
+    volatile float sinkOut = 0.0f;
+    float          sink    = 0.0f;
+
+    for (int32_t phaseCount : { 8, 18, 32, 72 }) {
+        const double loopNs  = nanosecondsPerCall(referenceJitterOffset, phaseCount, &sink);
+        const double tableNs = nanosecondsPerCall(ffxGetJitterOffsetFromTable, phaseCount, &sink);
+        printf("jitter offset, %d phases: loop %.2f ns, table %.2f ns per frame\n", phaseCount, loopNs, tableNs);
+    }
+    sinkOut = sink;
+    (void)sinkOut;
+}
+
+int main()
+{
+    testJitterIdentity();
+    testLanczosIdentity();
+    benchmarkJitter();
+
+    return FFX_TEST_RESULT();
+}
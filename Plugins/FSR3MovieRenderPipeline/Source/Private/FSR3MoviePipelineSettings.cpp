@@ -56,6 +56,15 @@ void UFSR3MoviePipelineSettings::GetFormatArguments(FMoviePipelineFormatArgs& In
 	{
 		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3QualityMode"), StaticEnum<EFSR3MoviePipelineQuality>()->GetDisplayNameTextByIndex((int32)FSR3Quality).ToString());
 		InOutFormatArgs.FilenameArguments.Add(TEXT("fidelityFxFSR3QualityMode"), StaticEnum<EFSR3MoviePipelineQuality>()->GetDisplayNameTextByIndex((int32)FSR3Quality).ToString());
+
+		// Render time breakdown so far, lets tiled renders be compared against DLSS (unreal/dlss*)
+		const FFXFSR3MoviePipelineStats Stats = FSR3ModuleInterface.GetMoviePipelineStats();
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3Tiles"), FString::FromInt(Stats.NumTiles));
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3ContextsCreated"), FString::FromInt(Stats.NumContextsCreated));
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3ContextsReused"), FString::FromInt(Stats.NumContextsReused));
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3HistoryResets"), FString::FromInt(Stats.NumHistoryResets));
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3ContextCreationMs"), FString::SanitizeFloat(Stats.ContextCreationMs));
+		InOutFormatArgs.FileMetadata.Add(TEXT("amd/fidelityFxFSR3UpscalerPassesMs"), FString::SanitizeFloat(Stats.UpscalerPassesMs));
 	}
 	else
 	{
@@ -72,9 +81,39 @@ void UFSR3MoviePipelineSettings::SetupViewFamily(FSceneViewFamily& ViewFamily)
 	if (ViewFamily.ViewMode == EViewModeIndex::VMI_Lit && CVarFSR3Enabled->GetInt())
 	{
 		float ScreenPercentage = FSR3Quality == EFSR3MoviePipelineQuality::Native ? 100.f : FSR3ModuleInterface.GetResolutionFraction((uint32)FSR3Quality) * 100.0f;
-		if (CVarScreenPercentage)
+		// Only once per shot in practice, setting it for every tile would rerun all the screen percentage callbacks
+		if (CVarScreenPercentage && CVarScreenPercentage->GetFloat() != ScreenPercentage)
 		{
 			CVarScreenPercentage->Set(ScreenPercentage, ECVF_SetByCode);
 		}
+
+		// Each tile renders with its own view state, the upscaler keeps a context per view state of the view families marked here while this is set
+		if (!bMoviePipelineActive)
+		{
+			bMoviePipelineActive = true;
+			FSR3ModuleInterface.SetMoviePipelineActive(true);
+		}
+
+		TSharedPtr<ISceneViewExtension, ESPMode::ThreadSafe> MoviePipelineViewExtension = FSR3ModuleInterface.GetMoviePipelineViewExtension();
+		if (MoviePipelineViewExtension.IsValid() && !ViewFamily.ViewExtensions.Contains(MoviePipelineViewExtension))
+		{
+			ViewFamily.ViewExtensions.Add(MoviePipelineViewExtension.ToSharedRef());
+		}
 	}
 }
+
+void UFSR3MoviePipelineSettings::SetupForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	Super::SetupForPipelineImpl(InPipeline);
+
+	bMoviePipelineActive = false;
+}
+
+void UFSR3MoviePipelineSettings::TeardownForPipelineImpl(UMoviePipeline* InPipeline)
+{
+	IFFXFSR3TemporalUpscalingModule& FSR3ModuleInterface = FModuleManager::GetModuleChecked<IFFXFSR3TemporalUpscalingModule>(TEXT("FFXFSR3TemporalUpscaling"));
+	FSR3ModuleInterface.SetMoviePipelineActive(false);
+	bMoviePipelineActive = false;
+
+	Super::TeardownForPipelineImpl(InPipeline);
+}
@@ -52,4 +52,12 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWRite, Category = "Settings", DisplayName = "Quality Mode")
     EFSR3MoviePipelineQuality FSR3Quality;
+
+protected:
+    virtual void SetupForPipelineImpl(UMoviePipeline* InPipeline) override;
+    virtual void TeardownForPipelineImpl(UMoviePipeline* InPipeline) override;
+
+private:
+    // Whether the upscaler has been told that a movie render is running
+    bool bMoviePipelineActive = false;
 };
\ No newline at end of file
@@ -15,9 +15,15 @@
 #include "Runtime/Launch/Resources/Version.h"
 
 #include "NISShaders.h"
+#include "Containers/LockFreeList.h"
 
 #define LOCTEXT_NAMESPACE "FNISModule"
 
+DECLARE_STATS_GROUP(TEXT("NIS"), STATGROUP_NIS, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NIS: Upscaler interface allocations"), STAT_NISUpscalerAllocations, STATGROUP_NIS);
+DECLARE_CYCLE_STAT(TEXT("NIS: View extension BeginRenderViewFamily"), STAT_NISBeginRenderViewFamily, STATGROUP_NIS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("NIS: Known upscaler checks"), STAT_NISKnownUpscalerChecks, STATGROUP_NIS);
+
 static TAutoConsoleVariable<int32> CVarNISEnable(
 	TEXT("r.NIS.Enable"),
 	1,
@@ -32,6 +38,13 @@ static TAutoConsoleVariable<int32> CVarNISUpscaling(
 
 FNVImageUpscaler::FNISErrorState FNVImageUpscaler::ErrorState;
 
+// Bumped whenever a console variable changed, so BeginRenderViewFamily only redoes its diagnostics when they could be different
+static uint32 GNISConsoleVariablesGeneration = 0;
+static FAutoConsoleVariableSink CNISConsoleVariablesSink(FConsoleCommandDelegate::CreateLambda([]()
+{
+	++GNISConsoleVariablesGeneration;
+}));
+
 
 FNISViewExtension::FNISViewExtension(const FAutoRegister& AutoRegister) : FSceneViewExtensionBase(AutoRegister)
 {
@@ -59,6 +72,7 @@ void FNISViewExtension::SetupViewPoint(APlayerController* Player, FMinimalViewIn
 
 void FNISViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 {
+	SCOPE_CYCLE_COUNTER(STAT_NISBeginRenderViewFamily);
 	const bool bIsNISSupported = InViewFamily.GetFeatureLevel() >= GetNISMinRequiredFeatureLevel();
 	const bool bIsNISEnabled = CVarNISEnable.GetValueOnAnyThread() != 0;
 	const bool bIsNISUpscalingEnabled = CVarNISUpscaling.GetValueOnAnyThread() != 0;
@@ -100,7 +114,6 @@ void FNISViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 		{
 			const TCHAR* Name = nullptr;
 			IConsoleVariable* CVar = nullptr;
-			bool bInitialized = false;
 		};
 
 		static FConsoleVariableReference KnownUpscalerCVars[]
@@ -108,21 +121,28 @@ void FNISViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 			{TEXT("r.FidelityFX.FSR.Enabled")}
 		};
 
-		
-		FNVImageUpscaler::ErrorState.IncompatibleUpscalerCVarNames = TEXT("");
-		bool bAnyKnownUpscalerActive = false;
-		for (auto& UpscalerCVar : KnownUpscalerCVars)
+		static uint32 KnownUpscalerCVarsGeneration = MAX_uint32;
+		static bool bAnyKnownUpscalerActive = false;
+		if (KnownUpscalerCVarsGeneration != GNISConsoleVariablesGeneration)
 		{
-			if (!UpscalerCVar.bInitialized)
-			{
-				UpscalerCVar.CVar = IConsoleManager::Get().FindConsoleVariable(UpscalerCVar.Name);
-				UpscalerCVar.bInitialized = true;
-			}
+			KnownUpscalerCVarsGeneration = GNISConsoleVariablesGeneration;
+			INC_DWORD_STAT(STAT_NISKnownUpscalerChecks);
 
-			if (UpscalerCVar.CVar && UpscalerCVar.CVar->GetInt() != 0)
+			FNVImageUpscaler::ErrorState.IncompatibleUpscalerCVarNames.Reset();
+			bAnyKnownUpscalerActive = false;
+			for (auto& UpscalerCVar : KnownUpscalerCVars)
 			{
-				FNVImageUpscaler::ErrorState.IncompatibleUpscalerCVarNames.Append(UpscalerCVar.Name);
-				bAnyKnownUpscalerActive = true;
+				// the other plugin might register its cvar after our first look
+				if (!UpscalerCVar.CVar)
+				{
+					UpscalerCVar.CVar = IConsoleManager::Get().FindConsoleVariable(UpscalerCVar.Name);
+				}
+
+				if (UpscalerCVar.CVar && UpscalerCVar.CVar->GetInt() != 0)
+				{
+					FNVImageUpscaler::ErrorState.IncompatibleUpscalerCVarNames.Append(UpscalerCVar.Name);
+					bAnyKnownUpscalerActive = true;
+				}
 			}
 		}
 
@@ -199,6 +219,29 @@ ISpatialUpscaler* FNVImageUpscaler::Fork_GameThread(const FSceneViewFamily& View
 	return new FNVImageUpscaler();
 }
 
+// Created on the game thread, destroyed by the renderer once the view family has been rendered.
+static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> GNVImageUpscalerFreeList;
+
+void* FNVImageUpscaler::operator new(size_t Size)
+{
+	check(Size == sizeof(FNVImageUpscaler));
+	void* Ptr = GNVImageUpscalerFreeList.Pop();
+	if (!Ptr)
+	{
+		INC_DWORD_STAT(STAT_NISUpscalerAllocations);
+		Ptr = FMemory::Malloc(sizeof(FNVImageUpscaler), alignof(FNVImageUpscaler));
+	}
+	return Ptr;
+}
+
+void FNVImageUpscaler::operator delete(void* Ptr)
+{
+	if (Ptr)
+	{
+		GNVImageUpscalerFreeList.Push(Ptr);
+	}
+}
+
 
 FScreenPassTexture FNVImageUpscaler::AddPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, const ISpatialUpscaler::FInputs& PassInputs) const
 {
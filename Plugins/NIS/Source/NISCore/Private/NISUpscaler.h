@@ -49,6 +49,10 @@ public:
 	/** Create a new ISpatialUpscaler interface for a new view family. */
 	virtual ISpatialUpscaler* Fork_GameThread(const class FSceneViewFamily& ViewFamily) const override;
 
+	/** Instances are created per view family every frame, so their memory is recycled rather than returned to the allocator. */
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
+
 
 	// Inherited via ISpatialUpscaler
 	virtual FScreenPassTexture AddPasses(
@@ -27,6 +27,8 @@
 #include "SystemTextures.h"
 #include "HAL/PlatformApplicationMisc.h"
 
+#include <atomic>
+
 static FDelegateHandle OnPreRHIViewportCreateHandle;
 static FDelegateHandle OnPostRHIViewportCreateHandle;
 static FDelegateHandle OnSlateWindowDestroyedHandle;
@@ -95,6 +97,13 @@ static TAutoConsoleVariable<bool> CVarStreamlineFullScreenMenuDetection(
 	TEXT("Automatically disable DLSS-FG if full screen menus are detected (default = false)\n"),
 	ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarStreamlineDLSSGStatusQueryInterval(
+	TEXT("r.Streamline.DLSSG.StatusQueryInterval"),
+	4,
+	TEXT("Number of presented frames between DLSS-FG state queries, the last result is used in between (default = 4)\n")
+	TEXT("1: query every frame\n"),
+	ECVF_RenderThreadSafe);
+
 static TAutoConsoleVariable<int32> CVarStreamlineDLSSGDynamicResolutionMode(
 	TEXT("r.Streamline.DLSSG.DynamicResolutionMode"),
 	0,
@@ -141,8 +150,14 @@ bool ShouldTagStreamlineBuffersForDLSSFG()
 }
 
 
+// Set whenever the options Streamline holds for DLSS-FG might no longer match what we last submitted, so they get sent again.
+static std::atomic<bool> GDLSSGOptionsInvalidated(true);
+// Set when new options were submitted, so the next state query isn't deferred by r.Streamline.DLSSG.StatusQueryInterval.
+static std::atomic<bool> GDLSSGStatusQueryRequested(true);
+
 static void DLSSGAPIErrorCallBack(const sl::APIError& lastError)
 {
+	GDLSSGOptionsInvalidated = true;
 	FStreamlineCoreModule::GetStreamlineRHI()->APIErrorHandler(lastError);
 }
 
@@ -559,6 +574,7 @@ DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: Average FPS"), STAT_DLSSGAverageFPS, ST
 DECLARE_FLOAT_COUNTER_STAT(TEXT("DLSS-G: VRAM Estimate (MiB)"), STAT_DLSSGVRAMEstimate, STATGROUP_DLSSG);
 #endif
 DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Minimum Width or Height "), STAT_DLSSGMinWidthOrHeight, STATGROUP_DLSSG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("DLSS-G: Streamline calls"), STAT_DLSSGStreamlineCalls, STATGROUP_DLSSG);
 
 
 namespace sl
@@ -583,8 +599,24 @@ namespace sl
 
 void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues)
 {
+	// The state only feeds stats and next frame's motion blur correction, so outside of the one off query it's fine to reuse the last result for a few frames.
+	static uint32 FramesSinceStatusQuery = 0;
+	const uint32 StatusQueryInterval = uint32(FMath::Max(1, CVarStreamlineDLSSGStatusQueryInterval.GetValueOnAnyThread()));
 	extern ENGINE_API float GAverageFPS;
 
+	const bool bStatusQueryRequested = GDLSSGStatusQueryRequested.exchange(false);
+	if (!bQueryOncePerAppLifetimeValues && !bStatusQueryRequested && ++FramesSinceStatusQuery < StatusQueryInterval)
+	{
+		GLastDLSSGFrameRate = GAverageFPS * GLastDLSSGFramesPresented;
+		SET_DWORD_STAT(STAT_DLSSGFramesPresented, GLastDLSSGFramesPresented);
+		SET_FLOAT_STAT(STAT_DLSSGAverageFPS, GLastDLSSGFrameRate);
+#if WITH_DLSS_FG_VRAM_ESTIMATE
+		SET_FLOAT_STAT(STAT_DLSSGVRAMEstimate, GLastDLSSGVRAMEstimate);
+#endif
+		return;
+	}
+	FramesSinceStatusQuery = 0;
+
 	GLastDLSSGFrameRate = GAverageFPS;
 	GLastDLSSGFramesPresented = 1;
 
@@ -621,6 +653,7 @@ void GetDLSSGStatusFromStreamline(bool bQueryOncePerAppLifetimeValues)
 		StreamlineConstantsDLSSG.numFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate();
 
 		CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGGetState, Viewport, State, &StreamlineConstantsDLSSG);
+		INC_DWORD_STAT(STAT_DLSSGStreamlineCalls);
 
 
 		GLastDLSSGFramesPresented = State.numFramesActuallyPresented;
@@ -659,6 +692,14 @@ STREAMLINECORE_API void GetStreamlineDLSSGFrameTiming(float& FrameRateInHertz, i
 namespace
 {
 
+// What was last passed to slDLSSGSetOptions for a viewport, so unchanged options aren't resubmitted every frame
+struct FSLDLSSGSubmittedOptions
+{
+	sl::DLSSGMode Mode;
+	sl::DLSSGFlags Flags;
+	uint32 NumFramesToGenerate;
+};
+
 void SetStreamlineDLSSGState(FRHICommandListImmediate& RHICmdList, uint32 ViewID, const FIntRect& SecondaryViewRect, bool bEnableFullScreenMenuDetection, bool bEnableDynamicResolution)
 {
 	if (IsStreamlineDLSSGSupported())
@@ -687,12 +728,30 @@ void SetStreamlineDLSSGState(FRHICommandListImmediate& RHICmdList, uint32 ViewID
 		RHICmdList.EnqueueLambda(
 			[ViewID, DLSSGMode, DLSSGFlags](FRHICommandListImmediate& Cmd) mutable
 			{
+				// Only touched from the RHI thread lambdas, so no locking needed
+				static TMap<uint32, FSLDLSSGSubmittedOptions> SubmittedOptions;
+				if (GDLSSGOptionsInvalidated.exchange(false))
+				{
+					SubmittedOptions.Reset();
+				}
+
+				const uint32 NumFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate();
+				FSLDLSSGSubmittedOptions* Submitted = SubmittedOptions.Find(ViewID);
+				if (Submitted && Submitted->Mode == DLSSGMode && Submitted->Flags == DLSSGFlags && Submitted->NumFramesToGenerate == NumFramesToGenerate)
+				{
+					return;
+				}
+
 				sl::DLSSGOptions StreamlineConstantsDLSSG;
 				StreamlineConstantsDLSSG.mode = DLSSGMode;
-				StreamlineConstantsDLSSG.numFramesToGenerate = GetStreamlineDLSSGNumFramesToGenerate();
+				StreamlineConstantsDLSSG.numFramesToGenerate = NumFramesToGenerate;
 				StreamlineConstantsDLSSG.flags = DLSSGFlags;
 				StreamlineConstantsDLSSG.onErrorCallback = DLSSGAPIErrorCallBack;
 				CALL_SL_FEATURE_FN(sl::kFeatureDLSS_G, slDLSSGSetOptions, sl::ViewportHandle(ViewID), StreamlineConstantsDLSSG);
+				INC_DWORD_STAT(STAT_DLSSGStreamlineCalls);
+
+				SubmittedOptions.Add(ViewID, { DLSSGMode, DLSSGFlags, NumFramesToGenerate });
+				GDLSSGStatusQueryRequested = true;
 			});
 	}
 }
@@ -720,11 +779,8 @@ void AddStreamlineDLSSGStateRenderPass(FRDGBuilder& GraphBuilder, uint32 ViewID,
 			// TODO implement automatic mode
 			const bool bEnableDynamicResolution = CVarStreamlineDLSSGDynamicResolutionMode.GetValueOnAnyThread() != 0;
 
-			RHICmdList.EnqueueLambda(
-				[ViewID, SecondaryViewRect, bEnableFullScreenMenuDetection, bEnableDynamicResolution](FRHICommandListImmediate& Cmd) mutable
-				{
-					SetStreamlineDLSSGState(Cmd, ViewID, SecondaryViewRect, bEnableFullScreenMenuDetection, bEnableDynamicResolution);
-				});
+			// SetStreamlineDLSSGState enqueues the Streamline call itself, no need for another level of lambda around it
+			SetStreamlineDLSSGState(RHICmdList, ViewID, SecondaryViewRect, bEnableFullScreenMenuDetection, bEnableDynamicResolution);
 		});
 }
 
@@ -12,10 +12,12 @@
 #include "StreamlineAPI.h"
 #include "StreamlineRHI.h"
 #include "StreamlineRHIPrivate.h"
+#include "StreamlineMockInterposer.h"
 
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformProcess.h"
 #include "HAL/ThreadManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #include "sl.h"
@@ -49,6 +51,44 @@ void SetStreamlineAPILoggingEnabled(bool bEnabled)
 	bLogStreamlineLogFunctions = bEnabled;
 }
 
+// Every call into the interposer is timed, use "stat Streamline" or the Streamline CSV category (-csvCategories=Streamline) to see the per frame count and cost
+DECLARE_DWORD_COUNTER_STAT(TEXT("Streamline: Calls"), STAT_StreamlineNumCalls, STATGROUP_Streamline);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Streamline: Call time (ms)"), STAT_StreamlineCallTime, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLinit"), STAT_SLinit, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLshutdown"), STAT_SLshutdown, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLisFeatureSupported"), STAT_SLisFeatureSupported, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLisFeatureLoaded"), STAT_SLisFeatureLoaded, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLsetFeatureLoaded"), STAT_SLsetFeatureLoaded, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLevaluateFeature"), STAT_SLevaluateFeature, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLAllocateResources"), STAT_SLAllocateResources, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLFreeResources"), STAT_SLFreeResources, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLsetTag"), STAT_SLsetTag, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLgetFeatureRequirements"), STAT_SLgetFeatureRequirements, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLgetFeatureVersion"), STAT_SLgetFeatureVersion, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLUpgradeInterface"), STAT_SLUpgradeInterface, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLsetConstants"), STAT_SLsetConstants, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLgetNativeInterface"), STAT_SLgetNativeInterface, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLgetFeatureFunction"), STAT_SLgetFeatureFunction, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLgetNewFrameToken"), STAT_SLgetNewFrameToken, STATGROUP_Streamline);
+DECLARE_CYCLE_STAT(TEXT("SLsetD3DDevice"), STAT_SLsetD3DDevice, STATGROUP_Streamline);
+
+CSV_DEFINE_CATEGORY(Streamline, false);
+
+FStreamlineCallScope::~FStreamlineCallScope()
+{
+	const double Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	INC_DWORD_STAT(STAT_StreamlineNumCalls);
+	INC_FLOAT_STAT_BY(STAT_StreamlineCallTime, float(Milliseconds));
+#if CSV_PROFILER
+	FCsvProfiler::RecordCustomStat(FunctionName, CSV_CATEGORY_INDEX(Streamline), Milliseconds, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(Streamline, NumCalls, 1, ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+#define STREAMLINE_CALL_SCOPE(FunctionName) \
+	SCOPE_CYCLE_COUNTER(STAT_##FunctionName); \
+	FStreamlineCallScope StreamlineCallScope(#FunctionName)
+
 namespace sl
 {
 	inline const char* getFeatureRequirementsSingleBitFlagsAsStr(FeatureRequirementFlags f)
@@ -188,6 +228,7 @@ sl::Result SLinit(const sl::Preferences& pref, uint64_t sdkVersion)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLinit);
 	return Ptr_init(pref, sdkVersion);
 }
 
@@ -204,6 +245,7 @@ sl::Result SLshutdown()
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLshutdown);
 	return Ptr_shutdown();
 }
 
@@ -221,6 +263,7 @@ sl::Result SLisFeatureSupported(sl::Feature feature, const sl::AdapterInfo& adap
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLisFeatureSupported);
 	return Ptr_isFeatureSupported(feature, adapterInfo);
 }
 
@@ -238,6 +281,7 @@ sl::Result SLisFeatureLoaded(sl::Feature feature, bool& loaded)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLisFeatureLoaded);
 	return Ptr_isFeatureLoaded(feature, loaded);
 }
 
@@ -254,6 +298,7 @@ sl::Result SLsetFeatureLoaded(sl::Feature feature, bool loaded)
 		ANSI_TO_TCHAR(sl::getFeatureAsStr(feature)), feature, loaded);
 	}
 #endif
+	STREAMLINE_CALL_SCOPE(SLsetFeatureLoaded);
 	return Ptr_setFeatureLoaded(feature, loaded);
 }
 
@@ -360,6 +405,7 @@ sl::Result SLevaluateFeature(sl::Feature feature, const sl::FrameToken& frame, c
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLevaluateFeature);
 	return Ptr_evaluateFeature(feature, frame, inputs, numInputs, cmdBuffer);
 }
 
@@ -377,6 +423,7 @@ sl::Result SLAllocateResources(sl::CommandBuffer* cmdBuffer, sl::Feature feature
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLAllocateResources);
 	return Ptr_allocateResources(cmdBuffer, feature, viewport);
 }
 
@@ -394,6 +441,7 @@ sl::Result SLFreeResources(sl::Feature feature, const sl::ViewportHandle& viewpo
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLFreeResources);
 	return Ptr_freeResources(feature, viewport);
 }
 
@@ -426,6 +474,7 @@ sl::Result SLsetTag(const sl::ViewportHandle& viewport, const sl::ResourceTag* t
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLsetTag);
 	return Ptr_setTag(viewport, tags, numTags, cmdBuffer);
 }
 
@@ -443,6 +492,7 @@ sl::Result SLgetFeatureRequirements(sl::Feature feature, sl::FeatureRequirements
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLgetFeatureRequirements);
 	return Ptr_getFeatureRequirements(feature, requirements);
 }
 
@@ -460,6 +510,7 @@ sl::Result SLgetFeatureVersion(sl::Feature feature, sl::FeatureVersion& version)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLgetFeatureVersion);
 	return Ptr_getFeatureVersion(feature, version);
 }
 
@@ -476,6 +527,7 @@ sl::Result SLUpgradeInterface(void** baseInterface)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLUpgradeInterface);
 	return Ptr_upgradeInterface(baseInterface);
 }
 
@@ -494,6 +546,7 @@ sl::Result SLsetConstants(const sl::Constants& values, const sl::FrameToken& fra
 			static_cast<uint32_t>(viewport));
 	}
 #endif
+	STREAMLINE_CALL_SCOPE(SLsetConstants);
 	return Ptr_setConstants(values, frame, viewport);
 }
 
@@ -510,6 +563,7 @@ sl::Result SLgetNativeInterface(void* proxyInterface, void** baseInterface)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLgetNativeInterface);
 	return Ptr_getNativeInterface(proxyInterface, baseInterface);
 }
 
@@ -527,6 +581,7 @@ sl::Result SLgetFeatureFunction(sl::Feature feature, const char* functionName, v
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLgetFeatureFunction);
 	return Ptr_getFeatureFunction(feature, functionName, function);
 }
 
@@ -550,6 +605,7 @@ sl::Result SLgetNewFrameToken(sl::FrameToken*& token, uint32_t* frameIndex)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLgetNewFrameToken);
 	return Ptr_getNewFrameToken(token, frameIndex);
 }
 
@@ -566,11 +622,40 @@ sl::Result SLsetD3DDevice(void* d3dDevice)
 	}
 #endif
 
+	STREAMLINE_CALL_SCOPE(SLsetD3DDevice);
 	return Ptr_setD3DDevice(d3dDevice);
 }
 
 bool LoadStreamlineFunctionPointers(const FString& InterposerBinaryPath)
 {
+#if WITH_STREAMLINE_MOCK_INTERPOSER
+	if (!bIsStreamlineFunctionPointersLoaded && ShouldUseStreamlineMockInterposer())
+	{
+		UE_LOG(LogStreamlineRHI, Log, TEXT("-slmockinterposer: using the in-process mock Streamline interposer instead of %s"), *InterposerBinaryPath);
+
+		SLInterPoserDLL = GetStreamlineMockInterposerHandle();
+		Ptr_init = &StreamlineMock::slInit;
+		Ptr_shutdown = &StreamlineMock::slShutdown;
+		Ptr_isFeatureSupported = &StreamlineMock::slIsFeatureSupported;
+		Ptr_isFeatureLoaded = &StreamlineMock::slIsFeatureLoaded;
+		Ptr_setFeatureLoaded = &StreamlineMock::slSetFeatureLoaded;
+		Ptr_evaluateFeature = &StreamlineMock::slEvaluateFeature;
+		Ptr_allocateResources = &StreamlineMock::slAllocateResources;
+		Ptr_freeResources = &StreamlineMock::slFreeResources;
+		Ptr_setTag = &StreamlineMock::slSetTag;
+		Ptr_getFeatureRequirements = &StreamlineMock::slGetFeatureRequirements;
+		Ptr_getFeatureVersion = &StreamlineMock::slGetFeatureVersion;
+		Ptr_upgradeInterface = &StreamlineMock::slUpgradeInterface;
+		Ptr_setConstants = &StreamlineMock::slSetConstants;
+		Ptr_getNativeInterface = &StreamlineMock::slGetNativeInterface;
+		Ptr_getFeatureFunction = &StreamlineMock::slGetFeatureFunction;
+		Ptr_getNewFrameToken = &StreamlineMock::slGetNewFrameToken;
+		Ptr_setD3DDevice = &StreamlineMock::slSetD3DDevice;
+
+		bIsStreamlineFunctionPointersLoaded = true;
+	}
+#endif
+
 	if (!bIsStreamlineFunctionPointersLoaded)
 	{
 		UE_LOG(LogStreamlineRHI, Log, TEXT("loading core Streamline functions from Streamline interposer at %s"), *InterposerBinaryPath);
@@ -0,0 +1,374 @@
+/*
+* Copyright (c) 2022 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+
+#include "StreamlineMockInterposer.h"
+
+#if WITH_STREAMLINE_MOCK_INTERPOSER
+
+#include "StreamlineRHIPrivate.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+
+#include "sl_dlss_g.h"
+#include "sl_deepdvc.h"
+#include "sl_pcl.h"
+#include "sl_reflex.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<float> CVarStreamlineMockLatencyUs(
+	TEXT("r.Streamline.Mock.LatencyUs"),
+	0.0f,
+	TEXT("Time in microseconds each call into the mock Streamline interposer spins for, to simulate the cost of the real one (default = 0)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarStreamlineMockFeaturesSupported(
+	TEXT("r.Streamline.Mock.FeaturesSupported"),
+	true,
+	TEXT("Whether the mock Streamline interposer reports features as supported (default = true)\n"),
+	ECVF_Default);
+
+namespace
+{
+	// one counter per mocked function, so recording a call is a single relaxed increment without locks or string work
+	enum class EMockCall : uint8
+	{
+		slAllocateResources,
+		slDLSSGGetState,
+		slDLSSGSetOptions,
+		slDeepDVCGetState,
+		slDeepDVCSetOptions,
+		slEvaluateFeature,
+		slFreeResources,
+		slGetFeatureFunction,
+		slGetFeatureRequirements,
+		slGetFeatureVersion,
+		slGetNativeInterface,
+		slGetNewFrameToken,
+		slInit,
+		slIsFeatureLoaded,
+		slIsFeatureSupported,
+		slPCLGetState,
+		slPCLSetMarker,
+		slPCLSetOptions,
+		slReflexGetState,
+		slReflexSetOptions,
+		slReflexSleep,
+		slSetConstants,
+		slSetD3DDevice,
+		slSetFeatureLoaded,
+		slSetTag,
+		slShutdown,
+		slUpgradeInterface,
+		Count
+	};
+
+	const TCHAR* const MockCallNames[] =
+	{
+		TEXT("slAllocateResources"),
+		TEXT("slDLSSGGetState"),
+		TEXT("slDLSSGSetOptions"),
+		TEXT("slDeepDVCGetState"),
+		TEXT("slDeepDVCSetOptions"),
+		TEXT("slEvaluateFeature"),
+		TEXT("slFreeResources"),
+		TEXT("slGetFeatureFunction"),
+		TEXT("slGetFeatureRequirements"),
+		TEXT("slGetFeatureVersion"),
+		TEXT("slGetNativeInterface"),
+		TEXT("slGetNewFrameToken"),
+		TEXT("slInit"),
+		TEXT("slIsFeatureLoaded"),
+		TEXT("slIsFeatureSupported"),
+		TEXT("slPCLGetState"),
+		TEXT("slPCLSetMarker"),
+		TEXT("slPCLSetOptions"),
+		TEXT("slReflexGetState"),
+		TEXT("slReflexSetOptions"),
+		TEXT("slReflexSleep"),
+		TEXT("slSetConstants"),
+		TEXT("slSetD3DDevice"),
+		TEXT("slSetFeatureLoaded"),
+		TEXT("slSetTag"),
+		TEXT("slShutdown"),
+		TEXT("slUpgradeInterface"),
+	};
+	static_assert(UE_ARRAY_COUNT(MockCallNames) == uint32(EMockCall::Count), "MockCallNames must have one entry per EMockCall");
+
+	std::atomic<uint64> MockCallCounts[uint32(EMockCall::Count)];
+
+	// one token per frame in flight, the real interposer keeps them alive the same way
+	struct FMockFrameToken : public sl::FrameToken
+	{
+		uint32_t Index = 0;
+		operator uint32_t() const override { return Index; }
+	};
+	FMockFrameToken MockFrameTokens[16];
+	uint32_t MockFrameCounter = 0;
+
+	void RecordMockCall(EMockCall Call)
+	{
+		MockCallCounts[uint32(Call)].fetch_add(1, std::memory_order_relaxed);
+
+		const double LatencySeconds = double(CVarStreamlineMockLatencyUs.GetValueOnAnyThread()) * 1e-6;
+		if (LatencySeconds > 0.0)
+		{
+			// sleeping is far too coarse for the microsecond range real Streamline calls take
+			const double EndTime = FPlatformTime::Seconds() + LatencySeconds;
+			while (FPlatformTime::Seconds() < EndTime)
+			{
+				FPlatformProcess::YieldCycles(100);
+			}
+		}
+	}
+
+	sl::Result MockDLSSGGetState(const sl::ViewportHandle& viewport, sl::DLSSGState& state, const sl::DLSSGOptions* options)
+	{
+		RecordMockCall(EMockCall::slDLSSGGetState);
+		state = sl::DLSSGState{};
+		state.status = sl::DLSSGStatus::eOk;
+		state.numFramesActuallyPresented = (options && options->mode != sl::DLSSGMode::eOff) ? 1 + options->numFramesToGenerate : 1;
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockDLSSGSetOptions(const sl::ViewportHandle& viewport, const sl::DLSSGOptions& options)
+	{
+		RecordMockCall(EMockCall::slDLSSGSetOptions);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockDeepDVCGetState(const sl::ViewportHandle& viewport, sl::DeepDVCState& state)
+	{
+		RecordMockCall(EMockCall::slDeepDVCGetState);
+		state = sl::DeepDVCState{};
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockDeepDVCSetOptions(const sl::ViewportHandle& viewport, const sl::DeepDVCOptions& options)
+	{
+		RecordMockCall(EMockCall::slDeepDVCSetOptions);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockReflexGetState(sl::ReflexState& state)
+	{
+		RecordMockCall(EMockCall::slReflexGetState);
+		state = sl::ReflexState{};
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockReflexSleep(const sl::FrameToken& frame)
+	{
+		RecordMockCall(EMockCall::slReflexSleep);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockReflexSetOptions(const sl::ReflexOptions& options)
+	{
+		RecordMockCall(EMockCall::slReflexSetOptions);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockPCLGetState(sl::PCLState& state)
+	{
+		RecordMockCall(EMockCall::slPCLGetState);
+		state = sl::PCLState{};
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockPCLSetMarker(sl::PCLMarker marker, const sl::FrameToken& frame)
+	{
+		RecordMockCall(EMockCall::slPCLSetMarker);
+		return sl::Result::eOk;
+	}
+
+	sl::Result MockPCLSetOptions(const sl::PCLOptions& options)
+	{
+		RecordMockCall(EMockCall::slPCLSetOptions);
+		return sl::Result::eOk;
+	}
+}
+
+static FAutoConsoleCommand CCmdStreamlineMockDumpCalls(
+	TEXT("r.Streamline.Mock.DumpCalls"),
+	TEXT("Logs how often each function of the mock Streamline interposer has been called"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		for (uint32 CallIndex = 0; CallIndex < uint32(EMockCall::Count); ++CallIndex)
+		{
+			const uint64 CallCount = MockCallCounts[CallIndex].load(std::memory_order_relaxed);
+			if (CallCount > 0)
+			{
+				UE_LOG(LogStreamlineRHI, Log, TEXT("%s: %llu"), MockCallNames[CallIndex], CallCount);
+			}
+		}
+	}));
+
+bool ShouldUseStreamlineMockInterposer()
+{
+	static const bool bUseMockInterposer = FParse::Param(FCommandLine::Get(), TEXT("slmockinterposer"));
+	return bUseMockInterposer;
+}
+
+void* GetStreamlineMockInterposerHandle()
+{
+	static uint8 MockHandle;
+	return &MockHandle;
+}
+
+namespace StreamlineMock
+{
+	sl::Result slInit(const sl::Preferences& pref, uint64_t sdkVersion)
+	{
+		RecordMockCall(EMockCall::slInit);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slShutdown()
+	{
+		RecordMockCall(EMockCall::slShutdown);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slIsFeatureSupported(sl::Feature feature, const sl::AdapterInfo& adapterInfo)
+	{
+		RecordMockCall(EMockCall::slIsFeatureSupported);
+		return CVarStreamlineMockFeaturesSupported.GetValueOnAnyThread() ? sl::Result::eOk : sl::Result::eErrorFeatureNotSupported;
+	}
+
+	sl::Result slIsFeatureLoaded(sl::Feature feature, bool& loaded)
+	{
+		RecordMockCall(EMockCall::slIsFeatureLoaded);
+		loaded = CVarStreamlineMockFeaturesSupported.GetValueOnAnyThread();
+		return sl::Result::eOk;
+	}
+
+	sl::Result slSetFeatureLoaded(sl::Feature feature, bool loaded)
+	{
+		RecordMockCall(EMockCall::slSetFeatureLoaded);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slEvaluateFeature(sl::Feature feature, const sl::FrameToken& frame, const sl::BaseStructure** inputs, uint32_t numInputs, sl::CommandBuffer* cmdBuffer)
+	{
+		RecordMockCall(EMockCall::slEvaluateFeature);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slAllocateResources(sl::CommandBuffer* cmdBuffer, sl::Feature feature, const sl::ViewportHandle& viewport)
+	{
+		RecordMockCall(EMockCall::slAllocateResources);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slFreeResources(sl::Feature feature, const sl::ViewportHandle& viewport)
+	{
+		RecordMockCall(EMockCall::slFreeResources);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slSetTag(const sl::ViewportHandle& viewport, const sl::ResourceTag* tags, uint32_t numTags, sl::CommandBuffer* cmdBuffer)
+	{
+		RecordMockCall(EMockCall::slSetTag);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slGetFeatureRequirements(sl::Feature feature, sl::FeatureRequirements& requirements)
+	{
+		RecordMockCall(EMockCall::slGetFeatureRequirements);
+		requirements = sl::FeatureRequirements{};
+		requirements.flags = sl::FeatureRequirementFlags(uint32(sl::FeatureRequirementFlags::eD3D11Supported) | uint32(sl::FeatureRequirementFlags::eD3D12Supported) | uint32(sl::FeatureRequirementFlags::eVulkanSupported));
+		return sl::Result::eOk;
+	}
+
+	sl::Result slGetFeatureVersion(sl::Feature feature, sl::FeatureVersion& version)
+	{
+		RecordMockCall(EMockCall::slGetFeatureVersion);
+		version = sl::FeatureVersion{};
+		return sl::Result::eOk;
+	}
+
+	sl::Result slUpgradeInterface(void** baseInterface)
+	{
+		// nothing to proxy, the caller keeps using the interface it passed in
+		RecordMockCall(EMockCall::slUpgradeInterface);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slSetConstants(const sl::Constants& values, const sl::FrameToken& frame, const sl::ViewportHandle& viewport)
+	{
+		RecordMockCall(EMockCall::slSetConstants);
+		return sl::Result::eOk;
+	}
+
+	sl::Result slGetNativeInterface(void* proxyInterface, void** baseInterface)
+	{
+		RecordMockCall(EMockCall::slGetNativeInterface);
+		*baseInterface = proxyInterface;
+		return sl::Result::eOk;
+	}
+
+	sl::Result slGetFeatureFunction(sl::Feature feature, const char* functionName, void*& function)
+	{
+		RecordMockCall(EMockCall::slGetFeatureFunction);
+
+		// only the feature functions the plugin actually uses via CALL_SL_FEATURE_FN
+		struct FMockFeatureFunction
+		{
+			const char* Name;
+			void* Function;
+		};
+		static const FMockFeatureFunction FeatureFunctions[] =
+		{
+			{ "slDLSSGGetState", reinterpret_cast<void*>(&MockDLSSGGetState) },
+			{ "slDLSSGSetOptions", reinterpret_cast<void*>(&MockDLSSGSetOptions) },
+			{ "slDeepDVCGetState", reinterpret_cast<void*>(&MockDeepDVCGetState) },
+			{ "slDeepDVCSetOptions", reinterpret_cast<void*>(&MockDeepDVCSetOptions) },
+			{ "slReflexGetState", reinterpret_cast<void*>(&MockReflexGetState) },
+			{ "slReflexSleep", reinterpret_cast<void*>(&MockReflexSleep) },
+			{ "slReflexSetOptions", reinterpret_cast<void*>(&MockReflexSetOptions) },
+			{ "slPCLGetState", reinterpret_cast<void*>(&MockPCLGetState) },
+			{ "slPCLSetMarker", reinterpret_cast<void*>(&MockPCLSetMarker) },
+			{ "slPCLSetOptions", reinterpret_cast<void*>(&MockPCLSetOptions) },
+		};
+
+		for (const FMockFeatureFunction& FeatureFunction : FeatureFunctions)
+		{
+			if (FCStringAnsi::Strcmp(FeatureFunction.Name, functionName) == 0)
+			{
+				function = FeatureFunction.Function;
+				return sl::Result::eOk;
+			}
+		}
+
+		function = nullptr;
+		return sl::Result::eErrorMissingOrInvalidAPI;
+	}
+
+	sl::Result slGetNewFrameToken(sl::FrameToken*& token, uint32_t* frameIndex)
+	{
+		RecordMockCall(EMockCall::slGetNewFrameToken);
+		const uint32_t Index = frameIndex ? *frameIndex : MockFrameCounter++;
+		FMockFrameToken& Token = MockFrameTokens[Index % UE_ARRAY_COUNT(MockFrameTokens)];
+		Token.Index = Index;
+		token = &Token;
+		return sl::Result::eOk;
+	}
+
+	sl::Result slSetD3DDevice(void* d3dDevice)
+	{
+		RecordMockCall(EMockCall::slSetD3DDevice);
+		return sl::Result::eOk;
+	}
+}
+
+#endif
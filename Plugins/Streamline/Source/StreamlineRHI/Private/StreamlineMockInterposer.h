@@ -0,0 +1,51 @@
+/*
+* Copyright (c) 2022 - 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+*
+* NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+* property and proprietary rights in and to this material, related
+* documentation and any modifications thereto. Any use, reproduction,
+* disclosure or distribution of this material and related documentation
+* without an express license agreement from NVIDIA CORPORATION or
+* its affiliates is strictly prohibited.
+*/
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "sl.h"
+
+// In-process stand-in for sl.interposer.dll, so the plugin's tagging/constants/feature logic can run and be timed without NVIDIA hardware or drivers
+#ifndef WITH_STREAMLINE_MOCK_INTERPOSER
+#define WITH_STREAMLINE_MOCK_INTERPOSER (!UE_BUILD_SHIPPING)
+#endif
+
+#if WITH_STREAMLINE_MOCK_INTERPOSER
+
+// True when -slmockinterposer is on the command line
+bool ShouldUseStreamlineMockInterposer();
+
+// Stands in for the interposer DLL handle so the checks in StreamlineAPI.cpp pass
+void* GetStreamlineMockInterposerHandle();
+
+namespace StreamlineMock
+{
+	sl::Result slInit(const sl::Preferences& pref, uint64_t sdkVersion);
+	sl::Result slShutdown();
+	sl::Result slIsFeatureSupported(sl::Feature feature, const sl::AdapterInfo& adapterInfo);
+	sl::Result slIsFeatureLoaded(sl::Feature feature, bool& loaded);
+	sl::Result slSetFeatureLoaded(sl::Feature feature, bool loaded);
+	sl::Result slEvaluateFeature(sl::Feature feature, const sl::FrameToken& frame, const sl::BaseStructure** inputs, uint32_t numInputs, sl::CommandBuffer* cmdBuffer);
+	sl::Result slAllocateResources(sl::CommandBuffer* cmdBuffer, sl::Feature feature, const sl::ViewportHandle& viewport);
+	sl::Result slFreeResources(sl::Feature feature, const sl::ViewportHandle& viewport);
+	sl::Result slSetTag(const sl::ViewportHandle& viewport, const sl::ResourceTag* tags, uint32_t numTags, sl::CommandBuffer* cmdBuffer);
+	sl::Result slGetFeatureRequirements(sl::Feature feature, sl::FeatureRequirements& requirements);
+	sl::Result slGetFeatureVersion(sl::Feature feature, sl::FeatureVersion& version);
+	sl::Result slUpgradeInterface(void** baseInterface);
+	sl::Result slSetConstants(const sl::Constants& values, const sl::FrameToken& frame, const sl::ViewportHandle& viewport);
+	sl::Result slGetNativeInterface(void* proxyInterface, void** baseInterface);
+	sl::Result slGetFeatureFunction(sl::Feature feature, const char* functionName, void*& function);
+	sl::Result slGetNewFrameToken(sl::FrameToken*& token, uint32_t* frameIndex);
+	sl::Result slSetD3DDevice(void* d3dDevice);
+}
+
+#endif
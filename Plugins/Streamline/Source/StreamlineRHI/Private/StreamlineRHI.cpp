@@ -123,30 +123,43 @@ static int32 GetNGXAppID(bool bIsDLSSPluginEnabled)
 // TODO: the derived RHIs will set this to true during their initialization
 bool FStreamlineRHI::bIsIncompatibleAPICaptureToolActive = false;
 TArray<sl::Feature> FStreamlineRHI::FeaturesRequestedAtSLInitTime;
-FSLFrameTokenProvider::FSLFrameTokenProvider() : Section()
+FSLFrameTokenProvider::FSLFrameTokenProvider()
 {
-	// truncated to 32 bits because that's all SL stores
-	LastFrameCounter = static_cast<uint32_t>(GFrameCounter);
-	SLgetNewFrameToken(FrameToken, &LastFrameCounter);
+	GetTokenForFrame(GFrameCounter);
 }
 
 sl::FrameToken* FSLFrameTokenProvider::GetTokenForFrame(uint64 FrameCounter)
 {
-	uint32_t FrameCounter32 = static_cast<uint32_t>(FrameCounter);
-	FScopeLock Lock(&Section);
-	if (FrameCounter32 == LastFrameCounter)
+	FSlot& Slot = Slots[FrameCounter % NumSlots];
+
+	// the token is only valid if the slot still holds the same frame after reading it, writers park the slot in WritingSlot first
+	const uint64 SlotFrameCounter = Slot.FrameCounter.load(std::memory_order_acquire);
+	if (SlotFrameCounter == FrameCounter)
 	{
-		return FrameToken;
+		sl::FrameToken* FrameToken = Slot.FrameToken.load(std::memory_order_acquire);
+		if (Slot.FrameCounter.load(std::memory_order_relaxed) == FrameCounter)
+		{
+			return FrameToken;
+		}
 	}
 
+	// truncated to 32 bits because that's all SL stores
+	uint32_t FrameCounter32 = static_cast<uint32_t>(FrameCounter);
+	sl::FrameToken* FrameToken = nullptr;
 	// this should be safe, we can create multiple tokens to track the same frame
-	LastFrameCounter = FrameCounter32;
-	SLgetNewFrameToken(FrameToken, &LastFrameCounter);
+	SLgetNewFrameToken(FrameToken, &FrameCounter32);
+
+	// if another thread is filling the slot right now it wins, the token we got is just as good for this call
+	uint64 ExpectedFrameCounter = SlotFrameCounter;
+	if (ExpectedFrameCounter != WritingSlot && Slot.FrameCounter.compare_exchange_strong(ExpectedFrameCounter, WritingSlot, std::memory_order_acq_rel))
+	{
+		Slot.FrameToken.store(FrameToken, std::memory_order_release);
+		Slot.FrameCounter.store(FrameCounter, std::memory_order_release);
+	}
 
 	return FrameToken;
 }
 
-
 FStreamlineRHI::FStreamlineRHI(const FStreamlineRHICreateArguments& Arguments)
 	: DynamicRHI(Arguments.DynamicRHI), FrameTokenProvider(MakeUnique<FSLFrameTokenProvider>())
 {
@@ -14,6 +14,8 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogStreamlineRHI, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("Streamline"), STATGROUP_Streamline, STATCAT_Advanced);
+
 bool slVerifyEmbeddedSignature(const FString& PathToBinary);
 
 bool LoadStreamlineFunctionPointers(const FString& InterposerBinaryPath);
@@ -40,6 +40,20 @@ extern STREAMLINERHI_API sl::Result SLsetD3DDevice(void* d3dDevice);
 
 extern STREAMLINERHI_API void LogStreamlineFunctionCall(const FString& Function, const FString& Arguments);
 
+// Times one call into Streamline for the STATGROUP_Streamline stats and the Streamline CSV category. FunctionName must be a string literal.
+struct STREAMLINERHI_API FStreamlineCallScope
+{
+	explicit FStreamlineCallScope(const char* InFunctionName)
+		: FunctionName(InFunctionName)
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+	~FStreamlineCallScope();
+
+	const char* FunctionName;
+	uint64 StartCycles;
+};
+
 struct StringifySLArgument
 {
 	TArray<FString> ArgStrings;
@@ -139,6 +153,7 @@ template<typename F, typename... Ts> static sl::Result CallSLFeatureFn(sl::Featu
 		LogStreamlineFunctionCall(FString::Printf(TEXT("%s"), ANSI_TO_TCHAR(FunctionName)), Stringifier.GetJoinedArgString());
 	}
 
+	FStreamlineCallScope CallScope(FunctionName);
 	return PtrFn(std::forward<Ts>(args)...);
 }
 #define CALL_SL_FEATURE_FN(Feature, FunctionName, ...) CallSLFeatureFn<decltype(&FunctionName)>(Feature, #FunctionName, __VA_ARGS__)
@@ -16,6 +16,8 @@
 #include "RendererInterface.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+#include <atomic>
+
 namespace sl
 {
 	struct AdapterInfo;
@@ -139,6 +141,8 @@ struct FStreamlineRHICreateArguments
 	FDynamicRHI* DynamicRHI = nullptr;
 };
 
+// Lock-free lookup of the Streamline frame token for a frame, callable from any thread.
+// Tokens are cached in a small ring indexed by frame number so the render and RHI threads can each be working on a different frame
 class FSLFrameTokenProvider
 {
 public:
@@ -147,9 +151,16 @@ public:
 	sl::FrameToken* GetTokenForFrame(uint64 FrameCounter);
 
 private:
-	FCriticalSection Section;
-	sl::FrameToken* FrameToken;
-	uint32_t LastFrameCounter;
+	static constexpr uint32 NumSlots = 8;
+	static constexpr uint64 EmptySlot = MAX_uint64 - 1;
+	static constexpr uint64 WritingSlot = MAX_uint64;
+
+	struct FSlot
+	{
+		std::atomic<uint64> FrameCounter{ EmptySlot };
+		std::atomic<sl::FrameToken*> FrameToken{ nullptr };
+	};
+	FSlot Slots[NumSlots];
 };
 
 
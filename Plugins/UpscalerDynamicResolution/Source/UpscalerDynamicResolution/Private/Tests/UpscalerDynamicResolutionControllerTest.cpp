@@ -0,0 +1,79 @@
+#include "UpscalerDynamicResolutionController.h"
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUpscalerDynamicResolutionSimulateTest, "Plugins.UpscalerDynamicResolution.Simulate.HeavySceneCut",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUpscalerDynamicResolutionSimulateTest::RunTest(const FString& Parameters)
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UpscalerDynamicResolution"));
+	if (!Plugin.IsValid())
+	{
+		AddError(TEXT("UpscalerDynamicResolution plugin not found"));
+		return false;
+	}
+
+	// 5 s at 12 ms, 5 s at 22 ms, 5 s at 12 ms again, all recorded at full resolution
+	const FString TraceFilename = FPaths::Combine(Plugin->GetBaseDir(), TEXT("Resources/Traces/HeavySceneCut.csv"));
+	TArray<FUpscalerDynamicResolutionTraceFrame> Trace;
+	if (!FUpscalerDynamicResolutionController::LoadTrace(TraceFilename, Trace))
+	{
+		AddError(FString::Printf(TEXT("Could not read any frames from %s"), *TraceFilename));
+		return false;
+	}
+	TestEqual(TEXT("Trace frames"), Trace.Num(), 900);
+
+	const FUpscalerDynamicResolutionSettings Settings;
+	TArray<float> ResolutionFractions;
+	const FUpscalerDynamicResolutionTelemetry Telemetry = FUpscalerDynamicResolutionController::Simulate(Trace, Settings, 0.8f, &ResolutionFractions);
+
+	TestEqual(TEXT("Simulated frames"), Telemetry.NumFrames, uint64(Trace.Num()));
+	TestEqual(TEXT("Resolution fraction per frame"), ResolutionFractions.Num(), Trace.Num());
+
+	// the heavy section needs a resolution fraction of about 0.8 to fit the budget, the controller has to go there and come back up, without hunting in between
+	TestTrue(TEXT("Resolution dropped in the heavy section"), Telemetry.LowestResolutionFraction < 0.9f);
+	TestTrue(TEXT("Resolution stayed above the minimum"), Telemetry.LowestResolutionFraction >= Settings.MinResolutionFraction);
+	TestTrue(FString::Printf(TEXT("Resolution changes per minute (%.1f)"), Telemetry.GetResolutionChangesPerMinute()), Telemetry.GetResolutionChangesPerMinute() <= 40.0);
+
+	// the cut itself misses the budget until the controller catches up, it must not keep missing after that
+	TestTrue(FString::Printf(TEXT("Budget misses (%llu)"), Telemetry.NumBudgetMisses), Telemetry.NumBudgetMisses <= 75);
+
+	TestEqual(TEXT("Final resolution fraction"), ResolutionFractions.Last(), Settings.MaxResolutionFraction);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FUpscalerDynamicResolutionBoundsTest, "Plugins.UpscalerDynamicResolution.Simulate.InvertedBounds",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FUpscalerDynamicResolutionBoundsTest::RunTest(const FString& Parameters)
+{
+	FUpscalerDynamicResolutionSettings Settings;
+	Settings.MinResolutionFraction = 0.8f;
+	Settings.MaxResolutionFraction = 0.6f;
+
+	const FUpscalerDynamicResolutionController Controller(Settings);
+	TestTrue(TEXT("Min clamped to Max"), Controller.GetSettings().MinResolutionFraction <= Controller.GetSettings().MaxResolutionFraction);
+	TestEqual(TEXT("Initial resolution fraction"), Controller.GetResolutionFraction(), 0.6f);
+
+	// a frame without a recorded resolution fraction must not poison the replay
+	TArray<FUpscalerDynamicResolutionTraceFrame> Trace;
+	Trace.Add({ 20.0f, 20.0f, 0.0f });
+	Trace.Add({ 12.0f, 16.7f, 1.0f });
+
+	TArray<float> ResolutionFractions;
+	FUpscalerDynamicResolutionController::Simulate(Trace, FUpscalerDynamicResolutionSettings(), 0.8f, &ResolutionFractions);
+	for (const float ResolutionFraction : ResolutionFractions)
+	{
+		TestTrue(TEXT("Finite resolution fraction"), FMath::IsFinite(ResolutionFraction));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,158 @@
+#include "UpscalerDynamicResolutionController.h"
+
+#include "Misc/FileHelper.h"
+
+FUpscalerDynamicResolutionController::FUpscalerDynamicResolutionController(const FUpscalerDynamicResolutionSettings& InSettings)
+	: PixelCountFraction(FMath::Square(InSettings.MaxResolutionFraction))
+	, ResolutionFraction(InSettings.MaxResolutionFraction)
+	, FramesSinceChange(InSettings.IncreaseCooldownFrames)
+{
+	SetSettings(InSettings);
+}
+
+void FUpscalerDynamicResolutionController::SetSettings(const FUpscalerDynamicResolutionSettings& InSettings)
+{
+	Settings = InSettings;
+	Settings.MinResolutionFraction = FMath::Min(Settings.MinResolutionFraction, Settings.MaxResolutionFraction);
+
+	PixelCountFraction = FMath::Clamp(PixelCountFraction, FMath::Square(Settings.MinResolutionFraction), FMath::Square(Settings.MaxResolutionFraction));
+	ResolutionFraction = FMath::Clamp(ResolutionFraction, Settings.MinResolutionFraction, Settings.MaxResolutionFraction);
+}
+
+bool FUpscalerDynamicResolutionController::Update(float GPUFrameTimeMs, float FrameTimeMs)
+{
+	const float Budget = FMath::Max(Settings.FrameTimeBudgetMs, UE_KINDA_SMALL_NUMBER);
+
+	Telemetry.NumFrames++;
+	Telemetry.ElapsedMs += FMath::Max(FrameTimeMs, GPUFrameTimeMs);
+	if (GPUFrameTimeMs > Budget)
+	{
+		Telemetry.NumBudgetMisses++;
+	}
+
+	// aim for the middle of the band just under the budget, aiming at the budget itself would miss it every other frame.
+	// Positive is headroom, normalized so the gains don't depend on the budget
+	const float Target = Budget * (1.0f - Settings.HysteresisBand);
+	float Error = FMath::Clamp((Target - GPUFrameTimeMs) / Budget, -1.0f, 1.0f);
+	if (FMath::Abs(Error) <= Settings.HysteresisBand)
+	{
+		Error = 0.0f;
+	}
+
+	// velocity form, the output itself is the integrator so clamping it to the bounds can't wind anything up
+	const float Delta = Settings.ProportionalGain * (Error - PreviousError)
+		+ Settings.IntegralGain * Error
+		+ Settings.DerivativeGain * (Error - 2.0f * PreviousError + PreviousPreviousError);
+	PreviousPreviousError = PreviousError;
+	PreviousError = Error;
+
+	const float MinPixelCountFraction = FMath::Square(Settings.MinResolutionFraction);
+	const float MaxPixelCountFraction = FMath::Square(Settings.MaxResolutionFraction);
+	PixelCountFraction = FMath::Clamp(PixelCountFraction + Delta, MinPixelCountFraction, MaxPixelCountFraction);
+
+	// land exactly on the bounds, otherwise the last bit before them would always be under the minimum step
+	const float DesiredResolutionFraction =
+		PixelCountFraction <= MinPixelCountFraction ? Settings.MinResolutionFraction :
+		PixelCountFraction >= MaxPixelCountFraction ? Settings.MaxResolutionFraction :
+		FMath::Sqrt(PixelCountFraction);
+	const float Step = DesiredResolutionFraction - ResolutionFraction;
+	const bool bReachesBound = Step != 0.0f && (DesiredResolutionFraction == Settings.MinResolutionFraction || DesiredResolutionFraction == Settings.MaxResolutionFraction);
+	const bool bLargeEnough = FMath::Abs(Step) >= Settings.MinResolutionFractionStep || bReachesBound;
+
+	FramesSinceChange++;
+
+	bool bChanged = false;
+	if (bLargeEnough && (Step < 0.0f || FramesSinceChange >= Settings.IncreaseCooldownFrames))
+	{
+		ResolutionFraction = DesiredResolutionFraction;
+		FramesSinceChange = 0;
+		Telemetry.NumResolutionChanges++;
+		bChanged = true;
+	}
+
+	Telemetry.LowestResolutionFraction = FMath::Min(Telemetry.LowestResolutionFraction, ResolutionFraction);
+	Telemetry.HighestResolutionFraction = FMath::Max(Telemetry.HighestResolutionFraction, ResolutionFraction);
+
+	return bChanged;
+}
+
+void FUpscalerDynamicResolutionController::ResetHistory()
+{
+	PreviousError = 0.0f;
+	PreviousPreviousError = 0.0f;
+	FramesSinceChange = Settings.IncreaseCooldownFrames;
+}
+
+void FUpscalerDynamicResolutionController::ResetTelemetry()
+{
+	Telemetry = FUpscalerDynamicResolutionTelemetry();
+}
+
+bool FUpscalerDynamicResolutionController::LoadTrace(const FString& Filename, TArray<FUpscalerDynamicResolutionTraceFrame>& OutTrace)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		return false;
+	}
+
+	OutTrace.Reset(Lines.Num());
+
+	TArray<FString> Columns;
+	for (const FString& Line : Lines)
+	{
+		const FString TrimmedLine = Line.TrimStartAndEnd();
+		if (TrimmedLine.IsEmpty() || !(FChar::IsDigit(TrimmedLine[0]) || TrimmedLine[0] == TEXT('.')))
+		{
+			// header or comment
+			continue;
+		}
+
+		TrimmedLine.ParseIntoArray(Columns, TEXT(","));
+
+		FUpscalerDynamicResolutionTraceFrame Frame;
+		LexFromString(Frame.GPUFrameTimeMs, *Columns[0]);
+		Frame.FrameTimeMs = Frame.GPUFrameTimeMs;
+		if (Columns.Num() > 1)
+		{
+			LexFromString(Frame.FrameTimeMs, *Columns[1]);
+		}
+		if (Columns.Num() > 2)
+		{
+			LexFromString(Frame.ResolutionFraction, *Columns[2]);
+		}
+
+		if (Frame.ResolutionFraction > 0.0f)
+		{
+			OutTrace.Add(Frame);
+		}
+	}
+
+	return OutTrace.Num() > 0;
+}
+
+FUpscalerDynamicResolutionTelemetry FUpscalerDynamicResolutionController::Simulate(const TArray<FUpscalerDynamicResolutionTraceFrame>& Trace, const FUpscalerDynamicResolutionSettings& InSettings, float PixelBoundShare, TArray<float>* OutResolutionFractions)
+{
+	FUpscalerDynamicResolutionController Controller(InSettings);
+
+	if (OutResolutionFractions)
+	{
+		OutResolutionFractions->Reset(Trace.Num());
+	}
+
+	for (const FUpscalerDynamicResolutionTraceFrame& Frame : Trace)
+	{
+		// frames from LoadTrace always have a resolution fraction, hand built traces might not
+		const float PixelCountScale = FMath::Square(Controller.GetResolutionFraction() / FMath::Max(Frame.ResolutionFraction, UE_KINDA_SMALL_NUMBER));
+		const float GPUFrameTimeMs = Frame.GPUFrameTimeMs * FMath::Lerp(1.0f, PixelCountScale, PixelBoundShare);
+
+		Controller.Update(GPUFrameTimeMs, FMath::Max(Frame.FrameTimeMs, GPUFrameTimeMs));
+
+		if (OutResolutionFractions)
+		{
+			OutResolutionFractions->Add(Controller.GetResolutionFraction());
+		}
+	}
+
+	return Controller.GetTelemetry();
+}
@@ -0,0 +1,106 @@
+#include "UpscalerDynamicResolutionState.h"
+
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "Modules/ModuleManager.h"
+
+static TAutoConsoleVariable<bool> CVarUpscalerDynRes(
+	TEXT("r.UpscalerDynRes"),
+	false,
+	TEXT("Replace the engine's dynamic resolution heuristic with the GPU frame time driven controller at startup, read only (default = false)\n")
+	TEXT("Dynamic resolution itself still has to be enabled, e.g. with r.DynamicRes.OperationMode=2\n"),
+	ECVF_ReadOnly);
+
+class FUpscalerDynamicResolutionModule final : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		if (CVarUpscalerDynRes.GetValueOnGameThread() && GEngine)
+		{
+			DynamicResolutionState = MakeShared<FUpscalerDynamicResolutionState>();
+			GEngine->ChangeDynamicResolutionStateAtNextFrame(DynamicResolutionState);
+			UE_LOG(LogUpscalerDynRes, Log, TEXT("GPU frame time driven dynamic resolution installed"));
+		}
+	}
+
+	virtual void ShutdownModule() override
+	{
+		// the engine keeps its own reference until it shuts down
+		DynamicResolutionState.Reset();
+	}
+
+	static TSharedPtr<FUpscalerDynamicResolutionState> GetDynamicResolutionState()
+	{
+		FUpscalerDynamicResolutionModule* Module = FModuleManager::GetModulePtr<FUpscalerDynamicResolutionModule>(TEXT("UpscalerDynamicResolution"));
+		return Module ? Module->DynamicResolutionState : nullptr;
+	}
+
+private:
+	TSharedPtr<FUpscalerDynamicResolutionState> DynamicResolutionState;
+};
+
+IMPLEMENT_MODULE(FUpscalerDynamicResolutionModule, UpscalerDynamicResolution)
+
+static FAutoConsoleCommand CCmdUpscalerDynResDumpTelemetry(
+	TEXT("r.UpscalerDynRes.DumpTelemetry"),
+	TEXT("Logs the budget misses and resolution changes per minute of the dynamic resolution controller"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (TSharedPtr<FUpscalerDynamicResolutionState> State = FUpscalerDynamicResolutionModule::GetDynamicResolutionState())
+		{
+			State->LogTelemetry();
+		}
+		else
+		{
+			UE_LOG(LogUpscalerDynRes, Log, TEXT("Not installed, set r.UpscalerDynRes=1 in the ini files"));
+		}
+	}));
+
+static FAutoConsoleCommand CCmdUpscalerDynResResetTelemetry(
+	TEXT("r.UpscalerDynRes.ResetTelemetry"),
+	TEXT("Restarts the telemetry of the dynamic resolution controller"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (TSharedPtr<FUpscalerDynamicResolutionState> State = FUpscalerDynamicResolutionModule::GetDynamicResolutionState())
+		{
+			State->ResetTelemetry();
+		}
+	}));
+
+static FAutoConsoleCommand CCmdUpscalerDynResSimulate(
+	TEXT("r.UpscalerDynRes.Simulate"),
+	TEXT("Replays a recorded frame time trace through the dynamic resolution controller with the current settings and logs the telemetry\n")
+	TEXT("Usage: r.UpscalerDynRes.Simulate <TraceFile.csv> [PixelBoundShare=0.8]\n")
+	TEXT("One frame per line as GPUFrameTimeMs[,FrameTimeMs[,ResolutionFraction]]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() < 1)
+		{
+			UE_LOG(LogUpscalerDynRes, Warning, TEXT("Usage: r.UpscalerDynRes.Simulate <TraceFile.csv> [PixelBoundShare=0.8]"));
+			return;
+		}
+
+		TArray<FUpscalerDynamicResolutionTraceFrame> Trace;
+		if (!FUpscalerDynamicResolutionController::LoadTrace(Args[0], Trace))
+		{
+			UE_LOG(LogUpscalerDynRes, Warning, TEXT("Could not read any frames from %s"), *Args[0]);
+			return;
+		}
+
+		float PixelBoundShare = 0.8f;
+		if (Args.Num() > 1)
+		{
+			LexFromString(PixelBoundShare, *Args[1]);
+		}
+
+		const TCHAR* BoundsSource = nullptr;
+		const FUpscalerDynamicResolutionSettings Settings = GetUpscalerDynamicResolutionSettings(&BoundsSource);
+		const FUpscalerDynamicResolutionTelemetry Telemetry = FUpscalerDynamicResolutionController::Simulate(Trace, Settings, FMath::Clamp(PixelBoundShare, 0.0f, 1.0f));
+
+		UE_LOG(LogUpscalerDynRes, Log, TEXT("%s: budget %.2f ms, %s bounds %.3f - %.3f, pixel bound share %.2f"),
+			*Args[0], Settings.FrameTimeBudgetMs, BoundsSource, Settings.MinResolutionFraction, Settings.MaxResolutionFraction, PixelBoundShare);
+		UE_LOG(LogUpscalerDynRes, Log, TEXT("%llu frames over %.1f s, %llu budget misses (%.1f%%), %llu resolution changes (%.1f per minute), resolution fraction range %.3f - %.3f"),
+			Telemetry.NumFrames, Telemetry.ElapsedMs / 1000.0, Telemetry.NumBudgetMisses, Telemetry.GetBudgetMissRate() * 100.0,
+			Telemetry.NumResolutionChanges, Telemetry.GetResolutionChangesPerMinute(), Telemetry.LowestResolutionFraction, Telemetry.HighestResolutionFraction);
+	}));
@@ -0,0 +1,224 @@
+#include "UpscalerDynamicResolutionState.h"
+
+#include "IUpscalerDynamicResolutionBounds.h"
+
+#include "Features/IModularFeatures.h"
+#include "HAL/IConsoleManager.h"
+#include "LegacyScreenPercentageDriver.h"
+#include "Misc/App.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "RHI.h"
+#include "SceneView.h"
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResFrameTimeBudget(
+	TEXT("r.UpscalerDynRes.FrameTimeBudget"),
+	16.6f,
+	TEXT("GPU frame time in milliseconds the dynamic resolution controller aims for (default = 16.6)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResProportionalGain(
+	TEXT("r.UpscalerDynRes.ProportionalGain"),
+	0.3f,
+	TEXT("Proportional gain of the dynamic resolution controller (default = 0.3)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResIntegralGain(
+	TEXT("r.UpscalerDynRes.IntegralGain"),
+	0.05f,
+	TEXT("Integral gain of the dynamic resolution controller (default = 0.05)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResDerivativeGain(
+	TEXT("r.UpscalerDynRes.DerivativeGain"),
+	0.05f,
+	TEXT("Derivative gain of the dynamic resolution controller (default = 0.05)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResHysteresisBand(
+	TEXT("r.UpscalerDynRes.HysteresisBand"),
+	0.05f,
+	TEXT("GPU frame times within this fraction of the budget are considered on target (default = 0.05)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarUpscalerDynResMinStep(
+	TEXT("r.UpscalerDynRes.MinStep"),
+	0.02f,
+	TEXT("Smallest change of the resolution fraction that is applied (default = 0.02)\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarUpscalerDynResIncreaseCooldownFrames(
+	TEXT("r.UpscalerDynRes.IncreaseCooldownFrames"),
+	30,
+	TEXT("Frames to wait after a resolution change before the resolution may go up again (default = 30)\n"),
+	ECVF_Default);
+
+DECLARE_STATS_GROUP(TEXT("Upscaler Dynamic Resolution"), STATGROUP_UpscalerDynRes, STATCAT_Advanced);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Resolution fraction"), STAT_UpscalerDynResResolutionFraction, STATGROUP_UpscalerDynRes);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Resolution changes per minute"), STAT_UpscalerDynResChangesPerMinute, STATGROUP_UpscalerDynRes);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Budget miss rate"), STAT_UpscalerDynResBudgetMissRate, STATGROUP_UpscalerDynRes);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Resolution changes"), STAT_UpscalerDynResChanges, STATGROUP_UpscalerDynRes);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Budget misses"), STAT_UpscalerDynResBudgetMisses, STATGROUP_UpscalerDynRes);
+
+CSV_DEFINE_CATEGORY(UpscalerDynRes, true);
+
+DEFINE_LOG_CATEGORY(LogUpscalerDynRes);
+
+FUpscalerDynamicResolutionSettings GetUpscalerDynamicResolutionSettings(const TCHAR** OutBoundsSource)
+{
+	static const auto CVarMinScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.DynamicRes.MinScreenPercentage"));
+	static const auto CVarMaxScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.DynamicRes.MaxScreenPercentage"));
+
+	FUpscalerDynamicResolutionSettings Settings;
+	Settings.FrameTimeBudgetMs = CVarUpscalerDynResFrameTimeBudget.GetValueOnGameThread();
+	Settings.ProportionalGain = CVarUpscalerDynResProportionalGain.GetValueOnGameThread();
+	Settings.IntegralGain = CVarUpscalerDynResIntegralGain.GetValueOnGameThread();
+	Settings.DerivativeGain = CVarUpscalerDynResDerivativeGain.GetValueOnGameThread();
+	Settings.HysteresisBand = CVarUpscalerDynResHysteresisBand.GetValueOnGameThread();
+	Settings.MinResolutionFractionStep = CVarUpscalerDynResMinStep.GetValueOnGameThread();
+	Settings.IncreaseCooldownFrames = CVarUpscalerDynResIncreaseCooldownFrames.GetValueOnGameThread();
+
+	if (CVarMinScreenPercentage && CVarMaxScreenPercentage)
+	{
+		Settings.MinResolutionFraction = CVarMinScreenPercentage->GetFloat() / 100.0f;
+		Settings.MaxResolutionFraction = CVarMaxScreenPercentage->GetFloat() / 100.0f;
+	}
+
+	const TCHAR* BoundsSource = TEXT("r.DynamicRes");
+
+	IModularFeatures::FScopedLockModularFeatureList ScopedLock;
+	const TArray<IUpscalerDynamicResolutionBounds*> UpscalerBounds = IModularFeatures::Get().GetModularFeatureImplementations<IUpscalerDynamicResolutionBounds>(IUpscalerDynamicResolutionBounds::GetModularFeatureName());
+	for (const IUpscalerDynamicResolutionBounds* Bounds : UpscalerBounds)
+	{
+		if (Bounds->IsActive())
+		{
+			const float UpscalerMin = Bounds->GetMinResolutionFraction();
+			const float UpscalerMax = Bounds->GetMaxResolutionFraction();
+
+			// the upscaler's range wins when the two don't overlap, it would reject anything outside of it
+			Settings.MinResolutionFraction = FMath::Clamp(Settings.MinResolutionFraction, UpscalerMin, UpscalerMax);
+			Settings.MaxResolutionFraction = FMath::Clamp(Settings.MaxResolutionFraction, UpscalerMin, UpscalerMax);
+			BoundsSource = Bounds->GetDebugName();
+			break;
+		}
+	}
+
+	Settings.MinResolutionFraction = FMath::Min(Settings.MinResolutionFraction, Settings.MaxResolutionFraction);
+
+	if (OutBoundsSource)
+	{
+		*OutBoundsSource = BoundsSource;
+	}
+
+	return Settings;
+}
+
+FUpscalerDynamicResolutionState::FUpscalerDynamicResolutionState()
+	: Controller(GetUpscalerDynamicResolutionSettings(&BoundsSource))
+{
+}
+
+bool FUpscalerDynamicResolutionState::IsSupported() const
+{
+	return GRHISupportsDynamicResolution;
+}
+
+void FUpscalerDynamicResolutionState::ResetHistory()
+{
+	Controller.ResetHistory();
+}
+
+void FUpscalerDynamicResolutionState::SetEnabled(bool bEnable)
+{
+	bEnabled = bEnable;
+}
+
+bool FUpscalerDynamicResolutionState::IsEnabled() const
+{
+	return bEnabled;
+}
+
+DynamicRenderScaling::TMap<float> FUpscalerDynamicResolutionState::GetResolutionFractionsApproximation() const
+{
+	DynamicRenderScaling::TMap<float> ResolutionFractions;
+	ResolutionFractions.SetAll(1.0f);
+	ResolutionFractions[GDynamicPrimaryResolutionFraction] = Controller.GetResolutionFraction();
+	return ResolutionFractions;
+}
+
+DynamicRenderScaling::TMap<float> FUpscalerDynamicResolutionState::GetResolutionFractionsUpperBound() const
+{
+	DynamicRenderScaling::TMap<float> ResolutionFractions;
+	ResolutionFractions.SetAll(1.0f);
+	ResolutionFractions[GDynamicPrimaryResolutionFraction] = Controller.GetSettings().MaxResolutionFraction;
+	return ResolutionFractions;
+}
+
+void FUpscalerDynamicResolutionState::SetupMainViewFamily(FSceneViewFamily& ViewFamily)
+{
+	check(IsInGameThread());
+
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	ViewFamily.SetScreenPercentageInterface(new FLegacyScreenPercentageDriver(
+		ViewFamily, GetResolutionFractionsApproximation(), GetResolutionFractionsUpperBound()));
+}
+
+void FUpscalerDynamicResolutionState::ProcessEvent(EDynamicResolutionStateEvent Event)
+{
+	if (Event != EDynamicResolutionStateEvent::BeginFrame || !bEnabled)
+	{
+		return;
+	}
+
+	// the bounds follow the active upscaler, which can change with any console variable
+	Controller.SetSettings(GetUpscalerDynamicResolutionSettings(&BoundsSource));
+
+	// the RHI only has the GPU time of a frame from a couple of frames ago, and none at all on some platforms
+	const float GPUFrameTimeMs = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+	if (GPUFrameTimeMs <= 0.0f)
+	{
+		return;
+	}
+
+	const uint64 PreviousBudgetMisses = Controller.GetTelemetry().NumBudgetMisses;
+	if (Controller.Update(GPUFrameTimeMs, float(FApp::GetDeltaTime() * 1000.0)))
+	{
+		INC_DWORD_STAT(STAT_UpscalerDynResChanges);
+		UE_LOG(LogUpscalerDynRes, Verbose, TEXT("GPU frame time %.2f ms, resolution fraction now %.3f (%s bounds %.3f - %.3f)"),
+			GPUFrameTimeMs, Controller.GetResolutionFraction(), BoundsSource, Controller.GetSettings().MinResolutionFraction, Controller.GetSettings().MaxResolutionFraction);
+	}
+
+	const FUpscalerDynamicResolutionTelemetry& Telemetry = Controller.GetTelemetry();
+	const bool bBudgetMissed = Telemetry.NumBudgetMisses != PreviousBudgetMisses;
+	if (bBudgetMissed)
+	{
+		INC_DWORD_STAT(STAT_UpscalerDynResBudgetMisses);
+	}
+
+	SET_FLOAT_STAT(STAT_UpscalerDynResResolutionFraction, Controller.GetResolutionFraction());
+	SET_FLOAT_STAT(STAT_UpscalerDynResChangesPerMinute, Telemetry.GetResolutionChangesPerMinute());
+	SET_FLOAT_STAT(STAT_UpscalerDynResBudgetMissRate, Telemetry.GetBudgetMissRate());
+
+	CSV_CUSTOM_STAT(UpscalerDynRes, ResolutionFraction, Controller.GetResolutionFraction(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UpscalerDynRes, GPUFrameTimeMs, GPUFrameTimeMs, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(UpscalerDynRes, BudgetMiss, bBudgetMissed ? 1 : 0, ECsvCustomStatOp::Set);
+}
+
+void FUpscalerDynamicResolutionState::LogTelemetry() const
+{
+	const FUpscalerDynamicResolutionTelemetry& Telemetry = Controller.GetTelemetry();
+	UE_LOG(LogUpscalerDynRes, Log, TEXT("%s, resolution fraction %.3f (%s bounds %.3f - %.3f)"),
+		bEnabled ? TEXT("Enabled") : TEXT("Disabled"), Controller.GetResolutionFraction(), BoundsSource,
+		Controller.GetSettings().MinResolutionFraction, Controller.GetSettings().MaxResolutionFraction);
+	UE_LOG(LogUpscalerDynRes, Log, TEXT("%llu frames over %.1f s, %llu budget misses (%.1f%%), %llu resolution changes (%.1f per minute), resolution fraction range %.3f - %.3f"),
+		Telemetry.NumFrames, Telemetry.ElapsedMs / 1000.0, Telemetry.NumBudgetMisses, Telemetry.GetBudgetMissRate() * 100.0,
+		Telemetry.NumResolutionChanges, Telemetry.GetResolutionChangesPerMinute(), Telemetry.LowestResolutionFraction, Telemetry.HighestResolutionFraction);
+}
+
+void FUpscalerDynamicResolutionState::ResetTelemetry()
+{
+	Controller.ResetTelemetry();
+}
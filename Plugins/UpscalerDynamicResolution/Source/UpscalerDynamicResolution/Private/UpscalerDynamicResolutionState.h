@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicResolutionState.h"
+
+#include "UpscalerDynamicResolutionController.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogUpscalerDynRes, Log, All);
+
+// Reads the settings from the r.UpscalerDynRes.* console variables, clamped to the r.DynamicRes.* screen percentage range
+// and the bounds of the active upscaler
+FUpscalerDynamicResolutionSettings GetUpscalerDynamicResolutionSettings(const TCHAR** OutBoundsSource = nullptr);
+
+// Replaces the engine's dynamic resolution heuristic, drives the primary screen percentage from the GPU frame time
+class FUpscalerDynamicResolutionState final : public IDynamicResolutionState
+{
+public:
+	FUpscalerDynamicResolutionState();
+
+	// IDynamicResolutionState
+	virtual bool IsSupported() const override;
+	virtual void ResetHistory() override;
+	virtual void SetEnabled(bool bEnable) override;
+	virtual bool IsEnabled() const override;
+	virtual DynamicRenderScaling::TMap<float> GetResolutionFractionsApproximation() const override;
+	virtual DynamicRenderScaling::TMap<float> GetResolutionFractionsUpperBound() const override;
+	virtual void SetupMainViewFamily(class FSceneViewFamily& ViewFamily) override;
+
+	void LogTelemetry() const;
+	void ResetTelemetry();
+
+protected:
+	virtual void ProcessEvent(EDynamicResolutionStateEvent Event) override;
+
+private:
+	FUpscalerDynamicResolutionController Controller;
+	const TCHAR* BoundsSource = nullptr;
+	bool bEnabled = false;
+};
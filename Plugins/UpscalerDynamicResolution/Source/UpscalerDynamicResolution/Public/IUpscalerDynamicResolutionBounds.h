@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Features/IModularFeature.h"
+
+// Registered by each upscaler plugin as a modular feature so the dynamic resolution controller keeps the
+// resolution fraction within what the active upscaler supports. Header only, upscaler modules only need the include path.
+class IUpscalerDynamicResolutionBounds : public IModularFeature
+{
+public:
+	static FName GetModularFeatureName()
+	{
+		static const FName FeatureName(TEXT("UpscalerDynamicResolutionBounds"));
+		return FeatureName;
+	}
+
+	virtual const TCHAR* GetDebugName() const = 0;
+
+	// Whether this upscaler upscales the main view family, queried on the game thread once per frame
+	virtual bool IsActive() const = 0;
+
+	virtual float GetMinResolutionFraction() const = 0;
+	virtual float GetMaxResolutionFraction() const = 0;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FUpscalerDynamicResolutionSettings
+{
+	float FrameTimeBudgetMs = 16.6f;
+
+	// PID gains, applied to the budget headroom normalized by the budget and driving the pixel count fraction
+	float ProportionalGain = 0.3f;
+	float IntegralGain = 0.05f;
+	float DerivativeGain = 0.05f;
+
+	// GPU frame times between (1 - 2 * HysteresisBand) * budget and the budget count as on target, so the resolution doesn't hunt around it
+	float HysteresisBand = 0.05f;
+
+	// Smaller changes of the resolution fraction are held back until they add up
+	float MinResolutionFractionStep = 0.02f;
+
+	// Frames to wait after a change before the resolution may go up again, going down is never delayed
+	int32 IncreaseCooldownFrames = 30;
+
+	float MinResolutionFraction = 0.5f;
+	float MaxResolutionFraction = 1.0f;
+};
+
+struct FUpscalerDynamicResolutionTelemetry
+{
+	uint64 NumFrames = 0;
+	uint64 NumBudgetMisses = 0;
+	uint64 NumResolutionChanges = 0;
+	double ElapsedMs = 0.0;
+	float LowestResolutionFraction = 1.0f;
+	float HighestResolutionFraction = 0.0f;
+
+	double GetResolutionChangesPerMinute() const
+	{
+		return ElapsedMs > 0.0 ? double(NumResolutionChanges) * 60000.0 / ElapsedMs : 0.0;
+	}
+
+	double GetBudgetMissRate() const
+	{
+		return NumFrames > 0 ? double(NumBudgetMisses) / double(NumFrames) : 0.0;
+	}
+};
+
+// One frame of a recorded trace, see FUpscalerDynamicResolutionController::LoadTrace
+struct FUpscalerDynamicResolutionTraceFrame
+{
+	float GPUFrameTimeMs = 0.0f;
+	float FrameTimeMs = 0.0f;
+	// Resolution fraction the frame was recorded at
+	float ResolutionFraction = 1.0f;
+};
+
+// Closes the loop between GPU frame time and the primary resolution fraction. Only depends on the frame times it is fed,
+// so replaying the same trace always gives the same resolution changes.
+class UPSCALERDYNAMICRESOLUTION_API FUpscalerDynamicResolutionController
+{
+public:
+	explicit FUpscalerDynamicResolutionController(const FUpscalerDynamicResolutionSettings& InSettings = FUpscalerDynamicResolutionSettings());
+
+	// Keeps the controller state, clamped to the new bounds
+	void SetSettings(const FUpscalerDynamicResolutionSettings& InSettings);
+	const FUpscalerDynamicResolutionSettings& GetSettings() const
+	{
+		return Settings;
+	}
+
+	// Feed the GPU time of one frame, returns true when the resolution fraction changed
+	bool Update(float GPUFrameTimeMs, float FrameTimeMs);
+
+	// Forget the error history, e.g. after a level load or a camera cut, the resolution fraction is kept
+	void ResetHistory();
+
+	float GetResolutionFraction() const
+	{
+		return ResolutionFraction;
+	}
+
+	const FUpscalerDynamicResolutionTelemetry& GetTelemetry() const
+	{
+		return Telemetry;
+	}
+
+	void ResetTelemetry();
+
+	// Reads a CSV trace, one frame per line as GPUFrameTimeMs[,FrameTimeMs[,ResolutionFraction]], lines that don't start with a number are skipped
+	static bool LoadTrace(const FString& Filename, TArray<FUpscalerDynamicResolutionTraceFrame>& OutTrace);
+
+	// Replays a trace through a new controller. Only PixelBoundShare of the recorded GPU time scales with the pixel count,
+	// the rest is taken as resolution independent.
+	static FUpscalerDynamicResolutionTelemetry Simulate(const TArray<FUpscalerDynamicResolutionTraceFrame>& Trace, const FUpscalerDynamicResolutionSettings& InSettings, float PixelBoundShare, TArray<float>* OutResolutionFractions = nullptr);
+
+private:
+	FUpscalerDynamicResolutionSettings Settings;
+	FUpscalerDynamicResolutionTelemetry Telemetry;
+
+	// The controller output, as a fraction of the output pixel count since that is what GPU time scales with
+	float PixelCountFraction = 1.0f;
+	float ResolutionFraction = 1.0f;
+
+	float PreviousError = 0.0f;
+	float PreviousPreviousError = 0.0f;
+	int32 FramesSinceChange = 0;
+};
@@ -0,0 +1,27 @@
+using UnrealBuildTool;
+
+public class UpscalerDynamicResolution : ModuleRules
+{
+	public UpscalerDynamicResolution(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Engine",
+				"Projects",
+				"RenderCore",
+				"Renderer",
+				"RHI",
+			}
+		);
+	}
+}
@@ -25,6 +25,7 @@
 #include "XeSSCommonMacros.h"
 
 #include "Engine/Engine.h"
+#include "Features/IModularFeatures.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
@@ -32,6 +33,7 @@
 #include "XeSSRHI.h"
 #include "XeSSUpscaler.h"
 #include "XeSSUtil.h"
+#include "IUpscalerDynamicResolutionBounds.h"
 
 DEFINE_LOG_CATEGORY(LogXeSS);
 
@@ -47,8 +49,24 @@ TAutoConsoleVariable<bool> CVarXeSSSupported(
 	TEXT("If XeSS is supported."),
 	ECVF_ReadOnly);
 
+// Keeps the shared dynamic resolution controller within the range of resolution fractions XeSS supports
+class FXeSSDynamicResolutionBounds final : public IUpscalerDynamicResolutionBounds
+{
+public:
+	FXeSSDynamicResolutionBounds(const FXeSSUpscaler* InXeSSUpscaler) : XeSSUpscaler(InXeSSUpscaler) {}
+
+	virtual const TCHAR* GetDebugName() const override { return TEXT("XeSS"); }
+	virtual bool IsActive() const override { return XeSSUpscaler->IsXeSSEnabled(); }
+	virtual float GetMinResolutionFraction() const override { return XeSSUpscaler->GetMinUpsampleResolutionFraction(); }
+	virtual float GetMaxResolutionFraction() const override { return XeSSUpscaler->GetMaxUpsampleResolutionFraction(); }
+
+private:
+	const FXeSSUpscaler* XeSSUpscaler = nullptr;
+};
+
 static TUniquePtr<FXeSSUpscaler> XeSSUpscaler;
 static TUniquePtr<FXeSSRHI> XeSSRHI;
+static TUniquePtr<FXeSSDynamicResolutionBounds> XeSSDynamicResolutionBounds;
 #if XESS_ENGINE_VERSION_GEQ(5, 1)
 static TSharedPtr<FXeSSUpscalerViewExtension, ESPMode::ThreadSafe> XeSSUpscalerViewExtension;
 #endif
@@ -125,6 +143,8 @@ void FXeSS::StartupModule()
 #if XESS_ENGINE_VERSION_GEQ(5, 1)
 		XeSSUpscalerViewExtension = FSceneViewExtensions::NewExtension<FXeSSUpscalerViewExtension>(XeSSUpscaler.Get());
 #endif
+		XeSSDynamicResolutionBounds.Reset(new FXeSSDynamicResolutionBounds(XeSSUpscaler.Get()));
+		IModularFeatures::Get().RegisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), XeSSDynamicResolutionBounds.Get());
 	}
 	else
 	{
@@ -152,6 +172,12 @@ void FXeSS::ShutdownModule()
 
 #endif
 
+	if (XeSSDynamicResolutionBounds)
+	{
+		IModularFeatures::Get().UnregisterModularFeature(IUpscalerDynamicResolutionBounds::GetModularFeatureName(), XeSSDynamicResolutionBounds.Get());
+		XeSSDynamicResolutionBounds.Reset();
+	}
+
 	XeSSRHI.Reset();
 	XeSSUpscaler.Reset();
 }
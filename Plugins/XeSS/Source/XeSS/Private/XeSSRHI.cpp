@@ -30,9 +30,12 @@
 #include "xess/xess_debug.h"
 #include "Windows/HideWindowsPlatformTypes.h"
 
+#include "Async/Async.h"
 #include "HAL/FileManager.h"
 #include "Interfaces/IPluginManager.h"
 #include "RenderGraphResources.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "XeSSUnrealD3D12RHI.h"
 #include "XeSSUnrealD3D12RHIIncludes.h"
@@ -53,6 +56,9 @@ static FResolutionFractionSetting ResolutionFractionSettings[XeSSUtil::XESS_QUAL
 static float MinResolutionFraction = 100.f;
 static float MaxResolutionFraction = 0.f;
 
+static constexpr int32 MaxRecordedInitArgs = 8;
+static constexpr int32 MaxFirstFrameLatencyHistory = 16;
+
 static TAutoConsoleVariable<int32> CVarXeSSFrameDumpStart(
 	TEXT("r.XeSS.FrameDump.Start"),
 	0,
@@ -83,6 +89,13 @@ static TAutoConsoleVariable<int32> CVarXeSSAutoExposure(
 	TEXT("[default: 1] Use XeSS internal auto exposure."),
 	ECVF_Default | ECVF_RenderThreadSafe);
 
+static TAutoConsoleVariable<int32> CVarXeSSPipelineCache(
+	TEXT("r.XeSS.PipelineCache"),
+	1,
+	TEXT("[default: 1] Keep XeSS pipelines in a pipeline library saved per adapter, driver and XeSS version, and build the pipelines of the init flags used in earlier runs in the background at startup.\n")
+	TEXT("0: build the pipelines of the current init flags at startup and wait for them, nothing is saved."),
+	ECVF_ReadOnly);
+
 // Temporary workaround for missing resource barrier flush in UE5
 inline void ForceBeforeResourceTransition(ID3D12GraphicsCommandList& D3D12CmdList, const xess_d3d12_execute_params_t& ExecuteParams)
 {
@@ -195,12 +208,26 @@ FXeSSRHI::FXeSSRHI(FDynamicRHI* DynamicRHI)
 
 	InitResolutionFractions();
 
-	// Pre-build XeSS kernel
-	Result = xessD3D12BuildPipelines(XeSSContext, nullptr, true, GetXeSSInitFlags());
-	if (XESS_RESULT_SUCCESS != Result)
+	LoadPipelineCacheRecord();
+	if (CVarXeSSPipelineCache.GetValueOnAnyThread())
 	{
-		UE_LOG(LogXeSSRHI, Error, TEXT("Failed to build XeSS pipe lines, result: %d"), Result);
-		return;
+		LoadPipelineCache(Direct3DDevice);
+	}
+
+	// Pre-build XeSS kernel, with the pipeline cache in the background, RHIInitializeXeSS waits for it if it isn't done by then
+	const uint32 InitFlags = GetXeSSInitFlags();
+	if (PipelineLibrary.IsValid())
+	{
+		BuildPipelinesWithWarmup(Direct3DDevice, InitFlags);
+	}
+	else
+	{
+		Result = xessD3D12BuildPipelines(XeSSContext, nullptr, true, InitFlags);
+		if (XESS_RESULT_SUCCESS != Result)
+		{
+			UE_LOG(LogXeSSRHI, Error, TEXT("Failed to build XeSS pipe lines, result: %d"), Result);
+			return;
+		}
 	}
 
 	static const auto CVarXeSSEnabled = IConsoleManager::Get().FindConsoleVariable(TEXT("r.XeSS.Enabled"));
@@ -236,6 +263,12 @@ FXeSSRHI::~FXeSSRHI()
 		return;
 	}
 
+	// The warm-up stores into the pipeline library as well
+	if (PipelineWarmupTask.IsValid())
+	{
+		PipelineWarmupTask.Wait();
+	}
+
 	xess_result_t Result = xessDestroyContext(XeSSContext);
 	if (Result == XESS_RESULT_SUCCESS)
 	{
@@ -245,6 +278,8 @@ FXeSSRHI::~FXeSSRHI()
 	{
 		UE_LOG(LogXeSSRHI, Warning, TEXT("Failed to remove XeSS effect"));
 	}
+
+	SavePipelineCache();
 }
 
 void FXeSSRHI::RHIInitializeXeSS(const FXeSSInitArguments& InArguments)
@@ -254,6 +289,17 @@ void FXeSSRHI::RHIInitializeXeSS(const FXeSSInitArguments& InArguments)
 		return;
 	}
 
+	// Only the first initialization after startup counts towards the first frame latency, later ones follow setting changes
+	const bool bFirstInit = !bFirstFrameReported && !bFirstFramePending;
+	if (bFirstInit)
+	{
+		bFirstInitWarm = bPipelineCacheLoaded && RecordedInitArgs.ContainsByPredicate([&InArguments](const FXeSSInitArguments& Recorded)
+		{
+			return Recorded.InitFlags == InArguments.InitFlags;
+		});
+	}
+	RecordInitArguments(InArguments);
+
 	InitArgs = InArguments;
 	QualitySetting = XeSSUtil::ToXeSSQualitySetting(InArguments.QualitySetting);
 
@@ -262,16 +308,34 @@ void FXeSSRHI::RHIInitializeXeSS(const FXeSSInitArguments& InArguments)
 	InitParams.outputResolution.y = InArguments.OutputHeight;
 	InitParams.initFlags = InArguments.InitFlags;
 	InitParams.qualitySetting = QualitySetting;
-	InitParams.pPipelineLibrary = nullptr;
+	// Must be the library the pipelines were built with
+	InitParams.pPipelineLibrary = PipelineLibrary.GetReference();
 
 	// Add DLL search path for XeFX.dll and XeFX_Loader.dll
 	// NOTE: it is a MUST, for former adding in starting up module may be cleared by engine or other plugins
 	SetDllDirectory(*FPaths::Combine(IPluginManager::Get().FindPlugin("XeSS")->GetBaseDir(), TEXT("/Binaries/ThirdParty/Win64")));
 
+	const double StartTime = FPlatformTime::Seconds();
+	// xessD3D12Init stores into the pipeline library too, so it can't run next to the background build
+	if (PipelineWarmupTask.IsValid())
+	{
+		PipelineWarmupTask.Wait();
+	}
 	xess_result_t Result = xessD3D12Init(XeSSContext, &InitParams);
+	const double InitMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
 	if (XESS_RESULT_SUCCESS != Result)
 	{
 		UE_LOG(LogXeSSRHI, Error, TEXT("Failed to initialize Intel XeSS, result: %d"), Result);
+		return;
+	}
+
+	UE_LOG(LogXeSSRHI, Verbose, TEXT("Initialized Intel XeSS in %.2f ms, output %ux%u, quality %d, init flags 0x%x"),
+		InitMs, InArguments.OutputWidth, InArguments.OutputHeight, InArguments.QualitySetting, InArguments.InitFlags);
+
+	if (bFirstInit)
+	{
+		FirstInitMs = InitMs;
+		bFirstFramePending = true;
 	}
 }
 
@@ -301,11 +365,16 @@ void FXeSSRHI::RHIExecuteXeSS(const FXeSSExecuteArguments& InArguments)
 
 	ForceBeforeResourceTransition(*D3D12CmdList, ExecuteParams);
 
+	const double StartTime = FPlatformTime::Seconds();
 	xess_result_t Result = xessD3D12Execute(XeSSContext, D3D12CmdList, &ExecuteParams);
 	if (XESS_RESULT_SUCCESS != Result)
 	{
 		UE_LOG(LogXeSSRHI, Error, TEXT("Failed to execute XeSS, result: %d"), Result);
 	}
+	else if (bFirstFramePending)
+	{
+		ReportFirstFrameLatency((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
 
 	ForceAfterResourceTransition(*D3D12CmdList, ExecuteParams);
 
@@ -344,6 +413,205 @@ void FXeSSRHI::InitResolutionFractions()
 	}
 }
 
+void FXeSSRHI::LoadPipelineCacheRecord()
+{
+	xess_version_t XeSSLibVersion = {};
+	xessGetVersion(&XeSSLibVersion);
+
+	// Pipelines are only valid for the adapter, driver and XeSS library they were built with
+	const FString CacheName = FPaths::MakeValidFileName(FString::Printf(TEXT("%04X_%04X_%s_%d.%d.%d"),
+		GRHIVendorId, GRHIDeviceId, *GRHIAdapterInternalDriverVersion,
+		XeSSLibVersion.major, XeSSLibVersion.minor, XeSSLibVersion.patch), TEXT('_'));
+	const FString CacheDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("XeSS"), TEXT("PipelineCache"));
+	PipelineCacheFilename = FPaths::Combine(CacheDir, CacheName + TEXT(".bin"));
+	PipelineCacheRecordFilename = FPaths::Combine(CacheDir, CacheName + TEXT(".txt"));
+
+	TArray<FString> Lines;
+	if (FPaths::FileExists(PipelineCacheRecordFilename) && FFileHelper::LoadFileToStringArray(Lines, *PipelineCacheRecordFilename))
+	{
+		TArray<FString> Values;
+		for (const FString& Line : Lines)
+		{
+			FString Key;
+			FString Value;
+			if (Line.StartsWith(TEXT("#")) || !Line.Split(TEXT("="), &Key, &Value))
+			{
+				continue;
+			}
+
+			if (Key == TEXT("Init") && Value.ParseIntoArray(Values, TEXT(",")) == 4 && RecordedInitArgs.Num() < MaxRecordedInitArgs)
+			{
+				FXeSSInitArguments Recorded;
+				LexFromString(Recorded.QualitySetting, *Values[0]);
+				LexFromString(Recorded.OutputWidth, *Values[1]);
+				LexFromString(Recorded.OutputHeight, *Values[2]);
+				LexFromString(Recorded.InitFlags, *Values[3]);
+				RecordedInitArgs.Add(Recorded);
+			}
+			else if (Key == TEXT("FirstFrame") && FirstFrameLatencyHistory.Num() < MaxFirstFrameLatencyHistory)
+			{
+				FirstFrameLatencyHistory.Add(Value);
+			}
+		}
+	}
+}
+
+void FXeSSRHI::LoadPipelineCache(ID3D12Device* Direct3DDevice)
+{
+	TRefCountPtr<ID3D12Device1> Direct3DDevice1;
+	if (FAILED(Direct3DDevice->QueryInterface(IID_PPV_ARGS(Direct3DDevice1.GetInitReference()))))
+	{
+		UE_LOG(LogXeSSRHI, Log, TEXT("XeSS pipeline cache not supported, no ID3D12Device1"));
+		return;
+	}
+
+	if (FFileHelper::LoadFileToArray(PipelineLibraryBlob, *PipelineCacheFilename, FILEREAD_Silent) && PipelineLibraryBlob.Num() > 0)
+	{
+		const HRESULT HResult = Direct3DDevice1->CreatePipelineLibrary(PipelineLibraryBlob.GetData(), PipelineLibraryBlob.Num(), IID_PPV_ARGS(PipelineLibrary.GetInitReference()));
+		if (SUCCEEDED(HResult))
+		{
+			bPipelineCacheLoaded = true;
+		}
+		else
+		{
+			UE_LOG(LogXeSSRHI, Log, TEXT("Discarding XeSS pipeline cache %s, result: 0x%08x"), *PipelineCacheFilename, HResult);
+			PipelineLibrary = nullptr;
+			PipelineLibraryBlob.Empty();
+		}
+	}
+	else
+	{
+		PipelineLibraryBlob.Empty();
+	}
+
+	if (!PipelineLibrary.IsValid())
+	{
+		const HRESULT HResult = Direct3DDevice1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(PipelineLibrary.GetInitReference()));
+		if (FAILED(HResult))
+		{
+			UE_LOG(LogXeSSRHI, Log, TEXT("XeSS pipeline cache not supported, result: 0x%08x"), HResult);
+			PipelineLibrary = nullptr;
+			return;
+		}
+	}
+
+	UE_LOG(LogXeSSRHI, Log, TEXT("XeSS pipeline cache %s: %d bytes, %d recorded init arguments"),
+		*PipelineCacheFilename, PipelineLibraryBlob.Num(), RecordedInitArgs.Num());
+}
+
+void FXeSSRHI::SavePipelineCache()
+{
+	// Only rewrite the library when pipelines were added to it
+	const SIZE_T SerializedSize = PipelineLibrary.IsValid() ? PipelineLibrary->GetSerializedSize() : 0;
+	if (SerializedSize > 0 && SerializedSize != SIZE_T(PipelineLibraryBlob.Num()))
+	{
+		TArray<uint8> SerializedLibrary;
+		SerializedLibrary.SetNumUninitialized(int32(SerializedSize));
+		const HRESULT HResult = PipelineLibrary->Serialize(SerializedLibrary.GetData(), SerializedSize);
+		if (FAILED(HResult) || !FFileHelper::SaveArrayToFile(SerializedLibrary, *PipelineCacheFilename))
+		{
+			UE_LOG(LogXeSSRHI, Warning, TEXT("Failed to save XeSS pipeline cache %s, result: 0x%08x"), *PipelineCacheFilename, HResult);
+		}
+	}
+
+	TArray<FString> Lines;
+	Lines.Add(TEXT("# Init=QualitySetting,OutputWidth,OutputHeight,InitFlags, most recent first"));
+	for (const FXeSSInitArguments& Recorded : RecordedInitArgs)
+	{
+		Lines.Add(FString::Printf(TEXT("Init=%d,%u,%u,%u"), Recorded.QualitySetting, Recorded.OutputWidth, Recorded.OutputHeight, Recorded.InitFlags));
+	}
+	Lines.Add(TEXT("# FirstFrame=BuildVersion,LatencyMs,PipelineCache, most recent first"));
+	for (const FString& Entry : FirstFrameLatencyHistory)
+	{
+		Lines.Add(TEXT("FirstFrame=") + Entry);
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *PipelineCacheRecordFilename))
+	{
+		UE_LOG(LogXeSSRHI, Warning, TEXT("Failed to save XeSS pipeline cache record %s"), *PipelineCacheRecordFilename);
+	}
+}
+
+void FXeSSRHI::BuildPipelinesWithWarmup(ID3D12Device* Direct3DDevice, uint32 CurrentInitFlags)
+{
+	TArray<uint32> RecordedInitFlags;
+	for (const FXeSSInitArguments& Recorded : RecordedInitArgs)
+	{
+		if (Recorded.InitFlags != CurrentInitFlags)
+		{
+			RecordedInitFlags.AddUnique(Recorded.InitFlags);
+		}
+	}
+
+	// Pipelines can't be built on a context once it is initialized, so every other set of init flags gets a context of its own
+	PipelineWarmupTask = Async(EAsyncExecution::ThreadPool, [Direct3DDevice, Context = XeSSContext, Library = PipelineLibrary, CurrentInitFlags, RecordedInitFlags]()
+	{
+		xess_result_t Result = xessD3D12BuildPipelines(Context, Library.GetReference(), true, CurrentInitFlags);
+		if (XESS_RESULT_SUCCESS != Result)
+		{
+			UE_LOG(LogXeSSRHI, Error, TEXT("Failed to build XeSS pipe lines, result: %d"), Result);
+		}
+
+		for (const uint32 InitFlags : RecordedInitFlags)
+		{
+			xess_context_handle_t WarmupContext = nullptr;
+			if (XESS_RESULT_SUCCESS != xessD3D12CreateContext(Direct3DDevice, &WarmupContext))
+			{
+				return;
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			Result = xessD3D12BuildPipelines(WarmupContext, Library.GetReference(), true, InitFlags);
+			UE_LOG(LogXeSSRHI, Verbose, TEXT("Warmed up XeSS pipelines for init flags 0x%x in %.2f ms, result: %d"),
+				InitFlags, (FPlatformTime::Seconds() - StartTime) * 1000.0, Result);
+
+			xessDestroyContext(WarmupContext);
+		}
+	});
+}
+
+void FXeSSRHI::RecordInitArguments(const FXeSSInitArguments& InArguments)
+{
+	if (!PipelineLibrary.IsValid())
+	{
+		return;
+	}
+
+	RecordedInitArgs.RemoveAll([&InArguments](const FXeSSInitArguments& Recorded)
+	{
+		return Recorded.OutputWidth == InArguments.OutputWidth
+			&& Recorded.OutputHeight == InArguments.OutputHeight
+			&& Recorded.QualitySetting == InArguments.QualitySetting
+			&& Recorded.InitFlags == InArguments.InitFlags;
+	});
+	RecordedInitArgs.Insert(InArguments, 0);
+	RecordedInitArgs.SetNum(FMath::Min(RecordedInitArgs.Num(), MaxRecordedInitArgs));
+}
+
+void FXeSSRHI::ReportFirstFrameLatency(double ExecuteMs)
+{
+	bFirstFramePending = false;
+	bFirstFrameReported = true;
+
+	const double LatencyMs = FirstInitMs + ExecuteMs;
+	const TCHAR* PipelineCacheState = !PipelineLibrary.IsValid() ? TEXT("off") : bFirstInitWarm ? TEXT("warm") : TEXT("cold");
+	UE_LOG(LogXeSSRHI, Log, TEXT("XeSS first frame latency %.2f ms (init %.2f ms, execute %.2f ms), pipeline cache %s"),
+		LatencyMs, FirstInitMs, ExecuteMs, PipelineCacheState);
+
+	if (FirstFrameLatencyHistory.Num() > 0)
+	{
+		TArray<FString> Values;
+		if (FirstFrameLatencyHistory[0].ParseIntoArray(Values, TEXT(","), false) == 3)
+		{
+			UE_LOG(LogXeSSRHI, Log, TEXT("XeSS first frame latency of the previous run %s ms (build %s), pipeline cache %s"),
+				*Values[1], *Values[0], *Values[2]);
+		}
+	}
+
+	FirstFrameLatencyHistory.Insert(FString::Printf(TEXT("%s,%.2f,%s"), FApp::GetBuildVersion(), LatencyMs, PipelineCacheState), 0);
+	FirstFrameLatencyHistory.SetNum(FMath::Min(FirstFrameLatencyHistory.Num(), MaxFirstFrameLatencyHistory));
+}
+
 void FXeSSRHI::TriggerFrameCapture(int FrameCount) const
 {
 	if (FrameCount > 0)
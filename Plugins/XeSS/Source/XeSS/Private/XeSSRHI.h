@@ -25,6 +25,7 @@
 #include "XeSSCommonMacros.h"
 
 #include "CoreMinimal.h"
+#include "Async/Future.h"
 #include "RHI.h"
 #include "ShaderParameterMacros.h"
 #include "XeSSUnrealD3D12RHI.h"
@@ -36,6 +37,7 @@ class FDynamicRHI;
 class FRHICommandListImmediate;
 class FRHITexture;
 class IConsoleVariable;
+struct ID3D12PipelineLibrary;
 
 struct FXeSSInitArguments
 {
@@ -85,6 +87,14 @@ private:
 	void InitResolutionFractions();
 	void TriggerFrameCapture(int FrameCount) const;
 
+	// Persistent pipeline cache, one per adapter, driver and XeSS version. The record next to it is kept even without the cache
+	void LoadPipelineCacheRecord();
+	void LoadPipelineCache(ID3D12Device* Direct3DDevice);
+	void SavePipelineCache();
+	void BuildPipelinesWithWarmup(ID3D12Device* Direct3DDevice, uint32 CurrentInitFlags);
+	void RecordInitArguments(const FXeSSInitArguments& InArguments);
+	void ReportFirstFrameLatency(double ExecuteMs);
+
 	XeSSUnreal::XD3D12DynamicRHI* D3D12RHI = nullptr;
 	FXeSSInitArguments InitArgs;
 
@@ -95,4 +105,24 @@ private:
 
 	// TODO: remove it
 	xess_quality_settings_t QualitySetting = XESS_QUALITY_SETTING_BALANCED;
+
+	FString PipelineCacheFilename;
+	FString PipelineCacheRecordFilename;
+	// The pipeline library reads from this memory for its whole lifetime
+	TArray<uint8> PipelineLibraryBlob;
+	TRefCountPtr<ID3D12PipelineLibrary> PipelineLibrary;
+	// Builds the pipelines of the current init flags, then those of init flags recorded in earlier runs, one at a time since they all store into PipelineLibrary
+	TFuture<void> PipelineWarmupTask;
+	bool bPipelineCacheLoaded = false;
+
+	// Init arguments used on this adapter and driver, most recent first
+	TArray<FXeSSInitArguments> RecordedInitArgs;
+	// First XeSS frame latency of earlier runs, most recent first
+	TArray<FString> FirstFrameLatencyHistory;
+
+	// xessD3D12Init time of the first initialization, reported together with its first execution
+	double FirstInitMs = 0.0;
+	bool bFirstInitWarm = false;
+	bool bFirstFramePending = false;
+	bool bFirstFrameReported = false;
 };
@@ -22,6 +22,7 @@
 
 #include "XeSSUpscaler.h"
 
+#include "Containers/LockFreeList.h"
 #include "Engine/GameViewportClient.h"
 
 #if XESS_ENGINE_VERSION_LSS(5, 1)
@@ -77,6 +78,11 @@ static TAutoConsoleVariable<int32> CVarXeSSPreExposure(
 
 DECLARE_GPU_STAT_NAMED(XeSS, TEXT("XeSS"));
 
+DECLARE_STATS_GROUP(TEXT("XeSS"), STATGROUP_XeSS, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("XeSS: Upscaler interface allocations"), STAT_XeSSUpscalerAllocations, STATGROUP_XeSS);
+DECLARE_CYCLE_STAT(TEXT("XeSS: View extension IsActiveThisFrame"), STAT_XeSSIsActiveThisFrame, STATGROUP_XeSS);
+DECLARE_DWORD_COUNTER_STAT(TEXT("XeSS: Screen percentage checks"), STAT_XeSSScreenPercentageChecks, STATGROUP_XeSS);
+
 FXeSSPassParameters::FXeSSPassParameters(const FViewInfo& View, const XeSSUnreal::XPassInputs& PassInputs)
 	: InputViewRect(View.ViewRect)
 	, OutputViewRect(FIntPoint::ZeroValue, View.GetSecondaryViewRectSize())
@@ -440,11 +446,41 @@ float FXeSSUpscaler::GetMaxUpsampleResolutionFraction() const
 #if XESS_ENGINE_VERSION_GEQ(5, 1)
 XeSSUnreal::XTemporalUpscaler* FXeSSUpscaler::Fork_GameThread(const FSceneViewFamily& ViewFamily) const
 {
-	return new FXeSSUpscaler(FXeSSUpscaler::UpscalerXeSSRHI);
+	return new FXeSSUpscaler();
 }
 void FXeSSUpscaler::SetupViewFamily(FSceneViewFamily& ViewFamily)
 {
-	ViewFamily.SetTemporalUpscalerInterface(new FXeSSUpscaler(UpscalerXeSSRHI));
+	ViewFamily.SetTemporalUpscalerInterface(new FXeSSUpscaler());
+}
+
+// Instances are created on the game thread and released on the render thread once the view family is done
+static TLockFreePointerListUnordered<void, PLATFORM_CACHE_LINE_SIZE> GXeSSUpscalerFreeList;
+
+void* FXeSSUpscaler::operator new(size_t Size)
+{
+	check(Size == sizeof(FXeSSUpscaler));
+	void* Ptr = GXeSSUpscalerFreeList.Pop();
+	if (!Ptr)
+	{
+		INC_DWORD_STAT(STAT_XeSSUpscalerAllocations);
+		Ptr = FMemory::Malloc(sizeof(FXeSSUpscaler), alignof(FXeSSUpscaler));
+	}
+	return Ptr;
+}
+
+void FXeSSUpscaler::operator delete(void* Ptr)
+{
+	if (Ptr)
+	{
+		GXeSSUpscalerFreeList.Push(Ptr);
+	}
+}
+
+FXeSSUpscaler::FXeSSUpscaler()
+{
+#if XESS_ENGINE_VERSION_GEQ(5, 3)
+	DummyHistory = new FXeSSHistory(this);
+#endif
 }
 #endif
 
@@ -497,9 +533,16 @@ FXeSSUpscaler::~FXeSSUpscaler()
 }
 
 #if XESS_ENGINE_VERSION_GEQ(5, 1)
+// Bumped whenever a console variable changed, see FXeSSUpscalerViewExtension::IsScreenPercentageSupported
+static uint32 GXeSSConsoleVariablesGeneration = 0;
+static FAutoConsoleVariableSink CXeSSConsoleVariablesSink(FConsoleCommandDelegate::CreateLambda([]()
+{
+	++GXeSSConsoleVariablesGeneration;
+}));
+
 bool FXeSSUpscalerViewExtension::IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const
 {
-	static const auto ScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	SCOPE_CYCLE_COUNTER(STAT_XeSSIsActiveThisFrame);
 	bool IsXeSSEnabled = XeSSUpscaler->IsXeSSEnabled();
 
 	if (Context.Viewport == nullptr || !GEngine)
@@ -535,33 +578,53 @@ bool FXeSSUpscalerViewExtension::IsActiveThisFrame_Internal(const FSceneViewExte
 		{
 			if (IsXeSSEnabled)
 			{
-				float MinUpsampleScreenPercentage = XeSSUpscaler->GetMinUpsampleResolutionFraction() * 100.f;
-				float MaxUpsampleScreenPercentage = XeSSUpscaler->GetMaxUpsampleResolutionFraction() * 100.f;
-				float CurrentScreenPercentage = ScreenPercentage->GetFloat();
-
-				if (CurrentScreenPercentage >= MinUpsampleScreenPercentage &&
-					CurrentScreenPercentage <= MaxUpsampleScreenPercentage ||
-					FMath::IsNearlyEqual(CurrentScreenPercentage, MinUpsampleScreenPercentage, SCREEN_PERCENTAGE_ERROR_TOLERANCE) ||
-					FMath::IsNearlyEqual(CurrentScreenPercentage, MaxUpsampleScreenPercentage, SCREEN_PERCENTAGE_ERROR_TOLERANCE))
-				{
-					XeSSUtil::RemoveMessageFromScreen(XeSSUtil::ON_SCREEN_MESSAGE_KEY_INCORRECT_SCREEN_PERCENTAGE);
-					return true;
-				}
-				else
-				{
-					XeSSUtil::AddErrorMessageToScreen(
-						FString::Printf(TEXT("XeSS is off due to invalid screen percentage, supported range: %.3f - %.3f"), 
-							MinUpsampleScreenPercentage, MaxUpsampleScreenPercentage),
-						XeSSUtil::ON_SCREEN_MESSAGE_KEY_INCORRECT_SCREEN_PERCENTAGE
-					);
-					return false;
-				}
+				return IsScreenPercentageSupported();
 			}
 		}
 		return false;
 	}
 }
 
+bool FXeSSUpscalerViewExtension::IsScreenPercentageSupported() const
+{
+	const float MinUpsampleResolutionFraction = XeSSUpscaler->GetMinUpsampleResolutionFraction();
+	const float MaxUpsampleResolutionFraction = XeSSUpscaler->GetMaxUpsampleResolutionFraction();
+	if (ScreenPercentageCheckGeneration == GXeSSConsoleVariablesGeneration &&
+		ScreenPercentageCheckMinFraction == MinUpsampleResolutionFraction &&
+		ScreenPercentageCheckMaxFraction == MaxUpsampleResolutionFraction)
+	{
+		return bScreenPercentageSupported;
+	}
+	ScreenPercentageCheckGeneration = GXeSSConsoleVariablesGeneration;
+	ScreenPercentageCheckMinFraction = MinUpsampleResolutionFraction;
+	ScreenPercentageCheckMaxFraction = MaxUpsampleResolutionFraction;
+	INC_DWORD_STAT(STAT_XeSSScreenPercentageChecks);
+
+	static const auto ScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	float MinUpsampleScreenPercentage = MinUpsampleResolutionFraction * 100.f;
+	float MaxUpsampleScreenPercentage = MaxUpsampleResolutionFraction * 100.f;
+	float CurrentScreenPercentage = ScreenPercentage->GetFloat();
+
+	bScreenPercentageSupported = CurrentScreenPercentage >= MinUpsampleScreenPercentage &&
+		CurrentScreenPercentage <= MaxUpsampleScreenPercentage ||
+		FMath::IsNearlyEqual(CurrentScreenPercentage, MinUpsampleScreenPercentage, SCREEN_PERCENTAGE_ERROR_TOLERANCE) ||
+		FMath::IsNearlyEqual(CurrentScreenPercentage, MaxUpsampleScreenPercentage, SCREEN_PERCENTAGE_ERROR_TOLERANCE);
+
+	if (bScreenPercentageSupported)
+	{
+		XeSSUtil::RemoveMessageFromScreen(XeSSUtil::ON_SCREEN_MESSAGE_KEY_INCORRECT_SCREEN_PERCENTAGE);
+	}
+	else
+	{
+		XeSSUtil::AddErrorMessageToScreen(
+			FString::Printf(TEXT("XeSS is off due to invalid screen percentage, supported range: %.3f - %.3f"), 
+				MinUpsampleScreenPercentage, MaxUpsampleScreenPercentage),
+			XeSSUtil::ON_SCREEN_MESSAGE_KEY_INCORRECT_SCREEN_PERCENTAGE
+		);
+	}
+	return bScreenPercentageSupported;
+}
+
 void FXeSSUpscalerViewExtension::BeginRenderViewFamily(FSceneViewFamily& ViewFamily)
 {
 	if (!ViewFamily.bRealtimeUpdate ||
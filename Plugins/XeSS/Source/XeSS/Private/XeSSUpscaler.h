@@ -104,6 +104,10 @@ public:
 	XeSSUnreal::XTemporalUpscaler* Fork_GameThread(const class FSceneViewFamily& ViewFamily) const final;
 	// Called by FXeSSUpscalerViewExtension
 	void SetupViewFamily(FSceneViewFamily& ViewFamily);
+
+	// Per view family instances are created and destroyed every frame, recycle their memory instead of going to the allocator
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
 #else
 	// Inherited via ICustomStaticScreenPercentage
 	virtual void SetupMainGameViewFamily(FSceneViewFamily& ViewFamily) final;
@@ -127,6 +131,11 @@ private:
 #endif
 
 private:
+#if XESS_ENGINE_VERSION_GEQ(5, 1)
+	// Lightweight per view family instance, skips the console variable setup done by the module's instance
+	FXeSSUpscaler();
+#endif
+
 	static FXeSSRHI* UpscalerXeSSRHI;
 
 #if XESS_ENGINE_VERSION_GEQ(5, 3)
@@ -149,7 +158,15 @@ public:
 	// Empty implementation for pure virtual
 	virtual void SetupViewFamily(FSceneViewFamily& ViewFamily) override {};
 private:
+	// Only re-evaluated (and the on screen error updated) when a console variable or the supported range changed
+	bool IsScreenPercentageSupported() const;
+
 	FXeSSUpscaler* XeSSUpscaler = nullptr;
+
+	mutable uint32 ScreenPercentageCheckGeneration = MAX_uint32;
+	mutable float ScreenPercentageCheckMinFraction = 0.f;
+	mutable float ScreenPercentageCheckMaxFraction = 0.f;
+	mutable bool bScreenPercentageSupported = false;
 };
 
 #endif
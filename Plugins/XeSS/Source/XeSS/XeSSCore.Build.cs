@@ -76,6 +76,9 @@ public class XeSSCore : ModuleRules
 			PrivateDependencyModuleNames.Add("RHICore");
 		}
 
+		// Header only IUpscalerDynamicResolutionBounds
+		PrivateIncludePathModuleNames.Add("UpscalerDynamicResolution");
+
 		// Needed for D3D12RHI
 		AddEngineThirdPartyPrivateStaticDependencies(Target, "DX12");
 		AddEngineThirdPartyPrivateStaticDependencies(Target, "NVAPI");